@@ -78,7 +78,7 @@ group corresponding to each bit set.
 @throws IllegalArgumentException if `vertices` has fewer than 3 points defined.
 */
 
-private[anim] final class Face(vertices: List[RichPoint],
+private[anim] final class Face(private[anim] val vertices: List[RichPoint],
 val smoothingGroup: Int = 0) {
 
 /*
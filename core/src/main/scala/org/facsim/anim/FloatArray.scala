@@ -0,0 +1,122 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim package.
+*/
+
+package org.facsim.anim
+
+import java.util.Arrays
+
+/**
+Growable array of single-precision floating point values.
+
+Values are appended to a primitive array, which is enlarged as necessary, so
+that large numbers of values can be accumulated without boxing each value or
+allocating a new collection for each value appended.
+
+@constructor Create a new, empty growable array.
+
+@param initialCapacity Number of values that can be appended before the array
+must be enlarged. This value must be positive.
+*/
+
+private[anim] final class FloatArray(initialCapacity: Int =
+FloatArray.DefaultCapacity) {
+
+/*
+Sanity checks.
+*/
+
+  assert(initialCapacity > 0)
+
+/**
+Storage for the values appended.
+*/
+
+  private var elements = new Array[Float](initialCapacity) // scalastyle:ignore
+
+/**
+Number of values appended.
+*/
+
+  private var count = 0 // scalastyle:ignore
+
+/**
+Report the number of values appended.
+
+@return Number of values appended.
+*/
+  def length = count
+
+/**
+Retrieve the value at the specified index.
+
+@param index Index of the value to be retrieved, which must be in the range [0,
+`length`).
+
+@return Value at `index`.
+*/
+  def apply(index: Int) = {
+    assert(index >= 0 && index < count)
+    elements(index)
+  }
+
+/**
+Append a value to the array.
+
+@param value Value to be appended.
+*/
+  def +=(value: Float): Unit = { //scalastyle:ignore
+    if(count == elements.length) elements = Arrays.copyOf(elements, 2 * count)
+    elements(count) = value
+    count += 1
+  }
+
+/**
+Retrieve the values appended as a primitive array.
+
+@return New array containing the values appended, in the order appended.
+*/
+  def toArray = Arrays.copyOf(elements, count)
+}
+
+/**
+Growable float array companion.
+*/
+
+private[anim] object FloatArray {
+
+/**
+Default capacity of new growable arrays.
+*/
+
+  val DefaultCapacity = 64
+}
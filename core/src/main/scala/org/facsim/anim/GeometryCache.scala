@@ -0,0 +1,202 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim package.
+*/
+
+package org.facsim.anim
+
+import org.facsim.util.Memoize
+import scalafx.scene.shape.TriangleMesh
+import scalafx.scene.transform.{Affine, Transform}
+
+/**
+Cache of shared, canonical primitive geometry.
+
+Scenes frequently contain large numbers of primitives that differ only in their
+size; a factory layout may include thousands of identical rollers, posts or
+totes, for example. Rather than constructing a separate mesh for each such
+primitive, each is rendered with a shared, canonical ''unit'' mesh, which is
+generated once, together with an affine transform that maps the unit mesh onto
+the primitive's actual dimensions.
+
+Unit meshes have a base in the local ''X-Y'' plane, centered at the origin, and
+a top whose center is at (0, 0, 1). Curved primitives have a unit base radius,
+and rectangular primitives have a unit base length and width. A primitive with
+a base scaled by (`xScale`, `yScale`), a height of `height` and a top whose
+center is offset by (`xOffset`, `yOffset`) is then rendered by transforming its
+unit mesh with the transform returned by
+[[org.facsim.anim.GeometryCache.shape]].
+
+Unit meshes are keyed by the type of primitive, the number of divisions (for
+curved primitives) and the ratio of top to base dimensions (for frustums). Each
+cache retains a bounded number of meshes.
+*/
+
+private[anim] object GeometryCache {
+
+/**
+Maximum number of unit meshes retained for each type of primitive.
+*/
+
+  val Capacity = 256
+
+/**
+Unit height.
+*/
+
+  private val UnitTop = Point3D(0.0, 0.0, 1.0)
+
+/**
+Unit cylinder meshes, keyed by number of divisions.
+*/
+
+  private val cylinders = Memoize((divisions: Int) =>
+  Mesh.cylinder(Point3D.Origin, 1.0, UnitTop, divisions).triangleMesh,
+  Capacity)
+
+/**
+Unit cone meshes, keyed by number of divisions.
+*/
+
+  private val cones = Memoize((divisions: Int) =>
+  Mesh.cone(Point3D.Origin, 1.0, UnitTop, divisions).triangleMesh, Capacity)
+
+/**
+Unit hemisphere meshes, keyed by number of divisions.
+*/
+
+  private val hemispheres = Memoize((divisions: Int) =>
+  Mesh.hemisphere(Point3D.Origin, 1.0, divisions).triangleMesh, Capacity)
+
+/**
+Unit conic frustum meshes, keyed by ratio of top to base radius and number of
+divisions.
+*/
+
+  private val conicFrustums = Memoize((ratio: Double, divisions: Int) =>
+  Mesh.conicFrustum(Point3D.Origin, 1.0, UnitTop, ratio,
+  divisions).triangleMesh, Capacity)
+
+/**
+Unit rectangular frustum meshes, keyed by ratios of top to base length and
+width.
+*/
+
+  private val rectangularFrustums = Memoize((lengthRatio: Double, widthRatio:
+  Double) => Mesh.rectangularFrustum(Point3D.Origin, 1.0, 1.0, UnitTop,
+  lengthRatio, widthRatio).triangleMesh, Capacity)
+
+/**
+Retrieve the unit cylinder mesh with the indicated number of divisions.
+
+@param divisions Number of divisions around the circumference, which must be at
+least 3.
+
+@return Shared unit cylinder mesh.
+*/
+  def cylinder(divisions: Int): TriangleMesh = cylinders(divisions)
+
+/**
+Retrieve the unit cone mesh with the indicated number of divisions.
+
+@param divisions Number of divisions around the circumference, which must be at
+least 3.
+
+@return Shared unit cone mesh.
+*/
+  def cone(divisions: Int): TriangleMesh = cones(divisions)
+
+/**
+Retrieve the unit hemisphere mesh with the indicated number of divisions.
+
+@note Hemispheres have no offset top, and must be scaled equally along each
+axis.
+
+@param divisions Number of divisions around the circumference, which must be at
+least 3.
+
+@return Shared unit hemisphere mesh.
+*/
+  def hemisphere(divisions: Int): TriangleMesh = hemispheres(divisions)
+
+/**
+Retrieve the unit conic frustum mesh with the indicated shape.
+
+@param ratio Ratio of the top radius to the base radius, which must be
+non-negative.
+
+@param divisions Number of divisions around the circumference, which must be at
+least 3.
+
+@return Shared unit conic frustum mesh.
+*/
+  def conicFrustum(ratio: Double, divisions: Int): TriangleMesh =
+  conicFrustums(ratio, divisions)
+
+/**
+Retrieve the unit rectangular frustum mesh with the indicated shape.
+
+@param lengthRatio Ratio of the top length to the base length, which must be
+non-negative.
+
+@param widthRatio Ratio of the top width to the base width, which must be
+non-negative.
+
+@return Shared unit rectangular frustum mesh.
+*/
+  def rectangularFrustum(lengthRatio: Double, widthRatio: Double):
+  TriangleMesh = rectangularFrustums(lengthRatio, widthRatio)
+
+/**
+Create the transform mapping a unit mesh onto a primitive's dimensions.
+
+@param xScale Scale of the primitive's base along the local ''X''-axis. This
+value should be positive.
+
+@param yScale Scale of the primitive's base along the local ''Y''-axis. This
+value should be positive.
+
+@param xOffset Offset of the center of the primitive's top along the local
+''X''-axis.
+
+@param yOffset Offset of the center of the primitive's top along the local
+''Y''-axis.
+
+@param height Height of the primitive along the local ''Z''-axis. This value
+should be positive.
+
+@return Affine transform mapping unit mesh coordinates to the coordinates of the
+primitive.
+*/
+  def shape(xScale: Double, yScale: Double, xOffset: Double, yOffset: Double,
+  height: Double): Affine = Transform.affine(xScale, 0.0, xOffset, 0.0, 0.0,
+  yScale, yOffset, 0.0, 0.0, 0.0, height, 0.0)
+}
@@ -0,0 +1,146 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim package.
+*/
+
+package org.facsim.anim
+
+import org.facsim.{requireFinite, requireValid}
+
+/**
+Level-of-detail policy for curved 3D primitives.
+
+Curved primitives, such as cylinders, cones and hemispheres, are approximated
+by a number of flat ''divisions'' around their circumference. Small primitives
+require few divisions to look smooth once rendered, while large primitives
+require more. This policy chooses the number of divisions from the size that a
+primitive is expected to have on screen, so that each division spans roughly
+the same number of pixels.
+
+The number of divisions chosen is always a power of two (unless limited by
+`minDivisions` or `maxDivisions`), so that primitives of similar sizes are
+built with the same number of divisions and can share the same geometry.
+
+@constructor Create a new level-of-detail policy.
+
+@param pixelsPerUnit Expected number of screen pixels spanned by a single unit
+of distance, at the nominal viewing distance of the scene. This value must be
+finite and positive.
+
+@param segmentPixels Desired length, in screen pixels, of each division around
+a primitive's circumference. This value must be finite and positive.
+
+@param minDivisions Minimum number of divisions of any primitive, which must be
+at least 3.
+
+@param maxDivisions Maximum number of divisions of any primitive, which must be
+at least `minDivisions`.
+
+@throws IllegalArgumentException if any argument is invalid.
+
+@since 0.3
+*/
+
+final case class LevelOfDetail(pixelsPerUnit: Double, segmentPixels: Double =
+LevelOfDetail.DefaultSegmentPixels, minDivisions: Int =
+LevelOfDetail.DefaultMinDivisions, maxDivisions: Int =
+LevelOfDetail.DefaultMaxDivisions) {
+
+/*
+Sanity checks.
+*/
+
+  requireFinite(pixelsPerUnit)
+  requireValid(pixelsPerUnit, pixelsPerUnit > 0.0)
+  requireFinite(segmentPixels)
+  requireValid(segmentPixels, segmentPixels > 0.0)
+  requireValid(minDivisions, minDivisions > 2)
+  requireValid(maxDivisions, maxDivisions >= minDivisions)
+
+/**
+Determine the number of divisions of a primitive with the indicated radius.
+
+@param radius Radius of the primitive's largest circumference, in units of
+distance. This value must be finite and non-negative.
+
+@return Number of divisions of the primitive, in the range [`minDivisions`,
+`maxDivisions`].
+
+@throws IllegalArgumentException if `radius` is invalid.
+
+@since 0.3
+*/
+  def divisions(radius: Double) = {
+    requireFinite(radius)
+    requireValid(radius, radius >= 0.0)
+
+/*
+Determine the number of divisions that would span the desired number of pixels
+each, then round that up to the next power of two.
+*/
+
+    val segments = Math.ceil(2.0 * Math.PI * radius * pixelsPerUnit /
+    segmentPixels)
+    if(segments <= minDivisions) minDivisions
+    else if(segments >= maxDivisions) maxDivisions
+    else {
+      val power = Integer.highestOneBit(segments.toInt - 1) << 1
+      Math.max(minDivisions, Math.min(power, maxDivisions))
+    }
+  }
+}
+
+/**
+Level-of-detail policy companion.
+
+@since 0.3
+*/
+
+object LevelOfDetail {
+
+/**
+Default desired length, in screen pixels, of each division.
+*/
+
+  val DefaultSegmentPixels = 8.0
+
+/**
+Default minimum number of divisions.
+*/
+
+  val DefaultMinDivisions = 8
+
+/**
+Default maximum number of divisions.
+*/
+
+  val DefaultMaxDivisions = 128
+}
@@ -76,166 +76,100 @@ mesh's list of faces.
   }
 
 /**
-Transform the supplied faces into a flattened list of triangular faces.
-
-@return List of triangular faces making up the list.
-*/
-  private def fs = faces.map(_.toList).flatten
-
-/**
-Obtain a list of 3D animation points making up the faces in this mesh.
-
-@note Some duplication of points is possible; this is not an issue, but the
-number of duplications should be minimized for performance reasons. For this
-reason, we look at the points on the passed face list, rather than the points
-on the list of triangular faces.
-
-@return List of 3D animation points making up the faces.
-*/
-  private def pointList = faces.map(_.points).flatten
-
-/**
-Obtain a list of texture map points making up the faces in this mesh.
-
-@note Some duplication of points is possible; this is not an issue, but the
-number of duplications should be minimized for performance reasons. For this
-reason, we look at the points on the passed face list, rather than the points
-on the list of triangular faces.
-
-@return List of texture map points making up the faces.
-*/
-  private def texturePointList = faces.map(_.texturePoints).flatten
-
-/**
-For each unique item in a list, create a map associating the item with a unique
-index value and a vector associating the index value with the list item.
-
-The index values mapped to should be consecutive and zero-based.
-
-@param list List to be analyzed. List members should be comparable and must
-implement the [[scala.Equals]] trait.
-
-@tparam T Type of element for which a map and vector is sought.
-
-@return Pair containing a map, associating each unique value in `list` to a
-unique integer index value, and a vector, associating each unique index value
-to the associated list element. Index values should be consecutive in range [0,
-n-1], where ''n'' is the number of elements in the resulting map & vector.
-*/
-  private def createMapVect[T <: Equals](list: List[T]) = {
-
-/*
-Tail-recursive helper function to build map & vector from remaining elements.
-*/
-
-    @tailrec
-    def buildMapVect(xs: List[T], map: Map[T, Int], vect: Vector[T]):
-   (Map[T, Int], Vector[T]) = {
-
-/*
-If there are no more elements to be processed, return the map and vector we
-have built.
-*/
-
-      if(xs.isEmpty)(map, vect)
-
-/*
-Otherwise, determine the map & vector builder for the new iteration.
-*/
+Convert mesh to form for rendering by animation system.
 
-      else {
-        val x = xs.head
+Each face's vertices are visited once, and written directly into primitive
+arrays. Distinct 3D animation points and texture map points are each assigned
+consecutive index values, in the order in which they are first encountered, by a
+[[org.facsim.anim.VertexTable!]]; points are distinct if their single-precision
+coordinates differ. Each face is then output as its triangular faces, in the
+same order as those of [[org.facsim.anim.Face!.toList]].
 
-/*
-If the head of the list is already in the map, then we retain the current map
-and vector builder for the next iteration.
+@return [[scalafx.scene.shape.TriangleMesh]] representing this mesh instance.
 */
-
-        val(m, v) = if(map.contains(x))(map, vect)
+  private[anim] def triangleMesh = {
 
 /*
-Otherwise, add the new element to the map and vector.
+Tables of the distinct 3D animation points and texture map points, and arrays
+to hold the zipped point indices and smoothing group of each triangular face.
 */
 
-        else(map +(x -> map.size), vect :+ x)
+    val points = new VertexTable(3)
+    val texturePoints = new VertexTable(2)
+    val faceIndices = new IntArray
+    val smoothingGroups = new IntArray
 
 /*
-Verify that the map and vector tally.
+Zipped 3D animation point and texture map point indices of each vertex of the
+face currently being processed. This is re-used for each face.
 */
 
-        assert(v(m(x)) == x)
+    val vertexIndices = new IntArray
 
 /*
-Iterate to process the remaining elements of the list.
+Helper function to look-up the indices of each of a face's vertices.
 */
 
-        buildMapVect(xs.tail, m, v)
+    @tailrec
+    def indexVertices(vertices: List[RichPoint]): Unit = {
+      if(!vertices.isEmpty) {
+        val p = vertices.head.point
+        val t = vertices.head.texturePoint
+        vertexIndices += points.index(p.x.toFloat, p.y.toFloat, p.z.toFloat)
+        vertexIndices += texturePoints.index(t.u, t.v, 0.0f)
+        indexVertices(vertices.tail)
       }
     }
 
 /*
-Start the ball rolling by passing in the whole list with an empty map and
-vector.
+Helper function to output the indices of a vertex of the current face.
 */
 
-    buildMapVect(list, Map.empty, Vector.empty)
-  }
-
-/**
-Convert mesh to form for rendering by animation system.
-
-@return [[scalafx.scene.shape.TriangleMesh]] representing this mesh instance.
-*/
-  private[anim] def triangleMesh = {
+    def outputVertex(vertex: Int): Unit = {
+      faceIndices += vertexIndices(2 * vertex)
+      faceIndices += vertexIndices(2 * vertex + 1)
+    }
 
 /*
-Create a map of 3D animation points to their index value, and a vector
-associating the index values to the associated points.
+Helper function to output the triangular faces of the current face. Each
+triangular face is formed from the first vertex and a pair of consecutive
+vertices; they are output starting with the last pair.
 */
 
-    val(pMap, pVect) = createMapVect(pointList)
+    @tailrec
+    def outputTriangles(second: Int, smoothingGroup: Int): Unit = {
+      if(second > 0) {
+        outputVertex(0)
+        outputVertex(second)
+        outputVertex(second + 1)
+        smoothingGroups += smoothingGroup
+        outputTriangles(second - 1, smoothingGroup)
+      }
+    }
 
 /*
-Create a map of texture map points to their index value, and a vector
-associating the index values to the associated points.
+Process each face in turn.
 */
 
-    val(tMap, tVect) = createMapVect(texturePointList)
+    faces.foreach {
+      face =>
+      vertexIndices.clear()
+      indexVertices(face.vertices)
+      outputTriangles(vertexIndices.length / 2 - 2, face.smoothingGroup)
+    }
 
 /*
-Construct the TriangleMesh instance to hold this mesh's data.
+Construct the TriangleMesh instance to hold this mesh's data, and output each
+unique 3D face vertex (as its x, y & z coordinates), each unique texture map
+point (as its u & v coordinates), each face (as its zipped 3D animation point
+and texture map point indices) and the smoothing group of each face.
 */
 
     val mesh = new TriangleMesh()
-
-/*
-Output each unique 3D face vertex in the form of a floating point array, in
-which each point is represented by three floating point values equivalent to
-that point's x, y & x coordinates.
-*/
-
-    mesh.points = pVect.flatMap(_.toFloatList).toArray
-
-/*
-Output each unique 3D face texture map point in the form of a floating point
-array, in which each point is represented by two floating point values
-equivalent to that point's u & v coordinates.
-*/
-
-    mesh.texCoords = tVect.flatMap(_.toList).toArray
-
-/*
-Output each face as a zipped array of its 3D animation point and texture map
-point indices.
-*/
-
-    mesh.faces = fs.flatMap(f => f.indices(pMap, tMap)).toArray
-
-/*
-Finally, output the smoothing group associated with each face as a list.
-*/
-
-    mesh.faceSmoothingGroups = fs.map(_.smoothingGroup).toArray
+    mesh.points = points.toArray
+    mesh.texCoords = texturePoints.toArray
+    mesh.faces = faceIndices.toArray
+    mesh.faceSmoothingGroups = smoothingGroups.toArray
 
 /*
 Return the resulting mesh.
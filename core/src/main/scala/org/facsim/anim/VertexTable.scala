@@ -0,0 +1,288 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim package.
+*/
+
+package org.facsim.anim
+
+import java.lang.Float.floatToIntBits
+import java.util.Arrays
+import scala.annotation.tailrec
+
+/**
+Table assigning consecutive, zero-based indices to distinct vertices.
+
+Vertices are identified by up to three single-precision coordinates, which are
+stored consecutively in a primitive array, so that the coordinates of the
+distinct vertices can be output directly in the form required by a
+[[scalafx.scene.shape.TriangleMesh]]. Vertices are located with an
+open-addressing hash table of vertex indices, keyed on the vertices'
+coordinates, which avoids boxing each vertex or coordinate.
+
+Vertices are distinct if any of their coordinates differ as single-precision
+values; in particular, two vertices that differ only in the sign of a zero
+coordinate are the same vertex.
+
+@constructor Create a new, empty vertex table.
+
+@param dimension Number of coordinates identifying each vertex, which must be 2
+(for texture map points) or 3 (for points in 3D animation space).
+*/
+
+private[anim] final class VertexTable(dimension: Int) {
+
+/*
+Sanity checks.
+*/
+
+  assert(dimension == 2 || dimension == 3)
+
+/**
+Coordinates of each distinct vertex, in order of their indices.
+*/
+
+  private val coordinates = new FloatArray(dimension *
+  VertexTable.InitialSlots)
+
+/**
+Hash table slots, each holding the index of a vertex, or `Empty`. The number of
+slots is always a power of two.
+*/
+
+  private var slots = // scalastyle:ignore
+  VertexTable.emptySlots(VertexTable.InitialSlots)
+
+/**
+Number of distinct vertices in the table.
+*/
+
+  private var count = 0 // scalastyle:ignore
+
+/**
+Report the number of distinct vertices in the table.
+
+@return Number of distinct vertices.
+*/
+  def size = count
+
+/**
+Retrieve the index of a vertex, adding it to the table if it is not present.
+
+@param x First coordinate of the vertex.
+
+@param y Second coordinate of the vertex.
+
+@param z Third coordinate of the vertex. This value is ignored if the table's
+dimension is 2.
+
+@return Index of the vertex. The first distinct vertex has the index 0, the
+second 1, and so on.
+*/
+  def index(x: Float, y: Float, z: Float): Int = {
+
+/*
+Adding zero converts negative zero coordinates to positive zero, so that they
+have the same bit patterns.
+*/
+
+    val cx = x + 0.0f
+    val cy = y + 0.0f
+    val cz = if(dimension == 3) z + 0.0f else 0.0f
+
+/*
+Probe the table, starting from the slot identified by the vertex's hash,
+until either the vertex or an empty slot is found.
+*/
+
+    @tailrec
+    def probe(slot: Int): Int = {
+      val i = slots(slot)
+      if(i == VertexTable.Empty) {
+        val added = add(cx, cy, cz)
+        slots(slot) = added
+        if(2 * count > slots.length) rehash()
+        added
+      }
+      else if(matches(i, cx, cy, cz)) i
+      else probe((slot + 1) & (slots.length - 1))
+    }
+    probe(hash(cx, cy, cz) & (slots.length - 1))
+  }
+
+/**
+Retrieve the coordinates of all distinct vertices.
+
+@return Array of coordinates. The coordinates of the vertex with index ''i''
+begin at element ''i'' &times; `dimension`.
+*/
+  def toArray = coordinates.toArray
+
+/**
+Determine whether the vertex with the specified index has the indicated
+coordinates.
+
+@param i Index of the vertex.
+
+@param x First coordinate.
+
+@param y Second coordinate.
+
+@param z Third coordinate.
+
+@return `true` if the vertex's coordinates match; `false` otherwise.
+*/
+  private def matches(i: Int, x: Float, y: Float, z: Float) = {
+    val base = i * dimension
+    coordinates(base) == x && coordinates(base + 1) == y &&
+    (dimension == 2 || coordinates(base + 2) == z)
+  }
+
+/**
+Hash the specified coordinates.
+
+@param x First coordinate.
+
+@param y Second coordinate.
+
+@param z Third coordinate.
+
+@return Hash of the coordinates, with well-mixed low-order bits.
+*/
+  private def hash(x: Float, y: Float, z: Float) = {
+    val h = floatToIntBits(x) * VertexTable.XPrime ^
+    floatToIntBits(y) * VertexTable.YPrime ^
+    floatToIntBits(z) * VertexTable.ZPrime
+    h ^ (h >>> VertexTable.MixShift)
+  }
+
+/**
+Add the coordinates of a new vertex to the table.
+
+@param x First coordinate.
+
+@param y Second coordinate.
+
+@param z Third coordinate.
+
+@return Index of the new vertex.
+*/
+  private def add(x: Float, y: Float, z: Float) = {
+    val i = count
+    coordinates += x
+    coordinates += y
+    if(dimension == 3) coordinates += z
+    count += 1
+    i
+  }
+
+/**
+Double the number of hash table slots, and re-insert each vertex.
+
+This is performed whenever the hash table becomes more than half full, so that
+probe sequences remain short.
+*/
+  private def rehash(): Unit = {
+    val resized = VertexTable.emptySlots(2 * slots.length)
+    val mask = resized.length - 1
+    @tailrec
+    def insert(slot: Int, i: Int): Unit = {
+      if(resized(slot) == VertexTable.Empty) resized(slot) = i
+      else insert((slot + 1) & mask, i)
+    }
+    @tailrec
+    def reinsert(i: Int): Unit = {
+      if(i < count) {
+        val base = i * dimension
+        val z = if(dimension == 3) coordinates(base + 2) else 0.0f
+        insert(hash(coordinates(base), coordinates(base + 1), z) & mask, i)
+        reinsert(i + 1)
+      }
+    }
+    reinsert(0)
+    slots = resized
+  }
+}
+
+/**
+Vertex table companion.
+*/
+
+private object VertexTable {
+
+/**
+Value of an empty hash table slot.
+*/
+
+  val Empty = -1
+
+/**
+Initial number of hash table slots.
+*/
+
+  val InitialSlots = 64
+
+/**
+Multiplier mixing the bits of the first coordinate into a vertex's hash.
+*/
+
+  val XPrime = 0x9E3779B1
+
+/**
+Multiplier mixing the bits of the second coordinate into a vertex's hash.
+*/
+
+  val YPrime = 0x85EBCA77
+
+/**
+Multiplier mixing the bits of the third coordinate into a vertex's hash.
+*/
+
+  val ZPrime = 0xC2B2AE3D
+
+/**
+Shift mixing the high-order bits of a vertex's hash into its low-order bits.
+*/
+
+  val MixShift = 16
+
+/**
+Create an array of empty hash table slots.
+
+@param size Number of slots.
+
+@return Array of empty slots.
+*/
+  def emptySlots(size: Int) = {
+    val slots = new Array[Int](size)
+    Arrays.fill(slots, Empty)
+    slots
+  }
+}
@@ -0,0 +1,425 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim.cell package.
+*/
+
+package org.facsim.anim.cell
+
+import java.io.{ByteArrayInputStream, ByteArrayOutputStream, DataOutput,
+DataOutputStream, InputStream, InputStreamReader, IOException}
+import java.net.URL
+import java.nio.{BufferUnderflowException, ByteBuffer}
+import java.nio.channels.FileChannel
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Files, Path, Paths, StandardCopyOption,
+StandardOpenOption}
+import java.security.MessageDigest
+import org.facsim.assertNonNull
+import org.facsim.io.TextReader
+import scala.annotation.tailrec
+
+/**
+Cache of compiled ''[[http://www.automod.com/ AutoMod®]] cell'' files.
+
+Parsing a large ''cell'' file can take a significant amount of time. To avoid
+re-parsing a ''cell'' file each time it is loaded, the sequence of fields read
+from the file can be stored in a compact, binary ''compiled'' form. When the
+same file is subsequently loaded, the compiled file is memory-mapped and its
+fields are replayed, without any text scanning or number parsing, to construct
+the scene.
+
+=Compiled File Format=
+
+A compiled file comprises a header, followed by the compiled fields. The header
+contains, in order:
+  - a magic number identifying the file as a compiled ''cell'' file;
+  - the version of the compiled file format;
+  - the length and contents of the ''SHA-256'' hash of the source ''cell''
+    file's contents;
+  - the URL of the source ''cell'' file, as a string field.
+
+Each field is written as a single byte tag, identifying the type of field,
+followed by its value: integers are written as 4 bytes, doubles as 8 bytes and
+strings and text as a 4 byte length, followed by 2 bytes per character. All
+values are big-endian.
+
+=Staleness=
+
+A compiled file is keyed by both the URL and the contents of its source ''cell''
+file. If either does not match, or if the compiled fields do not correspond to
+the scene that they construct, then the compiled file is regarded as stale, and
+is transparently rebuilt from the source ''cell'' file.
+
+Compiled files are an optimization only: if a compiled file cannot be written,
+then the scene is simply loaded from its source ''cell'' file.
+
+@note Compiled files store the fields from which each cell is constructed,
+rather than the resulting scene graph, so the cells are still constructed from
+the replayed fields.
+*/
+
+private[cell] object CellCache {
+
+/**
+File name suffix of compiled ''cell'' files.
+*/
+
+  val Suffix = ".cellc"
+
+/**
+Magic number identifying compiled ''cell'' files.
+*/
+
+  private val Magic = 0x46434C43
+
+/**
+Version of the compiled file format.
+
+This value must be changed whenever the format changes, so that compiled files
+written in an earlier format are rebuilt.
+*/
+
+  private val Version = 1
+
+/**
+Name of the algorithm used to hash source ''cell'' files' contents.
+*/
+
+  private val HashAlgorithm = "SHA-256"
+
+/**
+Size, in bytes, of the blocks in which source ''cell'' files are read.
+*/
+
+  private val BlockSize = 65536
+
+/**
+Tag identifying a compiled text field.
+*/
+
+  private[cell] val TextTag = 1
+
+/**
+Tag identifying a compiled string field.
+*/
+
+  private[cell] val StringTag = 2
+
+/**
+Tag identifying a compiled integer field.
+*/
+
+  private[cell] val IntTag = 3
+
+/**
+Tag identifying a compiled double field.
+*/
+
+  private[cell] val DoubleTag = 4
+
+/**
+Exception indicating that a compiled ''cell'' file is stale, and must be
+rebuilt.
+
+This exception never escapes from this object.
+*/
+
+  private[cell] final class StaleException extends RuntimeException
+
+/**
+Write a compiled string or text field.
+
+@param out Output to which the field is written.
+
+@param tag Tag identifying the type of field.
+
+@param value Value of the field.
+*/
+  private[cell] def writeString(out: DataOutput, tag: Int, value: String) = {
+    out.writeByte(tag)
+    out.writeInt(value.length)
+    out.writeChars(value)
+  }
+
+/**
+Load a scene, replaying a compiled ''cell'' file if it is current, and building
+it otherwise.
+
+@param url URL of the source ''cell'' file.
+
+@param cacheDir Directory in which the compiled file is stored. If `None`, the
+compiled file is stored beside the source ''cell'' file, which must then have a
+`file` URL; otherwise, the scene is loaded from the source file without a
+compiled file.
+
+@param build Function constructing the scene from the specified field source.
+
+@return Scene constructed.
+
+@throws java.io.FileNotFoundException if `url` could not be found, or if it
+could not be opened due to file access restrictions.
+
+@throws org.facsim.anim.cell.IncorrectFormatException if the file supplied is
+not an ''AutoMod® cell'' file.
+
+@throws org.facsim.anim.cell.ParsingErrorException if errors are encountered
+during parsing of the file.
+*/
+  private[cell] def load(url: URL, cacheDir: Option[Path],
+  build: CellFields => CellScene) = {
+
+/*
+Sanity checks.
+*/
+
+    assertNonNull(url)
+    assertNonNull(cacheDir)
+    assertNonNull(build)
+
+/*
+Read the source file, and hash its contents. Reading and hashing are far less
+expensive than parsing the file's contents.
+*/
+
+    val source = readSource(url)
+    val hash = MessageDigest.getInstance(HashAlgorithm).digest(source)
+
+/*
+Helper function to build a scene by parsing the source file, optionally
+recording its fields.
+
+Note that the cell file's encoding is Windows-1252.
+*/
+
+    def parse(recorder: Option[DataOutput]) = {
+      val reader = new TextReader(new InputStreamReader(new
+      ByteArrayInputStream(source), "windows-1252"))
+      build(new TextCellFields(reader, recorder))
+    }
+
+/*
+If the scene has a current compiled file, replay it. Otherwise, parse the
+source file, recording its fields and storing them in a new compiled file.
+*/
+
+    compiledFile(url, cacheDir) match {
+      case Some(file) => replay(file, url, hash, build).getOrElse {
+        val bytes = new ByteArrayOutputStream
+        val out = new DataOutputStream(bytes)
+        out.writeInt(Magic)
+        out.writeInt(Version)
+        out.writeInt(hash.length)
+        out.write(hash)
+        writeString(out, StringTag, url.toString)
+        val scene = parse(Some(out))
+        out.flush()
+        store(file, bytes.toByteArray)
+        scene
+      }
+      case None => parse(None)
+    }
+  }
+
+/**
+Determine the location of the compiled file for a source ''cell'' file.
+
+@param url URL of the source ''cell'' file.
+
+@param cacheDir Directory in which compiled files are stored, if any.
+
+@return Path of the compiled file, or `None` if the source file cannot have a
+compiled file.
+*/
+  private[cell] def compiledFile(url: URL, cacheDir: Option[Path]) =
+  cacheDir match {
+
+/*
+Within a cache directory, compiled files are named after the hash of their
+source file's URL, so that source files with the same name, at different
+locations, have different compiled files.
+*/
+
+    case Some(dir) => {
+      val key = MessageDigest.getInstance(HashAlgorithm).digest(
+      url.toString.getBytes(StandardCharsets.UTF_8))
+      Some(dir.resolve(key.map("%02x".format(_)).mkString + Suffix))
+    }
+
+/*
+Otherwise, compiled files are stored beside their source file, which is only
+possible for local files.
+*/
+
+    case None => {
+      if(url.getProtocol == "file") {
+        val path = Paths.get(url.toURI)
+        Some(path.resolveSibling(path.getFileName.toString + Suffix))
+      }
+      else None
+    }
+  }
+
+/**
+Read the entire contents of a source ''cell'' file.
+
+@param url URL of the source ''cell'' file.
+
+@return Contents of the file.
+*/
+  private def readSource(url: URL) = {
+    val in = url.openStream()
+    try {
+      val out = new ByteArrayOutputStream
+      val block = new Array[Byte](BlockSize)
+      @tailrec
+      def copy(in: InputStream): Unit = {
+        val count = in.read(block)
+        if(count >= 0) {
+          out.write(block, 0, count)
+          copy(in)
+        }
+      }
+      copy(in)
+      out.toByteArray
+    }
+    finally {
+      in.close()
+    }
+  }
+
+/**
+Replay a compiled ''cell'' file, if it exists and is current.
+
+@param file Path of the compiled file.
+
+@param url URL of the source ''cell'' file.
+
+@param hash Hash of the source ''cell'' file's contents.
+
+@param build Function constructing the scene from the specified field source.
+
+@return Scene constructed from the compiled file, or `None` if the compiled file
+does not exist or is stale.
+*/
+  private def replay(file: Path, url: URL, hash: Array[Byte],
+  build: CellFields => CellScene) = {
+
+/*
+Map the compiled file into memory. The mapping remains valid after the channel
+is closed.
+*/
+
+    val buffer = try {
+      if(Files.isRegularFile(file)) {
+        val channel = FileChannel.open(file, StandardOpenOption.READ)
+        try {
+          Some(channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size))
+        }
+        finally {
+          channel.close()
+        }
+      }
+      else None
+    }
+    catch {
+      case _: IOException => None
+    }
+
+/*
+Verify the header and, if the compiled file is current, replay its fields. If
+any fields remain once the scene has been constructed, then the compiled file
+does not match the scene either.
+*/
+
+    buffer.flatMap {
+      b =>
+      try {
+        val fields = new CompiledCellFields(b)
+        if(b.getInt() != Magic || b.getInt() != Version ||
+        !matches(b, hash)) throw new StaleException
+        val _ = fields.readString(_ == url.toString)
+        val scene = build(fields)
+        if(b.hasRemaining) throw new StaleException
+        Some(scene)
+      }
+      catch {
+        case _: StaleException | _: BufferUnderflowException => None
+      }
+    }
+  }
+
+/**
+Determine whether the hash stored in a compiled file's header matches the
+specified hash.
+
+@param buffer Buffer positioned at the stored hash.
+
+@param hash Hash of the source ''cell'' file's contents.
+
+@return `true` if the stored hash matches; `false` otherwise.
+*/
+  private def matches(buffer: ByteBuffer, hash: Array[Byte]) =
+  buffer.getInt() == hash.length && {
+    val stored = new Array[Byte](hash.length)
+    val _ = buffer.get(stored)
+    MessageDigest.isEqual(stored, hash)
+  }
+
+/**
+Store a compiled ''cell'' file.
+
+The file is first written to a temporary file, which then replaces any existing
+compiled file, so that a partially-written compiled file is never replayed. If
+the compiled file cannot be stored, it is silently discarded.
+
+@param file Path of the compiled file.
+
+@param contents Contents of the compiled file.
+*/
+  private def store(file: Path, contents: Array[Byte]): Unit = {
+    val dir = file.toAbsolutePath.getParent
+    try {
+      val _ = Files.createDirectories(dir)
+      val temp = Files.createTempFile(dir, file.getFileName.toString, ".tmp")
+      try {
+        val _ = Files.write(temp, contents)
+        val _ = Files.move(temp, file, StandardCopyOption.REPLACE_EXISTING,
+        StandardCopyOption.ATOMIC_MOVE)
+      }
+      finally {
+        val _ = Files.deleteIfExists(temp)
+      }
+    }
+    catch {
+      case _: IOException | _: SecurityException =>
+    }
+  }
+}
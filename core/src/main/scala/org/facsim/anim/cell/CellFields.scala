@@ -0,0 +1,117 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim.cell package.
+*/
+
+package org.facsim.anim.cell
+
+import org.facsim.io.TextReader
+
+/**
+Source of the fields making up an ''[[http://www.automod.com/ AutoMod®]]
+cell'' scene.
+
+A [[org.facsim.anim.cell.CellScene!]] reads its cells' data, field by field,
+from a field source. Fields may be parsed from ''cell'' file text, or replayed
+from a previously compiled binary representation of the same file.
+
+@see [[org.facsim.anim.cell.CellCache$]] for further information on compiled
+''cell'' files.
+*/
+
+private[cell] trait CellFields {
+
+/**
+Read the remainder of the current line as a single text field.
+
+@param verifier Field verification function, used to verify value of field read
+before it is returned.
+
+@return Text read.
+
+@throws java.io.IOException if an error occurs while reading the field.
+
+@throws org.facsim.io.FieldVerificationException if the text read is not
+verified by `verifier`.
+*/
+  def readText(verifier: TextReader.Verifier[String]): String
+
+/**
+Read a string field.
+
+@param verifier Field verification function, used to verify value of field read
+before it is returned.
+
+@return String read.
+
+@throws java.io.IOException if an error occurs while reading the field.
+
+@throws org.facsim.io.FieldVerificationException if the string read is not
+verified by `verifier`.
+*/
+  def readString(verifier: TextReader.Verifier[String]): String
+
+/**
+Read an integer field.
+
+@param verifier Field verification function, used to verify value of field read
+before it is returned.
+
+@return Integer read.
+
+@throws java.io.IOException if an error occurs while reading the field.
+
+@throws org.facsim.io.FieldConversionException if the field read is not an
+integer value.
+
+@throws org.facsim.io.FieldVerificationException if the integer read is not
+verified by `verifier`.
+*/
+  def readInt(verifier: TextReader.Verifier[Int]): Int
+
+/**
+Read a double field.
+
+@param verifier Field verification function, used to verify value of field read
+before it is returned.
+
+@return Double read.
+
+@throws java.io.IOException if an error occurs while reading the field.
+
+@throws org.facsim.io.FieldConversionException if the field read is not a
+real value.
+
+@throws org.facsim.io.FieldVerificationException if the double read is not
+verified by `verifier`.
+*/
+  def readDouble(verifier: TextReader.Verifier[Double]): Double
+}
@@ -35,8 +35,14 @@ package org.facsim.anim.cell
 
 import java.io.InputStreamReader
 import java.net.URL
-import org.facsim.requireNonNull
+import java.nio.file.Path
+import java.util.concurrent.ForkJoinPool
+import org.facsim.anim.LevelOfDetail
+import org.facsim.{requireNonNull, requireValid}
 import org.facsim.io.TextReader
+import scala.concurrent.{Await, ExecutionContext, Future}
+import scala.concurrent.duration.Duration
+import scala.util.Try
 import scalafx.scene.Node
 
 /**
@@ -128,6 +134,11 @@ value cannot be `null`.
 elements in the scene that inherit their edge color from the root node. This
 value cannot be `null`.
 
+@param levelOfDetail Optional level-of-detail policy determining the number of
+divisions of curved primitives (such as cylinders and cones) from their expected
+on-screen size. If `None`, then each type of curved primitive has a fixed
+number of divisions.
+
 @return ''ScalaFX'' [[scalafx.scene.Node!]] containing the ''cell's'' contents.
 
 @throws NullPointerException if `url`, `faceColor` or `edgeColor` are
@@ -150,7 +161,8 @@ during parsing of the file.
 */
   def load(url: URL, baseUrl: Option[URL] = None,
   faceColor: CellColor.Value = CellColor.Default,
-  edgeColor: CellColor.Value = CellColor.Default): Node = {
+  edgeColor: CellColor.Value = CellColor.Default,
+  levelOfDetail: Option[LevelOfDetail] = None): Node = {
 
 /*
 Verify that certain arguments are not null.
@@ -160,16 +172,7 @@ Verify that certain arguments are not null.
     requireNonNull(baseUrl)
     requireNonNull(faceColor)
     requireNonNull(edgeColor)
-
-/*
-Helper function to retrieve the absolute path of the file, so that we can
-identify the base URL if one is not defined.
-*/
-
-    def getSearchLocation = {
-      val urlString = url.toString
-      new URL(urlString.take(urlString.lastIndexOf('/')))
-    }
+    requireNonNull(levelOfDetail)
 
 /*
 Create the text reader for this file.
@@ -185,22 +188,258 @@ Note that the cell file's encoding is Windows-1252.
     "windows-1252"))
 
 /*
-Determine where we'll search for files referenced in the cell data.
+Create a cell scene instance, populate it from the reader, and return its
+contents as a ScalaFX node.
 */
 
-    val searchLocation = baseUrl.getOrElse(getSearchLocation)
+    new CellScene(new TextCellFields(reader, None), searchLocation(url,
+    baseUrl), faceColor, edgeColor, levelOfDetail).toNode
+  } ensuring(_ ne null)
+
+/**
+Load the ''[[http://www.automod.com/ AutoMod®]] cell'' file from the specified
+URL, using a compiled version of the file if available, and return it as a
+''ScalaFX 3D Parent'' node.
+
+The first time that a ''cell'' file is loaded by this function, the fields
+parsed from the file are stored in a compact, binary ''compiled'' file.
+Subsequent loads of the same ''cell'' file memory-map the compiled file and
+construct the scene from it, without re-parsing the ''cell'' file's text.
+
+Compiled files are keyed by the URL and the contents of their ''cell'' file. If
+the ''cell'' file is modified, its compiled file is detected as stale and is
+transparently rebuilt. If a compiled file cannot be written, then the scene is
+loaded as if by [[org.facsim.anim.cell.CellLoader.load]].
+
+@note If a base URL is specified, then any files referenced by the cell data
+will be searched for relative to that URL; otherwise, files should be present
+at the same location as the named file. Refer to
+[[org.facsim.anim.cell.CellLoader]] for further information.
+
+@param url URL of file from which cell data is to be read.
+
+@param cacheDir Optional directory in which compiled files are to be stored. If
+`None`, then the compiled file is stored beside the ''cell'' file, with the
+suffix ".cellc" appended to its name; in this case, compiled files are only
+used for ''cell'' files with `file` URLs.
+
+@param baseUrl Optional base URL identifying the location relative to which any
+referenced files should be located. If `None`, then referenced files should be
+located relative to the processed ''cell'' file's location.
+
+@param faceColor Face color (as a material) to be assigned to all ''cell''
+elements in the scene that inherit their face color from the root node. This
+value cannot be `null`.
+
+@param edgeColor Edge color (as a material) to be assigned to all ''cell''
+elements in the scene that inherit their edge color from the root node. This
+value cannot be `null`.
+
+@param levelOfDetail Optional level-of-detail policy determining the number of
+divisions of curved primitives (such as cylinders and cones) from their expected
+on-screen size. If `None`, then each type of curved primitive has a fixed
+number of divisions.
+
+@return ''ScalaFX'' [[scalafx.scene.Node!]] containing the ''cell's'' contents.
+
+@throws NullPointerException if `url`, `cacheDir`, `faceColor` or `edgeColor`
+are `null`.
+
+@throws java.lang.SecurityException if `url` is protected from reading by
+Java's security mechanism.
+
+@throws java.io.FileNotFoundException if `url` could not be found, or if it
+could not be opened due to file access restrictions (such as the current user
+having insufficient privileges to read the file, etc.).
+
+@throws org.facsim.anim.cell.IncorrectFormatException if the file supplied is
+not an ''AutoMod® cell'' file.
+
+@throws org.facsim.anim.cell.ParsingErrorException if errors are encountered
+during parsing of the file.
+
+@since 0.3
+*/
+  def loadCompiled(url: URL, cacheDir: Option[Path] = None,
+  baseUrl: Option[URL] = None, faceColor: CellColor.Value = CellColor.Default,
+  edgeColor: CellColor.Value = CellColor.Default,
+  levelOfDetail: Option[LevelOfDetail] = None): Node = {
 
 /*
-Create a cell scene instance and populate it from the reader.
+Verify that certain arguments are not null.
 */
 
-    val cellScene = new CellScene(reader, searchLocation, faceColor,
-    edgeColor)
+    requireNonNull(url)
+    requireNonNull(cacheDir)
+    requireNonNull(baseUrl)
+    requireNonNull(faceColor)
+    requireNonNull(edgeColor)
+    requireNonNull(levelOfDetail)
 
 /*
-Return the cell's contents as a ScalaFX node.
+Create the scene from the compiled file if it is current, or from the cell file
+otherwise, and return its contents as a ScalaFX node.
 */
 
-    cellScene.toNode
+    val location = searchLocation(url, baseUrl)
+    CellCache.load(url, cacheDir, new CellScene(_, location, faceColor,
+    edgeColor, levelOfDetail)).toNode
   } ensuring(_ ne null)
-}
\ No newline at end of file
+
+/**
+Load a number of ''[[http://www.automod.com/ AutoMod®]] cell'' files
+concurrently and return them as ''ScalaFX 3D Parent'' nodes.
+
+Each distinct file is fetched and parsed exactly once, on a pool with a bounded
+number of threads, so that the latency of fetching files from remote locations
+(such as network shares) is overlapped. ''ScalaFX'' nodes are then assembled on
+the calling thread, in the order of the specified URLs. Files that appear more
+than once in the list are parsed once, but each appearance receives its own
+node.
+
+The results are identical to loading each file, in order, by
+[[org.facsim.anim.cell.CellLoader.load]]. In particular, if any file cannot be
+loaded, then the exception reported is that of the first such file in the list,
+regardless of the order in which the files were parsed.
+
+@param urls URLs of files from which cell data is to be read.
+
+@param threads Maximum number of threads used to fetch and parse files. This
+value must be positive.
+
+@param baseUrl Optional base URL identifying the location relative to which any
+referenced files should be located. If `None`, then referenced files should be
+located relative to each processed ''cell'' file's location.
+
+@param faceColor Face color (as a material) to be assigned to all ''cell''
+elements in each scene that inherit their face color from the root node. This
+value cannot be `null`.
+
+@param edgeColor Edge color (as a material) to be assigned to all ''cell''
+elements in each scene that inherit their edge color from the root node. This
+value cannot be `null`.
+
+@param levelOfDetail Optional level-of-detail policy determining the number of
+divisions of curved primitives (such as cylinders and cones) from their expected
+on-screen size. If `None`, then each type of curved primitive has a fixed
+number of divisions.
+
+@return ''ScalaFX'' [[scalafx.scene.Node!]]s containing each ''cell's''
+contents, in the same order as `urls`.
+
+@throws NullPointerException if `urls`, any of its elements, `baseUrl`,
+`faceColor` or `edgeColor` are `null`.
+
+@throws IllegalArgumentException if `threads` is not positive.
+
+@throws java.lang.SecurityException if a URL is protected from reading by
+Java's security mechanism.
+
+@throws java.io.FileNotFoundException if a URL could not be found, or if it
+could not be opened due to file access restrictions (such as the current user
+having insufficient privileges to read the file, etc.).
+
+@throws org.facsim.anim.cell.IncorrectFormatException if a file supplied is not
+an ''AutoMod® cell'' file.
+
+@throws org.facsim.anim.cell.ParsingErrorException if errors are encountered
+during parsing of a file.
+
+@since 0.3
+*/
+  def loadAll(urls: Seq[URL], threads: Int =
+  Runtime.getRuntime.availableProcessors, baseUrl: Option[URL] = None,
+  faceColor: CellColor.Value = CellColor.Default,
+  edgeColor: CellColor.Value = CellColor.Default,
+  levelOfDetail: Option[LevelOfDetail] = None): List[Node] = {
+
+/*
+Verify the arguments.
+*/
+
+    requireNonNull(urls)
+    urls.foreach(url => requireNonNull(url))
+    requireValid(threads, threads > 0)
+    requireNonNull(baseUrl)
+    requireNonNull(faceColor)
+    requireNonNull(edgeColor)
+    requireNonNull(levelOfDetail)
+
+/*
+Identify the distinct files to be loaded. Note that URLs are compared as
+strings, since URL equality may require host names to be resolved.
+*/
+
+    val distinct = urls.map(_.toString).distinct
+    if(distinct.isEmpty) Nil
+    else {
+
+/*
+Fetch and parse each distinct file in parallel, capturing the outcome of each.
+Parsing a scene does not create any ScalaFX nodes, so it is safe to do so off
+the calling thread. There is no benefit in having more threads than files.
+*/
+
+      val pool = new ForkJoinPool(Math.min(threads, distinct.size))
+      val scenes = try {
+        implicit val ec: ExecutionContext =
+        ExecutionContext.fromExecutorService(pool)
+        val pending = distinct.map {
+          urlString =>
+          urlString -> Future {
+            Try {
+              val url = new URL(urlString)
+
+/*
+The scene is read in full by its constructor, after which the stream must be
+closed, so that no file handle is leaked for each cell file.
+*/
+
+              val stream = url.openStream()
+              try {
+                val reader = new TextReader(new InputStreamReader(stream,
+                "windows-1252"))
+                new CellScene(new TextCellFields(reader, None),
+                searchLocation(url, baseUrl), faceColor, edgeColor,
+                levelOfDetail)
+              }
+              finally {
+                stream.close()
+              }
+            }
+          }
+        }
+        pending.map {
+          case (urlString, scene) => urlString -> Await.result(scene,
+          Duration.Inf)
+        }.toMap
+      }
+      finally {
+        pool.shutdown()
+      }
+
+/*
+Assemble the nodes on the calling thread, in the order requested, re-throwing
+the exception of the first file that could not be loaded.
+*/
+
+      urls.map(url => scenes(url.toString).get.toNode).toList
+    }
+  }
+
+/**
+Determine where files referenced in the cell data will be searched.
+
+@param url URL of file from which cell data is to be read.
+
+@param baseUrl Optional base URL identifying the location relative to which any
+referenced files should be located.
+
+@return `baseUrl`, if defined; otherwise, the location of the ''cell'' file.
+*/
+  private def searchLocation(url: URL, baseUrl: Option[URL]) =
+  baseUrl.getOrElse {
+    val urlString = url.toString
+    new URL(urlString.take(urlString.lastIndexOf('/')))
+  }
+}
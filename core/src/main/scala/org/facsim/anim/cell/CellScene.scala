@@ -34,9 +34,9 @@ Scala source file from the org.facsim.anim.cell package.
 package org.facsim.anim.cell
 
 import java.io.IOException
-import java.lang.reflect.InvocationTargetException
 import java.net.URL
 import org.facsim.{assertNonNull, LibResource}
+import org.facsim.anim.LevelOfDetail
 import org.facsim.io.{FieldConversionException, FieldVerificationException,
 TextReader}
 import scala.collection.mutable.{Map => MutableMap}
@@ -45,11 +45,12 @@ import scala.collection.mutable.{Map => MutableMap}
 ''Java3D'' scene retrieved from an ''[[http://www.automod.com/ AutoMod®]]
 cell'' file.
 
-@constructor Create a new scene with the indicated reader and default
+@constructor Create a new scene with the indicated field source and default
 information.
 
-@param reader Text reader that assists with processing the ''cell'' file's
-contents.
+@param fields Source of the fields making up the ''cell'' file's contents.
+Fields may be parsed from the ''cell'' file's text, or replayed from a compiled
+''cell'' file.
 
 @param baseUrl Location at which, or relative to which, files referenced within
 ''cell'' files that have non-absolute paths, will be searched.
@@ -62,6 +63,10 @@ scene that inherit their face color from the root node. This value cannot be
 scene that inherit their edge color from the root node. This value cannot be
 `null`.
 
+@param levelOfDetail Level-of-detail policy determining the number of divisions
+of curved primitives in this scene. If `None`, then each type of curved
+primitive has a fixed number of divisions.
+
 @throws org.facsim.anim.cell.IncorrectFormatException if the file supplied is
 not an ''AutoMod® cell'' file.
 
@@ -69,17 +74,19 @@ not an ''AutoMod® cell'' file.
 during parsing of the file.
 */
 
-private[cell] final class CellScene(reader: TextReader, baseUrl: URL,
-faceColor: CellColor.Value, edgeColor: CellColor.Value) {
+private[cell] final class CellScene(fields: CellFields, baseUrl: URL,
+faceColor: CellColor.Value, edgeColor: CellColor.Value,
+levelOfDetail: Option[LevelOfDetail] = None) {
 
 /*
 Sanity checks.
 */
 
-  assertNonNull(reader)
+  assertNonNull(fields)
   assertNonNull(baseUrl)
   assertNonNull(faceColor)
   assertNonNull(edgeColor)
+  assertNonNull(levelOfDetail)
 
 /**
 Flag indicating whether we have finished constructing the scene.
@@ -132,6 +139,19 @@ Report the default edge color for this scene.
 */
   private[cell] def defaultEdgeColor = Some(edgeColor)
 
+/**
+Determine the number of divisions of a curved primitive in this scene.
+
+@param radius Radius of the primitive's largest circumference.
+
+@param default Number of divisions of the primitive if this scene has no
+level-of-detail policy.
+
+@return Number of divisions of the primitive.
+*/
+  private[cell] def divisions(radius: Double, default: Int) =
+  levelOfDetail.fold(default)(_.divisions(radius))
+
 /**
 Return the scene read as a ''ScalaFX'' 3D scene graph.
 
@@ -172,47 +192,15 @@ Determine the code of the next cell element in the file.
 */
 
     val cellCode = readInt(CellScene.verifyCellCode(isDefinition),
-    LibResource("anim.cell.CellScene.readNextCell.cellCodeDesc",
-    if(isDefinition) 1 else 0, CellScene.permittedCellCodes(isDefinition)))
+    CellScene.cellCodeDescription(isDefinition))
 
 /*
-Retrieve the cell class associated with the indicated cell code.
+Create the new cell instance, using the factory associated with the indicated
+cell code.  Any exception thrown while constructing the cell is passed back to
+the caller.
 */
 
-    val cellClass = CellScene.getCellClass(isDefinition, cellCode)
-
-/*
-Determine the constructor for this cell, and invoke it with the appropriate
-arguments.
-
-This will fail with an exception if a constructor taking the appropriate
-arguments cannot be found. Needless to say, this shouldn't happen if the
-associated class has been supplied with such a constructor.
-*/
-
-    val classCtor = cellClass.getConstructor(getClass, classOf[Option[Set]])
-
-/*
-Create the new cell instance and return it, or review the exceptions thrown.
-*/
-
-    val cell = try {
-      classCtor.newInstance(this, parent)
-    }
-    catch {
-
-/*
-If there is an invocation target exception (that is, if the constructor throws
-an exception while executing), then recover the thrown exception and rethrow
-it. All other exceptions are passed back to the caller.
-*/
-
-      case e: InvocationTargetException => {
-        val cause = e.getCause
-        assert(cause != null)
-        throw cause
-      }
-    }
+    val cell = CellScene.getCellFactory(isDefinition, cellCode)(this, parent)
 
 /*
 If this is a definition, then add it to the list of definitions.
@@ -273,7 +261,7 @@ appropriate exception if necessary.
 */
 
     val value = try {
-      reader.readToEOL()
+      fields.readText(TextReader.defaultStringVerifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -326,7 +314,7 @@ necessary.
 */
 
     val value = try {
-      reader.readString()
+      fields.readString(TextReader.defaultStringVerifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -375,7 +363,7 @@ exception if necessary.
 */
 
     val value = try {
-      reader.readString(verifier)
+      fields.readString(verifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -419,7 +407,7 @@ necessary.
 */
 
     val value = try {
-      reader.readInt(value => value == 0 || value == 1)
+      fields.readInt(value => value == 0 || value == 1)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -468,7 +456,7 @@ exception if necessary.
 */
 
     val value = try {
-      reader.readInt(value =>(value == 0 || value == 1) && verifier(value))
+      fields.readInt(value =>(value == 0 || value == 1) && verifier(value))
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -512,7 +500,7 @@ necessary.
 */
 
     val value = try {
-      reader.readInt()
+      fields.readInt(TextReader.defaultIntVerifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -561,7 +549,7 @@ exception if necessary.
 */
 
     val value = try {
-      reader.readInt(verifier)
+      fields.readInt(verifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -605,7 +593,7 @@ necessary.
 */
 
     val value = try {
-      reader.readDouble()
+      fields.readDouble(TextReader.defaultDoubleVerifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -654,7 +642,7 @@ exception if necessary.
 */
 
     val value = try {
-      reader.readDouble(verifier)
+      fields.readDouble(verifier)
     }
     catch {
       case e: Throwable => CellScene.translateReaderException(e, description)
@@ -683,125 +671,96 @@ CellScene companion object.
 private[cell] object CellScene {
 
 /**
-Type representing class information for a sub-class of
-[[org.facsim.anim.cell.Cell!]].
-*/
-
-  type CellClass = Class[_ <: Cell]
+Type of functions that construct a sub-class of [[org.facsim.anim.cell.Cell!]].
 
-/**
-Map linking definition state (true = definition cell, false = regular cell) to
-a map linking cell code to cell class.
+Each function takes the scene to which the cell belongs, and the set primitive
+(if any) that is to contain the cell, and reads the cell's data from the
+scene's field source.
 */
 
-  private[this] val partitionedClassMap = partitionClassMap
+  type CellFactory = (CellScene, Option[Set]) => Cell
 
 /**
-Function to initialize the relation between definition/regular cell status and
-maps of cell code to cell class.
+Map associating cell type code with the factory for the corresponding
+''regular'' cell class.
 
 Regular cell elements (sets, tetrahedra, vector lists, instances, etc.) can
-appear in the normal tree of elements. However, definition cell elements can
-only appear at the root of a definition&mdash;they are then included in the
-scene via reference (by an instance cell element).
-
-Because of the different places in which these two different types of cell are
-defined, it makes sense to utilize two different ''cell code to cell class''
-maps, one for regular cell elements and the other for definition cell elements.
-
-This function starts with a map of cell codes to cell classes, and then
-partitions it into two maps, one for definition cells and the other for regular
-cells.
+appear in the normal tree of elements.
 
-@return Map relating cell definition state (`true` = definition cell, `false` =
-regular cell) to a map that relates cell codes to cell classes.
-
-@see [[http://facsim.org/Documentation/Resources/AutoModCellFile/Type.html
-AutoMod Cell Type Codes]]
-*/
-  private[this] def partitionClassMap = {
-
-/*
-Map associating cell type code with corresponding ''regular'' cell class.
-
-All classes contained in his map must be concrete classes and must provide a
-constructor taking CellScene reference and an Option [Set] arguments.
+Cells are constructed by calling these factories directly, rather than by
+looking up and invoking each cell class's constructor by reflection, so that
+reading a cell involves no reflective lookup or invocation.
 
 @note This map is defined in order of the cell codes for ease of maintenance by
 a human (the resulting map itself is not ordered by cell code). Please maintain
 this order when modifying the list.
-*/
 
-    val classMap = MutableMap[Int, CellClass](
-      100 -> classOf[Triad],
-      115 -> classOf[VectorList],
-      125 -> classOf[Polyhedron],
-      130 -> classOf[Arc],                   // Originally, coarse arc
-      131 -> classOf[Arc],                   // Originally, fine arc
-      140 -> classOf[WorldText],
-      141 -> classOf[ScreenText],
-      142 -> classOf[ScreenText],
-      143 -> classOf[UnrotateText],
-      144 -> classOf[UnrotateText],
-      150 -> classOf[WorldTextList],
-      151 -> classOf[ScreenTextList],
-      152 -> classOf[ScreenTextList],
-      153 -> classOf[UnrotateTextList],
-      154 -> classOf[UnrotateTextList],
-      308 -> classOf[BlockDefinition],
-      310 -> classOf[Trapezoid],
-      311 -> classOf[Tetrahedron],
-      315 -> classOf[Rectangle],
-      330 -> classOf[Hemisphere],            // Originally, coarse hemisphere
-      331 -> classOf[Hemisphere],            // Originally, fine hemisphere
-      340 -> classOf[Cone],                  // Originally, coarse cone
-      341 -> classOf[Cone],                  // Originally, fine cone
-      350 -> classOf[Cylinder],              // Originally, coarse cylinder
-      351 -> classOf[Cylinder],              // Originally, fine cylinder
-      360 -> classOf[ConicFrustum],          // Originally, coarse frustum
-      361 -> classOf[ConicFrustum],          // Originally, fine frustum
-      388 -> classOf[FileReference],
-      408 -> classOf[Instance],
-      555 -> classOf[CompiledPicture],
-      599 -> classOf[EmbeddedFile],
-      700 -> classOf[RegularSet],
-      7000 -> classOf[RegularSet],
-      10000 -> classOf[RegularSet]
-    )
-
-/*
-Class of the Definition cell type.
-
-All sub-classes of the Definition trait are regarded as special cases: they can
-only be defined as a definition, and not as part of the primary cell scene.
+@see [[http://facsim.org/Documentation/Resources/AutoModCellFile/Type.html
+AutoMod Cell Type Codes]]
 */
 
-    val definition = classOf[Definition]
+  private[this] val regularFactories = Map[Int, CellFactory](
+    100 -> (new Triad(_, _)),
+    115 -> (new VectorList(_, _)),
+    125 -> (new Polyhedron(_, _)),
+    130 -> (new Arc(_, _)),                   // Originally, coarse arc
+    131 -> (new Arc(_, _)),                   // Originally, fine arc
+    140 -> (new WorldText(_, _)),
+    141 -> (new ScreenText(_, _)),
+    142 -> (new ScreenText(_, _)),
+    143 -> (new UnrotateText(_, _)),
+    144 -> (new UnrotateText(_, _)),
+    150 -> (new WorldTextList(_, _)),
+    151 -> (new ScreenTextList(_, _)),
+    152 -> (new ScreenTextList(_, _)),
+    153 -> (new UnrotateTextList(_, _)),
+    154 -> (new UnrotateTextList(_, _)),
+    310 -> (new Trapezoid(_, _)),
+    311 -> (new Tetrahedron(_, _)),
+    315 -> (new Rectangle(_, _)),
+    330 -> (new Hemisphere(_, _)),            // Originally, coarse hemisphere
+    331 -> (new Hemisphere(_, _)),            // Originally, fine hemisphere
+    340 -> (new Cone(_, _)),                  // Originally, coarse cone
+    341 -> (new Cone(_, _)),                  // Originally, fine cone
+    350 -> (new Cylinder(_, _)),              // Originally, coarse cylinder
+    351 -> (new Cylinder(_, _)),              // Originally, fine cylinder
+    360 -> (new ConicFrustum(_, _)),          // Originally, coarse frustum
+    361 -> (new ConicFrustum(_, _)),          // Originally, fine frustum
+    408 -> (new Instance(_, _)),
+    555 -> (new CompiledPicture(_, _)),
+    599 -> (new EmbeddedFile(_, _)),
+    700 -> (new RegularSet(_, _)),
+    7000 -> (new RegularSet(_, _)),
+    10000 -> (new RegularSet(_, _))
+  )
 
-/*
-Helper function to determine if a class is a definition sub-class or not.
-*/
+/**
+Map associating cell type code with the factory for the corresponding
+''definition'' cell class.
 
-    def isDefinition(cellClass: CellClass) =
-    definition.isAssignableFrom(cellClass)
+All cell classes in this map implement the
+[[org.facsim.anim.cell.Definition!]] trait: they can only appear at the root of
+a definition&mdash;they are then included in the scene via reference (by an
+instance cell element).
 
-/*
-Partition the map into two: one containing regular cell classes, and the other
-containing definition cell classes.
+@see [[http://facsim.org/Documentation/Resources/AutoModCellFile/Type.html
+AutoMod Cell Type Codes]]
 */
 
-    val(definitionClassMap, regularClassMap) = classMap.partition(p =>
-    isDefinition(p._2))
+  private[this] val definitionFactories = Map[Int, CellFactory](
+    308 -> (new BlockDefinition(_, _)),
+    388 -> (new FileReference(_, _))
+  )
 
-/*
-Now construct, and return, the map relating definition state to class map.
+/**
+Map linking definition state (true = definition cell, false = regular cell) to
+a map linking cell code to cell factory.
 */
 
-    MutableMap[Boolean, MutableMap[Int, CellClass]](
-      true -> definitionClassMap,
-      false -> regularClassMap
-    )
-  }
+  private[this] val partitionedFactoryMap = Map(
+    true -> definitionFactories,
+    false -> regularFactories
+  )
 
 /**
 Function to verify a cell code.
@@ -818,7 +777,7 @@ not a valid expected cell code.
 AutoMod Cell Type Codes]]
 */
   private def verifyCellCode(definitionExpected: Boolean)(cellCode: Int) =
-  partitionedClassMap(definitionExpected).contains(cellCode)
+  partitionedFactoryMap(definitionExpected).contains(cellCode)
 
 /**
 Function to report the set of permitted cell codes.
@@ -836,23 +795,48 @@ cell; if `false`, the cell code must be for a regular cell.
 AutoMod Cell Type Codes]]
 */
   private def permittedCellCodes(definitionExpected: Boolean) =
-  partitionedClassMap(definitionExpected).keys.toList.sorted.mkString(", ")
+  partitionedFactoryMap(definitionExpected).keys.toList.sorted.mkString(", ")
+
+/**
+Descriptions of the cell code field, indexed by definition state.
+
+Descriptions are determined when first required, rather than each time a cell
+is read.
+*/
+
+  private[this] lazy val cellCodeDescriptions = partitionedFactoryMap.map {
+    case (definitionExpected, _) =>
+    definitionExpected -> LibResource(
+    "anim.cell.CellScene.readNextCell.cellCodeDesc",
+    if(definitionExpected) 1 else 0, permittedCellCodes(definitionExpected))
+  }
+
+/**
+Function to report the description of the cell code field.
+
+@param definitionExpected If `true` the cell code read must be for a definition
+cell; if `false`, the cell code must be for a regular cell.
+
+@return Description of the cell code field.
+*/
+  private def cellCodeDescription(definitionExpected: Boolean) =
+  cellCodeDescriptions(definitionExpected)
 
 /**
-Function to lookup the associated cell class for the specified cell code.
+Function to lookup the associated cell factory for the specified cell code.
 
 @param definitionExpected Flag indicating whether we're expecting a definition
 cell (`true`) or a regular cell (`false`).
 
-@param cellCode Integer code for which a cell class is to be looked-up.
+@param cellCode Integer code for which a cell factory is to be looked-up.
 
-@return Class information for the specified cell code.
+@return Factory constructing cells with the specified cell code.
 
 @see [[http://facsim.org/Documentation/Resources/AutoModCellFile/Type.html
 AutoMod Cell Type Codes]]
 */
-  private def getCellClass(definitionExpected: Boolean, cellCode: Int) =
-  partitionedClassMap(definitionExpected)(cellCode)
+  private def getCellFactory(definitionExpected: Boolean, cellCode: Int) =
+  partitionedFactoryMap(definitionExpected)(cellCode)
 
 /**
 Translate a reader exception.
@@ -0,0 +1,133 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim.cell package.
+*/
+
+package org.facsim.anim.cell
+
+import java.nio.{BufferUnderflowException, ByteBuffer}
+import org.facsim.assertNonNull
+import org.facsim.io.TextReader
+
+/**
+Cell field source that replays fields from a compiled ''cell'' file.
+
+Fields are decoded directly from the buffer, which is typically a memory-mapped
+view of a compiled ''cell'' file, without any text scanning or number parsing.
+
+Since the fields were verified when the compiled file was created, a field that
+has an unexpected type, fails verification, or lies beyond the end of the
+buffer indicates that the compiled file does not match the scene being read. In
+this case, a [[org.facsim.anim.cell.CellCache.StaleException!]] is thrown, so
+that the compiled file can be rebuilt from the original ''cell'' file.
+
+@constructor Create a new compiled field source.
+
+@param buffer Buffer, positioned at the first field, from which fields are to
+be decoded.
+*/
+
+private[cell] final class CompiledCellFields(buffer: ByteBuffer)
+extends CellFields {
+
+/*
+Sanity checks.
+*/
+
+  assertNonNull(buffer)
+
+/**
+Decode the next field, which must have the indicated tag, and verify it.
+
+@param tag Tag that the next field must have.
+
+@param decode Function to decode the value of the field.
+
+@param verifier Field verification function.
+
+@return Value of the field.
+
+@throws org.facsim.anim.cell.CellCache.StaleException if the next field does
+not exist, does not have the indicated tag, or fails verification.
+*/
+  private def next[T](tag: Int, decode: => T, verifier: TextReader.Verifier[T])
+  = {
+    val value = try {
+      if(buffer.get() != tag) throw new CellCache.StaleException
+      decode
+    }
+    catch {
+      case _: BufferUnderflowException => throw new CellCache.StaleException
+    }
+    if(!verifier(value)) throw new CellCache.StaleException
+    value
+  }
+
+/**
+Decode a string value from the buffer.
+
+@return String decoded.
+*/
+  private def decodeString = {
+    val length = buffer.getInt()
+    if(length < 0) throw new CellCache.StaleException
+    val chars = new Array[Char](length)
+    buffer.asCharBuffer.get(chars)
+    buffer.position(buffer.position + 2 * length)
+    new String(chars)
+  }
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readText(TextReader.Verifier[String])]]
+*/
+  override def readText(verifier: TextReader.Verifier[String]) =
+  next(CellCache.TextTag, decodeString, verifier)
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readString(TextReader.Verifier[String])
+]]
+*/
+  override def readString(verifier: TextReader.Verifier[String]) =
+  next(CellCache.StringTag, decodeString, verifier)
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readInt(TextReader.Verifier[Int])]]
+*/
+  override def readInt(verifier: TextReader.Verifier[Int]) =
+  next(CellCache.IntTag, buffer.getInt(), verifier)
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readDouble(TextReader.Verifier[Double])
+]]
+*/
+  override def readDouble(verifier: TextReader.Verifier[Double]) =
+  next(CellCache.DoubleTag, buffer.getDouble(), verifier)
+}
@@ -34,7 +34,7 @@ Scala source file from the org.facsim.anim.cell package.
 package org.facsim.anim.cell
 
 import org.facsim.LibResource
-import org.facsim.anim.{Mesh, Point3D}
+import org.facsim.anim.{GeometryCache, Mesh, Point3D}
 
 /**
 Class representing ''[[http://www.automod.com/ AutoMod®]] cell conic frustum''
@@ -107,6 +107,19 @@ ConicFrustum top Y-axis offset.
   private val yOffset = scene.readDouble(LibResource
  (ConicFrustum.ReadOffsetKey, 1))
 
+/**
+Number of divisions around the conic frustum's circumference.
+*/
+
+  private val divisions = scene.divisions(Math.max(baseRadius,
+  topRadius), ConicFrustum.Divisions)
+
+/**
+Flag indicating whether this conic frustum is rendered with shared geometry.
+*/
+
+  private val isShared = baseRadius > 0.0 && height > 0.0
+
 /**
 @inheritdoc
 
@@ -114,7 +127,26 @@ ConicFrustum top Y-axis offset.
 */
   protected[cell] override def cellMesh: Mesh =
   Mesh.conicFrustum(Point3D.Origin, baseRadius,
-  Point3D(xOffset, yOffset, height), topRadius, ConicFrustum.Divisions)
+  Point3D(xOffset, yOffset, height), topRadius, divisions)
+
+/**
+@inheritdoc
+
+@note Conic frustums with positive dimensions are rendered with a shared unit
+mesh.
+*/
+  protected[cell] override def cellTriangleMesh =
+  if(isShared) GeometryCache.conicFrustum(topRadius / baseRadius,
+  divisions)
+  else super.cellTriangleMesh
+
+/**
+@inheritdoc
+*/
+  protected[cell] override def meshTransforms =
+  if(isShared) List(GeometryCache.shape(baseRadius, baseRadius,
+  xOffset, yOffset, height))
+  else Nil
 }
 
 /**
@@ -34,7 +34,7 @@ Scala source file from the org.facsim.anim.cell package.
 package org.facsim.anim.cell
 
 import org.facsim.LibResource
-import org.facsim.anim.{Mesh, Point3D}
+import org.facsim.anim.{GeometryCache, Mesh, Point3D}
 
 /**
 Class representing ''[[http://www.automod.com/ AutoMod®]] cell cylinder''
@@ -95,13 +95,43 @@ Cylinder top Y-axis offset.
   private val yOffset = scene.readDouble(LibResource
  (Cylinder.ReadOffsetKey, 1))
 
+/**
+Number of divisions around the cylinder's circumference.
+*/
+
+  private val divisions = scene.divisions(radius, Cylinder.Divisions)
+
+/**
+Flag indicating whether this cylinder is rendered with shared geometry.
+*/
+
+  private val isShared = radius > 0.0 && height > 0.0
+
 /**
 @inheritdoc
 
 @note The origin of the cylinder is at the center of its base.
 */
   protected[cell] override def cellMesh: Mesh = Mesh.cylinder(Point3D.Origin,
-  radius, Point3D(xOffset, yOffset, height), Cylinder.Divisions)
+  radius, Point3D(xOffset, yOffset, height), divisions)
+
+/**
+@inheritdoc
+
+@note Cylinders with positive dimensions are rendered with a shared unit
+mesh.
+*/
+  protected[cell] override def cellTriangleMesh =
+  if(isShared) GeometryCache.cylinder(divisions)
+  else super.cellTriangleMesh
+
+/**
+@inheritdoc
+*/
+  protected[cell] override def meshTransforms =
+  if(isShared) List(GeometryCache.shape(radius, radius, xOffset,
+  yOffset, height))
+  else Nil
 }
 
 /**
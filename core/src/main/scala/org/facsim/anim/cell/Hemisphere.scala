@@ -34,7 +34,7 @@ Scala source file from the org.facsim.anim.cell package.
 package org.facsim.anim.cell
 
 import org.facsim.LibResource
-import org.facsim.anim.{Mesh, Point3D}
+import org.facsim.anim.{GeometryCache, Mesh, Point3D}
 
 /**
 Class representing ''[[http://www.automod.com/ AutoMod®]] cell hemisphere''
@@ -74,6 +74,18 @@ This value must be >= 0.
   private val radius = scene.readDouble(_ >= 0.0, LibResource
  ("anim.cell.Hemisphere.read"))
 
+/**
+Number of divisions around the hemisphere's circumference.
+*/
+
+  private val divisions = scene.divisions(radius, Hemisphere.Divisions)
+
+/**
+Flag indicating whether this hemisphere is rendered with shared geometry.
+*/
+
+  private val isShared = radius > 0.0
+
 /**
 @inheritdoc
 
@@ -81,7 +93,25 @@ This value must be >= 0.
 
 */
   protected[cell] override def cellMesh: Mesh =
-  Mesh.hemisphere(Point3D.Origin, radius, Hemisphere.Divisions)
+  Mesh.hemisphere(Point3D.Origin, radius, divisions)
+
+/**
+@inheritdoc
+
+@note Hemispheres with positive dimensions are rendered with a shared unit
+mesh.
+*/
+  protected[cell] override def cellTriangleMesh =
+  if(isShared) GeometryCache.hemisphere(divisions)
+  else super.cellTriangleMesh
+
+/**
+@inheritdoc
+*/
+  protected[cell] override def meshTransforms =
+  if(isShared) List(GeometryCache.shape(radius, radius, 0.0, 0.0,
+  radius))
+  else Nil
 }
 
 /**
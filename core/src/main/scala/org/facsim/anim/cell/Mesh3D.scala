@@ -38,6 +38,8 @@ import scalafx.scene.Node
 import scalafx.scene.shape.CullFace
 import scalafx.scene.shape.DrawMode
 import scalafx.scene.shape.MeshView
+import scalafx.scene.shape.TriangleMesh
+import scalafx.scene.transform.Transform
 
 /**
 Abstract base class for all ''[[http://www.automod.com/ AutoMod]] cell''
@@ -60,17 +62,26 @@ during parsing of the file.
 private[cell] abstract class Mesh3D(scene: CellScene, parent: Option[Set])
 extends Cell(scene, parent) {
 
+/**
+Triangle mesh rendering this cell.
+
+This is created when first required, and is then shared by every node created
+for the cell. In particular, cells belonging to a definition are rendered with
+the same mesh by every instance of that definition.
+*/
+
+  private lazy val sharedMesh = cellTriangleMesh
+
 /**
 @inheritdoc
 */
   private[cell] final override def toNode = {
 
 /*
-Have the sub-class create and populate a mesh that we will associate with a
-mesh view.
+Associate the cell's shared mesh with a new mesh view.
 */
 
-    new MeshView(cellMesh.triangleMesh) {
+    new MeshView(sharedMesh) {
 
 /*
 If this cell has a name, then use it as an ID.
@@ -79,10 +90,11 @@ If this cell has a name, then use it as an ID.
       id = name.orNull
 
 /*
-Apply the required transformations to the node.
+Apply the required transformations to the node, followed by any transformations
+that map the mesh onto the cell's dimensions.
 */
 
-      transforms = cellTransforms
+      transforms = cellTransforms ::: meshTransforms
 
 /*
 Ensure that the cell is drawn with the correct materials and opacity.
@@ -126,4 +138,27 @@ Create a mesh to represent this cell and return it.
 @return Mesh representing the cell.
 */
   protected[cell] def cellMesh: Mesh
+
+/**
+Create the triangle mesh rendering this cell.
+
+This default version of the function converts the cell's mesh. Cells that can
+be rendered with shared geometry from an [[org.facsim.anim.GeometryCache$]]
+should override this method, together with `meshTransforms`.
+
+@note This function is called at most once for each cell.
+
+@return Triangle mesh rendering this cell.
+*/
+  protected[cell] def cellTriangleMesh: TriangleMesh = cellMesh.triangleMesh
+
+/**
+Transformations mapping the cell's triangle mesh onto the cell's dimensions.
+
+This default version of the function applies no transformations, since the
+cell's mesh has the cell's actual dimensions.
+
+@return Transformations, applied after the cell's own transformations.
+*/
+  protected[cell] def meshTransforms: List[Transform] = Nil
 }
\ No newline at end of file
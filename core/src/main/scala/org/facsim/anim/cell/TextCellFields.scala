@@ -0,0 +1,109 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+Scala source file from the org.facsim.anim.cell package.
+*/
+
+package org.facsim.anim.cell
+
+import java.io.DataOutput
+import org.facsim.assertNonNull
+import org.facsim.io.TextReader
+
+/**
+Cell field source that parses fields from ''cell'' file text.
+
+@constructor Create a new text field source.
+
+@param reader Text reader from which the ''cell'' file's fields are parsed.
+
+@param recorder If defined, each field is appended, once successfully read and
+verified, to this output in compiled form, so that the same sequence of fields
+can subsequently be replayed by a [[org.facsim.anim.cell.CompiledCellFields!]]
+instance. If `None`, fields are not recorded.
+*/
+
+private[cell] final class TextCellFields(reader: TextReader,
+recorder: Option[DataOutput])
+extends CellFields {
+
+/*
+Sanity checks.
+*/
+
+  assertNonNull(reader)
+  assertNonNull(recorder)
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readText(TextReader.Verifier[String])]]
+*/
+  override def readText(verifier: TextReader.Verifier[String]) = {
+    val value = reader.readToEOL(verifier)
+    recorder.foreach(CellCache.writeString(_, CellCache.TextTag, value))
+    value
+  }
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readString(TextReader.Verifier[String])
+]]
+*/
+  override def readString(verifier: TextReader.Verifier[String]) = {
+    val value = reader.readString(verifier)
+    recorder.foreach(CellCache.writeString(_, CellCache.StringTag, value))
+    value
+  }
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readInt(TextReader.Verifier[Int])]]
+*/
+  override def readInt(verifier: TextReader.Verifier[Int]) = {
+    val value = reader.readInt(verifier)
+    recorder.foreach {
+      out =>
+      out.writeByte(CellCache.IntTag)
+      out.writeInt(value)
+    }
+    value
+  }
+
+/*
+@see [[org.facsim.anim.cell.CellFields!.readDouble(TextReader.Verifier[Double])
+]]
+*/
+  override def readDouble(verifier: TextReader.Verifier[Double]) = {
+    val value = reader.readDouble(verifier)
+    recorder.foreach {
+      out =>
+      out.writeByte(CellCache.DoubleTag)
+      out.writeDouble(value)
+    }
+    value
+  }
+}
@@ -34,6 +34,7 @@ Scala source file from the org.facsim.anim.cell package.
 package org.facsim.anim.cell
 
 import org.facsim.LibResource
+import org.facsim.anim.GeometryCache
 import org.facsim.anim.Mesh
 import org.facsim.anim.Point3D
 
@@ -158,6 +159,31 @@ Trapezoid top Y-axis offset.
   protected[cell] override def cellMesh: Mesh =
   Mesh.rectangularFrustum(Point3D.Origin, baseXDim, baseYDim,
   Point3D(xOffset, yOffset, height), topXDim, topYDim)
+
+/**
+Flag indicating whether this trapezoid is rendered with shared geometry.
+*/
+
+  private val isShared = baseXDim > 0.0 && baseYDim > 0.0 && height > 0.0
+
+/**
+@inheritdoc
+
+@note Trapezoids with positive base dimensions and height are rendered with a
+shared unit mesh.
+*/
+  protected[cell] override def cellTriangleMesh =
+  if(isShared) GeometryCache.rectangularFrustum(topXDim / baseXDim,
+  topYDim / baseYDim)
+  else super.cellTriangleMesh
+
+/**
+@inheritdoc
+*/
+  protected[cell] override def meshTransforms =
+  if(isShared) List(GeometryCache.shape(baseXDim, baseYDim, xOffset,
+  yOffset, height))
+  else Nil
 }
 
 /**
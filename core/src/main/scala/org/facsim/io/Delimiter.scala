@@ -94,6 +94,39 @@ delimiters.
   requireValid(delimiters, !delimiters.contains(TextReader.NUL) &&
   !delimiters.contains(TextReader.CR))
 
+/**
+Bit table identifying delimiter characters in the ''Latin-1'' range.
+
+Text readers test every character they scan against the delimiter set, so
+membership of the common case is determined by a table lookup, rather than by
+a (boxed) set lookup.  Characters outside of this range are looked up in the
+set.
+*/
+
+  private final val table = {
+    val bits = new Array[Long](Delimiter.TableSize / java.lang.Long.SIZE)
+    delimiters.filter(c => c >= 0 && c < Delimiter.TableSize).foreach {c =>
+      bits(c >>> Delimiter.WordShift) |= 1L << c
+    }
+    bits
+  }
+
+/**
+Determine whether a character is a delimiter.
+
+@param c Character to be tested.
+
+@return `true` if '''c''' is one of this delimiter's characters; `false`
+otherwise.
+*/
+  @inline
+  private[io] final def isDelimiter(c: Int): Boolean = {
+    if(c >= 0 && c < Delimiter.TableSize) {
+      (table(c >>> Delimiter.WordShift) & (1L << c)) != 0L
+    }
+    else c != TextReader.EOF && delimiters.contains(c)
+  }
+
 /**
 Determine if reader has reached this delimiter.
 
@@ -129,7 +162,7 @@ we're done.
 */
 
       val peekedChar = reader.peek()
-      if(peekedChar == TextReader.EOF || !delimiters.contains(peekedChar)) {
+      if(!isDelimiter(peekedChar)) {
         result
       }
 
@@ -158,4 +191,25 @@ Start the ball rolling, noting that we have yet to find a delimiter character.
 
     peek(false)
   }
-}
\ No newline at end of file
+}
+
+/**
+Delimiter companion object.
+*/
+
+private object Delimiter {
+
+/**
+Number of characters, starting from the ''null'' character, whose delimiter
+status is recorded in each delimiter's bit table.
+*/
+
+  private val TableSize = 256
+
+/**
+Right shift converting a character to the index of the word in the bit table
+holding its delimiter status.
+*/
+
+  private val WordShift = 6
+}
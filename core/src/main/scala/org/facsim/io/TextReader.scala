@@ -33,9 +33,9 @@ Scala source file from the org.facsim.io package.
 
 package org.facsim.io
 
-import java.io.{BufferedReader, EOFException, Reader}
-import java.lang.StringBuilder
-import org.facsim.{assertNonNull, requireNonNull, LibResource}
+import java.io.{EOFException, Reader}
+import java.util.Arrays
+import org.facsim.{requireNonNull, LibResource}
 import scala.annotation.tailrec
 
 /**
@@ -56,6 +56,12 @@ character ('\n'); older Mac OS systems (9 and earlier) terminate with a single
 ''carriage return'' character ('\r').  This reader, and its subclasses, allow
 all text streams to be treated as though they come from a ''Unix''-like system.
 
+Data is read from the underlying reader in blocks, into a reusable buffer.
+Fields are scanned directly from the buffer, and integer and (most) real
+fields are converted without first being copied to a string, so that reading
+large files creates very little garbage.  There is no need to supply a
+buffered reader; doing so merely adds a second, redundant, level of buffering.
+
 @todo Implement support for comments (ignore remainder of line, whole of line).
 
 @todo Implement support for quoted fields (such as those in CSV files).
@@ -87,84 +93,109 @@ Sanity checks.
   requireNonNull(defaultDelimiter)
 
 /**
-Create a buffered reader, if the specified reader is not already a buffered
-reader.  Use of a buffered reader will boost performance and provide additional
-functionality.
+Current state of this text reader.
+*/
+
+  private final val state = new State()
+
+/**
+Class representing current state of reader.
+
+This class buffers data read from the stream, marks the start of each field
+for subsequent reset operations (in the event that an exception occurs during
+a field read), and determines row & column numbers.
+
+Line termination sequences are replaced by single ''line feed'' characters as
+each block of data is read into the buffer, so that no further line
+termination processing is required when characters are read.
+
+All characters from the start of the field currently being read are retained
+in the buffer, which is enlarged if necessary, so that any field, regardless
+of its size, can be reset.
 
-@note This may change.  It may work out better to provide our own buffering
-using a regular reader.
+Row and column numbers are not updated as each character is read, since they
+are rarely required other than when reporting errors.  Instead, the row and
+column of one buffer position is retained, and the row and column of later
+positions are determined, when required, by scanning the intervening
+characters.
+
+Row numbering begins at 1 and is incremented each time a line termination
+sequence is read.  Column numbering begins at 1 and is incremented each time
+any other character is read; it is reset to 1 each time a line termination
+sequence is read.
 */
 
-  private final val reader: BufferedReader = textReader match {
-    case r: BufferedReader => r
-    case r: Reader => new BufferedReader(r, TextReader.BufferSize)
-  }
+  private final class State {
 
 /**
-Current state of this text reader.
+Buffer holding data read from the stream.
 */
 
-  private final val state = new State()
+    private var buffer = new Array[Char](TextReader.BufferSize)
 
 /**
-Class representing current state of reader.
+Index, within the buffer, of the next character to be read.
+*/
 
-This class maintains row & column numbers, marks streams for subsequent reset
-operations (in the event that an exception occurs during a field read), etc.
+    private var position = 0
 
-@constructor Create new text reader state with specified characteristics.
+/**
+Number of characters of data held in the buffer.
+*/
 
-@param lastChar Last character read from the stream.  This records the last
-character actually read from the stream, and is used in processing line
-termination sequences.  If nothing has been read from the stream, this value
-will be 0.
+    private var limit = 0
 
-@param peekedChar Last peeked character read from the reader.  If no character
-has been peeked, the value is `None`.
+/**
+Index, within the buffer, of the first character of the field currently being
+read, or `NoMark` if no field is being read.
+*/
 
-@param row Row from which we're currently reading data.  By convention, line
-numbering begins at 1 and is incremented each time a line termination sequence
-is read.  Line numbering is not to be updated until a line termination sequence
-has been read (rather than being peeked).
+    private var mark = TextReader.NoMark
 
-@param column Column from which the next character will be read.  Ideally,
-column numbering counts whole Unicode characters, not simply bytes or partial
-characters (as can be the case in ''UTF-8'' and ''UTF-16'' formats).  By
-convention, column numbering beings at 1 and is incremented each time a
-character is read.  The column number must be reset to 1 each time a line
-termination sequence has been read&mdash;the same point at which the line
-number is incremented.  Column numbering is not to be updated until a character
-has been read (rather than being peeked).
+/**
+Value of the end-of-file flag when the current field's start was marked.
 */
-  private final class State private[this](private var lastChar: Int, private
-  var peekedChar: Option[Int], private var row: Int, private var column: Int)
-  {
 
-//.............................................................................
+    private var markedEOF = false
+
+/**
+Flag indicating whether the end-of-file marker has been read.
+*/
+
+    private var eof = false
+
 /**
-Default auxiliary constructor for new state instances.
+Flag indicating whether all data has been read from the underlying reader.
+*/
 
-The last character read is set to 0 (the ''null character''), which is OK for
-initialization purposes.  The peeked character is set to `None`.  Row and
-column numbers are initialized to 1.
+    private var exhausted = false
+
+/**
+Flag indicating whether the last character read from the underlying reader was
+a ''carriage return'', which will have been reported as a ''line feed''.  If
+the next character is a ''line feed'', then it is discarded.
 */
-//.............................................................................
 
-    private[TextReader] def this() = this(0, None, 1, 1)
+    private var followsCR = false
+
+/**
+Index, within the buffer, of the position whose row and column number are
+known.
+*/
+
+    private var knownIndex = 0
 
-//.............................................................................
 /**
-''Copy'' constructor for copying existing state of a text reader.
+Row number of the character at the known position.
+*/
 
-The copied state is cached in case it needs to be restored later.  This
-operation is performed as part of the state caching operation.
+    private var knownRow = 1
 
-@param other State to be copied.
+/**
+Column number of the character at the known position.
 */
-//.............................................................................
 
-    private[TextReader] def this(other: State) = this(other.lastChar,
-    other.peekedChar, other.row, other.column)
+    private var knownColumn = 1
 
 //.............................................................................
 /**
@@ -173,7 +204,7 @@ operation is performed as part of the state caching operation.
 //.............................................................................
 
     @inline
-    private[TextReader] def atEOF = lastChar == TextReader.EOF
+    private[TextReader] def atEOF = eof
 
 //.............................................................................
 /**
@@ -181,8 +212,7 @@ operation is performed as part of the state caching operation.
 */
 //.............................................................................
 
-    @inline
-    private[TextReader] def getRow = row ensuring(_ > 0)
+    private[TextReader] def getRow = locate(position)._1 ensuring(_ > 0)
 
 //.............................................................................
 /**
@@ -190,265 +220,452 @@ operation is performed as part of the state caching operation.
 */
 //.............................................................................
 
-    @inline
-    private[TextReader] def getColumn = column ensuring(_ > 0)
+    private[TextReader] def getColumn = locate(position)._2 ensuring(_ > 0)
 
 //.............................................................................
 /**
-Cache the current state of this stream and return the new state.
-
-@note The default text reader buffer size is used to record all data read from
-the current file position.  If more data has been read from the stream than can
-be buffered and an attempt to [[org.facsim.io.TextReader!.State!.reset()]] back
-to the cached data is made, then an [[java.io.IOException!]] will result.
+Mark the position of the next character as the start of a field, so that it
+can subsequently be [[org.facsim.io.TextReader!.State!.reset()]] to.
+*/
+//.............................................................................
 
-@todo Change the implementation to avoid using [[java.io.BufferedReader!]]'s
-mark and reset operations, which enforce use of a fixed size buffer.
+    private[TextReader] def cache(): Unit = {
+      mark = position
+      markedEOF = eof
+    }
 
-@return Cached state.
+//.............................................................................
+/**
+Release the mark, once a field has been read successfully.
 */
 //.............................................................................
 
-    private[TextReader] def cache() = {
-      assert(reader.markSupported())
-      reader.mark(TextReader.BufferSize)
-      new State(this)
+    private[TextReader] def release(): Unit = {
+      mark = TextReader.NoMark
     }
 
 //.............................................................................
 /**
-Restore the specified prior state of this stream.
+Restore the state of this stream to the start of the marked field, and release
+the mark.
+*/
+//.............................................................................
 
-@note If more data was read from the stream than could be accommodated by the
-buffer specified in the [[org.facsim.io.TextReader!.State!.cache()]] method,
-then a [[java.io.IOException!]] will result from this call.
+    private[TextReader] def reset(): Unit = {
+      assert(mark != TextReader.NoMark)
+      position = mark
+      eof = markedEOF
+      mark = TextReader.NoMark
+    }
 
-@todo Change the implementation to avoid using [[java.io.BufferedReader!]]'s
-mark and reset operations, which enforce use of a fixed size buffer.
+//.............................................................................
+/**
+@see [[org.facsim.io.TextReader!.peek()]]
+*/
+//.............................................................................
 
-@param other Cached state to be copied.  This cached state must match the state
-returned by the immediate prior call to `cache`.  If no prior call has been
-made to `cache`, then a [[java.io.IOException!]] will result.
+    private[TextReader] def peek(): Int = {
+      if(eof) throw eofException()
+      else if(position < limit || fill()) buffer(position).toInt
+      else TextReader.EOF
+    } ensuring((c: Int) => c == TextReader.EOF || c >= 0)
 
-@throws java.io.IOException if the reader was not previously cached, or if more
-data than could be stored in the reader's buffer was read since the cache
-operation.
+//.............................................................................
+/**
+@see [[org.facsim.io.TextReader!.read()]]
 */
 //.............................................................................
 
-    private[TextReader] def reset(other: State): Unit = {
-      assertNonNull(other)
-      lastChar = other.lastChar
-      peekedChar = other.peekedChar
-      row = other.row
-      column = other.column
-      reader.reset()
-    }
+    private[TextReader] def read(): Int = {
+      val char = peek()
+      if(char == TextReader.EOF) eof = true
+      else position += 1
+      char
+    } ensuring((c: Int) => c == TextReader.EOF || c >= 0)
 
 //.............................................................................
 /**
-Update the row and column number to the appropriate values after reading the
-indicated character.
+Scan the field starting at the mark.
+
+Characters are read until a delimiter character is reached, or until all data
+has been read.  Neither the delimiter, nor the end-of-file marker, is read.
 
-@param char Character that we're about to report as having been read.
+@param delimiter Delimiter terminating the field.
+
+@return Number of characters in the field.
+
+@throws java.io.IOException if an attempt is made to read a character after an
+end-of-file condition has been signaled by a previous read operation, or if any
+other I/O error occurs during a read operation.
 */
 //.............................................................................
 
-    private def updateRowColumn(char: Int): Unit = char match {
+    private[TextReader] def scan(delimiter: Delimiter): Int = {
+      assert(mark == position)
+      if(eof) throw eofException()
 
 /*
-If the character just read was is end-of-file marker, then do nothing - we
-should not increment the row or column beyond its current position.
+Tail-recursive helper to advance past each non-delimiter character.
 */
 
-      case TextReader.EOF =>
+      @tailrec
+      def advance(): Unit = {
+        if(position < limit) {
+          if(!delimiter.isDelimiter(buffer(position))) {
+            position += 1
+            advance()
+          }
+        }
+        else if(fill()) advance()
+      }
 
-/*
-If the character we just read is a line feed, then update the row and column of
-the next character to be read.
-*/
+      advance()
+      position - mark
+    }
 
-      case TextReader.LF =>
-      row += 1
-      column = 1
+//.............................................................................
+/**
+Retrieve the marked field as a string.
 
-/*
-Otherwise, update the column number being read from.
+@param length Number of characters in the field.
+
+@return Field's value.
 */
+//.............................................................................
 
-      case _ => column += 1
-    }
+    private[TextReader] def field(length: Int) = new String(buffer, mark,
+    length)
 
 //.............................................................................
 /**
-@see [[org.facsim.io.TextReader!.peek()]]
+Parse the marked field as an integer value, in the same manner as
+[[java.lang.Long!.parseLong(String)]], but without creating a string.
+
+@param length Number of characters in the field.
+
+@param minimum Minimum permitted value.
+
+@param maximum Maximum permitted value.
+
+@return Field's value.
+
+@throws java.lang.NumberFormatException if the field is not a valid integer,
+or if its value lies outside of the range ['''minimum''', '''maximum'''].
 */
 //.............................................................................
 
-    private[TextReader] def peek(): Int =  {
-      peekedChar match {
+    private[TextReader] def parseLong(length: Int, minimum: Long, maximum:
+    Long): Long = {
+      val end = mark + length
+      val negative = length > 0 && buffer(mark) == '-'
+      val start = if(negative || (length > 0 && buffer(mark) == '+')) mark + 1
+      else mark
 
 /*
-If we have already peeked at the next character, but we have yet to read it,
-then return it.
+The value is accumulated as a negative number, since the range of negative
+values is larger than that of positive values.
 */
 
-        case Some(char) => char
+      val bound = if(negative) Long.MinValue else -Long.MaxValue
+      @tailrec
+      def accumulate(i: Int, value: Long): Long = {
+        if(i == end) value
+        else {
+          val digit = Character.digit(buffer(i), TextReader.Radix)
+          if(digit < 0 || value < bound / TextReader.Radix) invalid()
+          else {
+            val shifted = value * TextReader.Radix
+            if(shifted < bound + digit) invalid()
+            else accumulate(i + 1, shifted - digit)
+          }
+        }
+      }
 
 /*
-Otherwise, we haven't yet peeked at the next character, so read and store it.
+Helper to report an invalid field.
 */
 
-        case None =>
-        peekedChar = Option(readChar())
-        peekedChar.get
-      }
-    } ensuring((c: Int) => c == TextReader.EOF || c >= 0)
+      def invalid() = throwNumberFormatException(field(length))
+
+      if(start == end) invalid()
+      val value = accumulate(start, 0L)
+      val result = if(negative) value else -value
+      if(result < minimum || result > maximum) invalid()
+      else result
+    }
 
 //.............................................................................
 /**
-@see [[org.facsim.io.TextReader!.read()]]
+Parse the marked field as a double value, in the same manner as
+[[java.lang.Double!.parseDouble(String)]], except that leading and trailing
+whitespace are not permitted.
+
+Decimal values with no more than `MaxFastDigits` significant digits, and
+whose decimal exponent has a magnitude no greater than `MaxFastExponent`, are
+parsed directly from the buffer, using a single (correctly-rounded)
+floating-point multiplication or division.  All other values (including those
+in hexadecimal, or those with type suffixes) are converted to a string and
+parsed by ''Java''.
+
+@param length Number of characters in the field.
+
+@return Field's value.
+
+@throws java.lang.NumberFormatException if the field is not a valid double.
 */
 //.............................................................................
 
-    private[TextReader] def read(): Int = {
+    private[TextReader] def parseDouble(length: Int): Double = {
+      val end = mark + length
+      val negative = length > 0 && buffer(mark) == '-'
+      val start = if(negative || (length > 0 && buffer(mark) == '+')) mark + 1
+      else mark
 
 /*
-Helper function to determine whether we're reporting a previously peeked
-character, or a fresh character.
+Determine the value from the significand and its decimal exponent.  If the
+value cannot be determined exactly, then return NaN, which is never returned by
+the fast path.
 */
 
-      def peekedOrRead() = peekedChar match {
+      def compose(significand: Long, scale: Int): Double = {
+        if(significand == 0L) {
+          if(negative) -0.0 else 0.0
+        }
+        else if(scale < -TextReader.MaxFastExponent ||
+        scale > TextReader.MaxFastExponent) Double.NaN
+        else {
+          val magnitude = if(scale < 0) {
+            significand.toDouble / TextReader.Pow10(-scale)
+          }
+          else significand.toDouble * TextReader.Pow10(scale)
+          if(negative) -magnitude else magnitude
+        }
+      }
 
 /*
-If we have a previously peeked character, then return it and clear the cached
-peeked character.
+Tail-recursive helper to accumulate the digits of the exponent.
 */
 
-        case Some(ch) =>
-        peekedChar = None
-        ch
+      @tailrec
+      def exponent(i: Int, significand: Long, scale: Int, negativeExp: Boolean,
+      exp: Int, digits: Boolean): Double = {
+        if(i == end) {
+          if(!digits) Double.NaN
+          else compose(significand, if(negativeExp) scale - exp
+          else scale + exp)
+        }
+        else {
+          val c = buffer(i)
+          if(c >= '0' && c <= '9' && exp < TextReader.MaxExponent) {
+            exponent(i + 1, significand, scale, negativeExp, exp *
+            TextReader.Radix + (c - '0'), true)
+          }
+          else Double.NaN
+        }
+      }
 
 /*
-Otherwise, supply a fresh character from the stream.  We don't need to cache
-anything because we're not peeking at it.
+Tail-recursive helper to accumulate the digits of the significand.
 */
 
-        case None => readChar()
+      @tailrec
+      def significand(i: Int, value: Long, digits: Int, scale: Int, point:
+      Boolean, any: Boolean): Double = {
+        if(i == end) {
+          if(any) compose(value, scale)
+          else Double.NaN
+        }
+        else buffer(i) match {
+          case c if c >= '0' && c <= '9' =>
+          val newScale = if(point) scale - 1 else scale
+          if(value == 0L && c == '0') {
+            significand(i + 1, value, digits, newScale, point, true)
+          }
+          else if(digits == TextReader.MaxFastDigits) Double.NaN
+          else significand(i + 1, value * TextReader.Radix + (c - '0'), digits
+          + 1, newScale, point, true)
+          case '.' if !point =>
+          significand(i + 1, value, digits, scale, true, any)
+          case 'e' | 'E' if any =>
+          val signed = i + 1 < end && (buffer(i + 1) == '-' ||
+          buffer(i + 1) == '+')
+          val negativeExp = signed && buffer(i + 1) == '-'
+          exponent(if(signed) i + 2 else i + 1, value, scale, negativeExp, 0,
+          false)
+          case _ => Double.NaN
+        }
       }
 
 /*
-Update the row and column number for the character we're returning.
+Use the fast path if possible; otherwise, have Java parse the field.
 */
 
-      val char = peekedOrRead()
-      updateRowColumn(char)
-      char
-    } ensuring((c: Int) => c == TextReader.EOF || c >= 0)
+      val fast = significand(start, 0L, 0, 0, false, false)
+      if(!fast.isNaN) fast
+      else {
+        val s = field(length)
+        if(s != s.trim) throwNumberFormatException(s)
+        else s.toDouble
+      }
+    }
 
 //.............................................................................
 /**
-Read the next character from the stream.
+Determine the row and column number of a buffer position.
 
-Line termination sequences will be consumed and reported as a single ''line
-feed'' character to simplify stream  processing on all platforms.
+If no field is being read, or if the position precedes the start of the field
+being read, then the position becomes the known position, so that subsequent
+calls need only scan characters that follow it.
 
-@return The next character read from the stream or `EOF` if the end-of-file was
-encountered during the read.
+@param index Index of the buffer position, which must not precede the known
+position.
 
-@throws java.io.EOFException if an attempt is made to read a character after an
-end-of-file condition has been signaled by a previous read operation.
+@return Row and column number of the character at '''index'''.
 */
 //.............................................................................
 
-    private def readChar(): Int = {
+    private def locate(index: Int): (Int, Int) = {
+      assert(index >= knownIndex && index <= limit)
 
 /*
-If the last character read indicated end-of-file, then throw the EOFException.
+Tail-recursive helper to count the rows and columns of intervening characters.
 */
 
-      if(atEOF) throw new EOFException(LibResource("io.TextReader.EOF", row,
-      column))
-
-/*
-Read the next character from the stream.
-*/
+      @tailrec
+      def count(i: Int, row: Int, column: Int): (Int, Int) = {
+        if(i == index) (row, column)
+        else if(buffer(i) == '\n') count(i + 1, row + 1, 1)
+        else count(i + 1, row, column + 1)
+      }
 
-      reader.read match {
+      val rowColumn = count(knownIndex, knownRow, knownColumn)
+      if(mark == TextReader.NoMark || index <= mark) {
+        knownIndex = index
+        knownRow = rowColumn._1
+        knownColumn = rowColumn._2
+      }
+      rowColumn
+    }
 
-/*
-Is this a carriage return character?  If so, report that we read a line feed
-character.
+//.............................................................................
+/**
+Read the next block of data from the stream into the buffer.
 
-Note: This function should NEVER return a carriage return.
+Line termination sequences are replaced by single ''line feed'' characters as
+the data is read.
 
-Carriage returns should only be encountered in two situations:
-1.  As the first character of a line termination sequence in a Windows, DOS or
-    OS/2 text stream.  In this case, we deal with it by reporting it as a line
-    feed.  When we subsequently read the accompanying line feed character
-    (which will follow immediately afterwards, see next case statement), we
-    simply discard it and read another character to replace it.
-2.  As the sole character of a line termination sequence in a Mac OS 9 (or
-    earlier) data stream.  In this case, we just replace the carriage return
-    character with a line feed and we're done.
+@return `true` if more data was read; `false` if all data has been read from
+the stream.
 
-BUG: Things can get a little out of hand if a text stream has inconsistent line
-termination sequences.  We don't check for that, right now, but it's not likely
-to happen in practice.
+@throws java.io.IOException if an I/O error occurs during the read operation.
 */
+//.............................................................................
 
-        case TextReader.CR =>
-        lastChar = TextReader.CR
-        TextReader.LF
-
-/*
-Is this character a line feed character?  If so, was our last character a
-carriage return?  If not, then just return the line feed, after storing it as
-our new last character.  Otherwise, we have already reported that we read a
-line feed, so skip this line feed character and return the next character.
-
-Line feeds should only be encountered in two situations:
-1.  As the second character of a line termination sequence in a Windows, DOS or
-    OS/2 text stream.  In this case, we deal with it by ignoring it (we already
-    reported a line feed when we read the carriage return).  However, since we
-    still need to return a freshly-read character, read another character from
-    the stream and return that.
-2.  As the sole line termination sequence in a Unix (or Unix-like) data stream.
-    In this case, we just return the line feed.
-*/
-
-        case TextReader.LF =>
-        if(lastChar != TextReader.CR) {
-          lastChar = TextReader.LF
-          lastChar
+    @tailrec
+    private def fill(): Boolean = {
+      if(exhausted) false
+      else {
+        compact()
+        val count = textReader.read(buffer, limit, buffer.length - limit)
+        if(count < 0) {
+          exhausted = true
+          false
         }
         else {
-          lastChar = TextReader.LF
-          readChar()
-        }
 
 /*
-Otherwise, we have the simple task of reporting the character read - but make
-sure we store it, so that we can correctly identify when we're attempting to
-read beyond the end-of-file (see top of this function).
+If normalization discarded every character read (a lone line feed following a
+carriage return at the end of the previous block), then read another block.
 */
 
-        case char =>
-        lastChar = char
-        lastChar
+          val start = limit
+          limit = normalize(start, start + count)
+          if(limit > start) true
+          else fill()
+        }
       }
-    } ensuring((c: Int) => c == TextReader.EOF || c >= 0)
+    }
+
+//.............................................................................
+/**
+Discard buffered characters that can no longer be reset to, making room for
+more data.  If the buffer is full of characters that must be retained, then it
+is enlarged.
+*/
+//.............................................................................
+
+    private def compact(): Unit = {
+      val discard = if(mark == TextReader.NoMark) position else mark
+      if(discard > 0) {
+        locate(discard)
+        System.arraycopy(buffer, discard, buffer, 0, limit - discard)
+        position -= discard
+        limit -= discard
+        knownIndex -= discard
+        if(mark != TextReader.NoMark) mark -= discard
+      }
+      if(limit == buffer.length) buffer = Arrays.copyOf(buffer, buffer.length *
+      2)
+    }
+
+//.............................................................................
+/**
+Replace line termination sequences in newly read data with single ''line
+feed'' characters, in place.
+
+Carriage returns are replaced by line feeds; line feeds immediately following
+a carriage return (including one at the end of the previous block) are
+discarded.
+
+@param from Index of the first newly read character.
+
+@param to Index following the last newly read character.
+
+@return Index following the last normalized character.
+*/
+//.............................................................................
+
+    private def normalize(from: Int, to: Int): Int = {
+      @tailrec
+      def copy(src: Int, dst: Int): Int = {
+        if(src == to) dst
+        else buffer(src) match {
+          case '\r' =>
+          followsCR = true
+          buffer(dst) = '\n'
+          copy(src + 1, dst + 1)
+          case '\n' if followsCR =>
+          followsCR = false
+          copy(src + 1, dst)
+          case c =>
+          followsCR = false
+          buffer(dst) = c
+          copy(src + 1, dst + 1)
+        }
+      }
+      copy(from, from)
+    }
+
+//.............................................................................
+/**
+Create an exception reporting an attempt to read beyond the end-of-file.
+
+@return Exception reporting the current row and column.
+*/
+//.............................................................................
+
+    private def eofException() = new EOFException(LibResource(
+    "io.TextReader.EOF", getRow, getColumn))
   }
 
 /**
 Read the next field from the stream and return it as the specified type.
 
-Prior to reading from the stream, the current reader state&mdash;including its
-current read position&mdash;will be cached.  If a data exception occurs (for
-example, if the data was read but proved to have an invalid format or value),
-then the stream's original state will be restored before that exception is
-passed to the calling routine.  However, it is not possible to restore state
-for some unrecoverable errors.
+Prior to reading from the stream, the current read position will be marked.
+If a data exception occurs (for example, if the data was read but proved to
+have an invalid format or value), then the stream's original state will be
+restored before that exception is passed to the calling routine.  However, it
+is not possible to restore state for some unrecoverable errors.
 
 @param delimiter Delimiter to be used for this read operation.
 
@@ -456,9 +673,10 @@ for some unrecoverable errors.
 returned.  If this function returns `false`, a
 [[org.facsim.io.FieldVerificationException!]] will be raised.
 
-@param convertField Function to convert the field's value from a string to the
-required type '''T'''.  If the field cannot be converted, a
-[[org.facsim.io.FieldConversionException!]] is thrown.
+@param convertField Function to convert the field, of the indicated length,
+starting at the marked position, to the required type '''T'''.  If the field
+cannot be converted, a [[java.lang.NumberFormatException!]] must be thrown,
+which will be reported as a [[org.facsim.io.FieldConversionException!]].
 
 @tparam T Data type that the field is to be converted to and returned as.
 
@@ -475,67 +693,43 @@ not be converted to '''T''' by the '''convertField''' function.
 be verified by the '''verify''' function.
 */
   private final def readField[T](delimiter: Delimiter,
-  verify: TextReader.Verifier[T])(convertField:(String) => T): T = {
-
-/*
-Tail-recursive helper function to build the field read.
-*/
-
-    @tailrec
-    def buildField(field: StringBuilder): StringBuilder = {
-
-/*
-If we've reached a field delimiter, then return what we have.
-*/
-
-      if(delimiter.reached(this)) field
+  verify: TextReader.Verifier[T])(convertField: Int => T): T = {
 
 /*
-If we've reached the end-of-file condition, then read and discard it to ensure
-that we throw the EOFException if we attempt a further read operation, and then
-return what we have.  (If we don't read the EOF marker, we'll just return an
-infinite set of empty fields on subsequent reads.)
+Mark the current position of the stream in case we need to restore it later,
+then scan the field.  This may throw an IOException.
 */
 
-      else if(peek() == TextReader.EOF) {
-        read()
-        field
-      }
+    state.cache()
+    val length = state.scan(delimiter)
 
 /*
-Otherwise, append the next character to the field and return it.
+If we've reached a field delimiter, then read it.  Otherwise, we've reached
+the end-of-file condition, so read and discard it to ensure that we throw the
+EOFException if we attempt a further read operation.  (If we don't read the EOF
+marker, we'll just return an infinite set of empty fields on subsequent reads.)
 */
 
-      else buildField(field.appendCodePoint(read()))
+    if(!delimiter.reached(this)) {
+      assert(peek() == TextReader.EOF)
+      read()
     }
 
-/*
-Cache the current state of the stream in case we need to restore it later.
-*/
-
-    val cachedState = state.cache()
-
-/*
-Retrieve the field from the helper function.  This may throw an IOException.
-*/
-
-    val field = buildField(new StringBuilder()).toString
-
 /*
 Convert the field to the required type using the supplied function.
 
 If this throws a NumberFormatException, then reset the state and convert it to
-a FieldConversionException.
+a FieldConversionException.  Row and column numbers are only determined now.
 */
 
     val fieldValue = try {
-      convertField(field)
+      convertField(length)
     }
     catch {
       case e: NumberFormatException =>
-      state.reset(cachedState)
-      throw new FieldConversionException(cachedState.getRow,
-      cachedState.getColumn, field)
+      val field = state.field(length)
+      state.reset()
+      throw new FieldConversionException(state.getRow, state.getColumn, field)
     }
 
 /*
@@ -546,11 +740,15 @@ FieldVerificationException.
 */
 
     if(!verify(fieldValue)) {
-      state.reset(cachedState)
-      throw new FieldVerificationException(cachedState.getRow,
-      cachedState.getColumn, field)
+      val field = state.field(length)
+      state.reset()
+      throw new FieldVerificationException(state.getRow, state.getColumn,
+      field)
+    }
+    else {
+      state.release()
+      fieldValue
     }
-    else fieldValue
   }
 
 /**
@@ -602,10 +800,7 @@ be verified by '''verify'''.
 */
   final def readString(verify: TextReader.Verifier[String] =
   TextReader.defaultStringVerifier)(implicit delimiter: Delimiter =
-  defaultDelimiter): String = readField[String](delimiter, verify) {
-    field =>
-    field
-  }
+  defaultDelimiter): String = readField[String](delimiter, verify)(state.field)
 
 /**
 Read the next field from the stream and return it as a byte.
@@ -635,7 +830,10 @@ be verified by '''verify'''.
 */
   final def readByte(verify: TextReader.Verifier[Byte] =
   TextReader.defaultByteVerifier)(implicit delimiter: Delimiter =
-  defaultDelimiter): Byte = readField[Byte](delimiter, verify)(_.toByte)
+  defaultDelimiter): Byte = readField[Byte](delimiter, verify) {
+    length =>
+    state.parseLong(length, Byte.MinValue, Byte.MaxValue).toByte
+  }
 
 /**
 Read the next field from the stream and return it as a short integer.
@@ -665,7 +863,10 @@ be verified by '''verify'''.
 */
   final def readShort(verify: TextReader.Verifier[Short] =
   TextReader.defaultShortVerifier)(implicit delimiter: Delimiter =
-  defaultDelimiter): Short = readField[Short](delimiter, verify)(_.toShort)
+  defaultDelimiter): Short = readField[Short](delimiter, verify) {
+    length =>
+    state.parseLong(length, Short.MinValue, Short.MaxValue).toShort
+  }
 
 /**
 Read the next field from the stream and return it as an integer.
@@ -695,7 +896,10 @@ be verified by '''verify'''.
 */
   final def readInt(verify: TextReader.Verifier[Int] =
   TextReader.defaultIntVerifier)(implicit delimiter: Delimiter =
-  defaultDelimiter): Int = readField[Int](delimiter, verify)(_.toInt)
+  defaultDelimiter): Int = readField[Int](delimiter, verify) {
+    length =>
+    state.parseLong(length, Int.MinValue, Int.MaxValue).toInt
+  }
 
 /**
 Read the next field from the stream and return it as a long integer.
@@ -725,7 +929,10 @@ be verified by '''verify'''.
 */
   final def readLong(verify: TextReader.Verifier[Long] =
   TextReader.defaultLongVerifier)(implicit delimiter: Delimiter =
-  defaultDelimiter): Long = readField[Long](delimiter, verify)(_.toLong)
+  defaultDelimiter): Long = readField[Long](delimiter, verify) {
+    length =>
+    state.parseLong(length, Long.MinValue, Long.MaxValue)
+  }
 
 /**
 Read the next field from the stream and return it as a float.
@@ -756,7 +963,8 @@ be verified by '''verify'''.
   final def readFloat(verify: TextReader.Verifier[Float] =
   TextReader.defaultFloatVerifier)(implicit delimiter: Delimiter =
   defaultDelimiter): Float = readField[Float](delimiter, verify) {
-    field =>
+    length =>
+    val field = state.field(length)
 
 /*
 The default toFloat method (actually java.lang.Float.parseFloat (String))
@@ -798,17 +1006,16 @@ be verified by '''verify'''.
   final def readDouble(verify: TextReader.Verifier[Double] =
   TextReader.defaultDoubleVerifier)(implicit delimiter: Delimiter =
   defaultDelimiter): Double = readField[Double](delimiter, verify) {
-    field =>
+    length =>
 
 /*
-The default toDouble method (actually java.lang.Double.parseDouble (String))
-allows leading and trailing whitespace, when it should not.  To overcome this,
-if the trimmed version of the string differs from the string supplied, we'll
-throw a NumberFormatException.
+Decimal values are parsed directly from the buffer, where possible.  The
+default toDouble method (actually java.lang.Double.parseDouble (String)), which
+is used for all other values, allows leading and trailing whitespace, when it
+should not; such fields are rejected by the parser.
 */
 
-    if(field != field.trim) throwNumberFormatException(field)
-    else field.toDouble
+    state.parseDouble(length)
   }
 
 /**
@@ -945,12 +1152,53 @@ Magic number, storing Unicode value of the ''space'' character.
   val SPC = ' '.toInt
 
 /**
-Size of the default buffer size to be used for readers and for use when marking
-streams.
+Initial size of each reader's buffer, in characters.  Buffers are enlarged if
+they must hold a larger field.
 */
 
   private val BufferSize = 32768
 
+/**
+Buffer index indicating that no field is being read.
+*/
+
+  private val NoMark = -1
+
+/**
+Radix of numeric fields.
+*/
+
+  private val Radix = 10
+
+/**
+Maximum number of significant digits of a real field that is parsed directly
+from a reader's buffer.  Significands with no more than this number of digits
+can be represented exactly as double values.
+*/
+
+  private val MaxFastDigits = 15
+
+/**
+Maximum magnitude of the decimal exponent of a real field that is parsed
+directly from a reader's buffer.  Powers of ten up to this magnitude can be
+represented exactly as double values.
+*/
+
+  private val MaxFastExponent = 22
+
+/**
+Value beyond which the exponent of a real field is not accumulated when parsing
+directly from a reader's buffer.  Such a field is parsed by ''Java'' instead.
+*/
+
+  private val MaxExponent = 10000
+
+/**
+Exact powers of ten, from 10^0^ to 10^`MaxFastExponent`^.
+*/
+
+  private val Pow10 = Array.iterate(1.0, MaxFastExponent + 1)(_ * Radix)
+
 /**
 Verification function.
 */
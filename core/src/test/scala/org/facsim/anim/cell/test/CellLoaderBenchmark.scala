@@ -0,0 +1,107 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+========================================================================================================================
+Scala source file from the org.facsim.anim.cell.test package.
+*/
+
+package org.facsim.anim.cell.test
+
+import java.io.File
+import java.net.URL
+import java.nio.charset.StandardCharsets
+import java.nio.file.Files
+import org.facsim.anim.cell.CellLoader
+import org.facsim.test.RegressionBenchmark
+import org.scalameter.api._
+
+/**
+Benchmark of [[org.facsim.anim.cell.CellLoader]] parsing of ''AutoMod® cell''
+files.
+
+Each measurement parses and loads a file from the `cellFiles` test resource
+corpus, or a generated scene containing a large number of primitives, which
+highlights the cost of reading each cell.
+*/
+
+object CellLoaderBenchmark
+extends RegressionBenchmark {
+
+/**
+Cell files to be loaded.
+*/
+
+  val files: Gen[String] = Gen.enumeration("file")(
+    "ArcFine.cell",
+    "CircleFineSolid.cell",
+    "ConeFine.cell",
+    "CylinderFine.cell",
+    "FrustumFine.cell",
+    "HemisphereFine.cell",
+    "SectorFine.cell",
+    "Tetrahedron.cell",
+    "Trapezoid.cell",
+    "Triad.cell",
+    "WorldText.cell"
+  )
+
+/**
+Numbers of primitives in generated scenes.
+*/
+
+  val primitives: Gen[Int] = Gen.exponential("primitives")(1000, 100000, 10)
+
+/**
+Generated scenes, each comprising a single set containing the indicated number
+of tetrahedra.
+*/
+
+  val scenes: Gen[URL] = primitives.map {n =>
+    val header = "10000 21\n1 1 0 1 1 Generated\n0.0 0.0 0.0\n0 0.0 0.0 0.0\n" +
+    "1.0 1.0 1.0\n" + n + "\n"
+    val tetrahedron = "311 1\n1 1 0 1 1 Tetrahedron\n2 1 3 4 5.0\n"
+    val file = File.createTempFile("Generated", ".cell")
+    file.deleteOnExit()
+    Files.write(file.toPath, (header + tetrahedron * n).getBytes(
+    StandardCharsets.UTF_8))
+    file.toURI.toURL
+  }
+
+  performance of "CellLoader" in {
+    measure method "load" in {
+      using(files) in {file =>
+        CellLoader.load(getClass.getResource("/cellFiles/" + file))
+      }
+      using(scenes) in {url =>
+        CellLoader.load(url)
+      }
+    }
+  }
+}
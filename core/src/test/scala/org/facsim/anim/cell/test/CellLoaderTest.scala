@@ -35,6 +35,7 @@ package org.facsim.anim.cell.test
 
 import java.io.FileNotFoundException
 import java.net.URL
+import java.nio.file.{Files, Path, StandardCopyOption}
 import org.facsim.anim.cell.CellLoader
 import org.scalatest.FunSpec
 import scala.annotation.tailrec
@@ -115,5 +116,111 @@ Cell file load tests.
         }
       }
     }
+
+/*
+Concurrent cell file load tests.
+*/
+
+    describe(".loadAll(Seq[URL], Int, Option[URL], CellColor.Value, " +
+    "CellColor.Value)") {
+      it("must load all files, in order") {
+        new CellFiles {
+          val nodes = CellLoader.loadAll(files, 4)
+          assert(nodes.length === files.length)
+          assert(nodes.forall(_ ne null))
+        }
+      }
+      it("must create a distinct node for each repeated file") {
+        val triad = testRscFile("Triad.cell")
+        val nodes = CellLoader.loadAll(List(triad, triad, triad), 2)
+        assert(nodes.length === 3)
+        assert(nodes.map(_.delegate).distinct.length === 3)
+      }
+      it("must report the first file that cannot be loaded") {
+        val dir = Files.createTempDirectory("CellLoaderTest")
+        val missing = dir.resolve("Missing.cell").toUri.toURL
+        val e = intercept[FileNotFoundException] {
+          CellLoader.loadAll(List(testRscFile("Triad.cell"), missing,
+          dir.resolve("Other.cell").toUri.toURL), 3)
+        }
+        assert(e.getMessage.contains("Missing.cell"))
+      }
+      it("must reject non-positive thread counts") {
+        intercept[IllegalArgumentException] {
+          CellLoader.loadAll(List(testRscFile("Triad.cell")), 0)
+        }
+      }
+    }
+
+/*
+Compiled cell file load tests.
+*/
+
+    describe(".loadCompiled(URL, Option[Path], Option[URL], CellColor.Value, " +
+    "CellColor.Value)") {
+      it("must load all files, both before and after compilation") {
+        new CellFiles {
+          val cacheDir = Files.createTempDirectory("CellLoaderTest")
+          @tailrec
+          def loadFile(list: List[URL]): Unit = {
+            if(!list.isEmpty) {
+              CellLoader.loadCompiled(list.head, Some(cacheDir))
+              CellLoader.loadCompiled(list.head, Some(cacheDir))
+              loadFile(list.tail)
+            }
+          }
+          loadFile(files)
+          assert(Files.list(cacheDir).count === files.length)
+        }
+      }
+      it("must store compiled files beside local cell files by default") {
+        val dir = Files.createTempDirectory("CellLoaderTest")
+        val source = copy(testRscFile("Triad.cell"), dir)
+        val compiled = dir.resolve("Triad.cell.cellc")
+        CellLoader.loadCompiled(source.toUri.toURL)
+        assert(Files.isRegularFile(compiled))
+        val contents = Files.readAllBytes(compiled).toList
+        CellLoader.loadCompiled(source.toUri.toURL)
+        assert(Files.readAllBytes(compiled).toList === contents)
+      }
+      it("must rebuild compiled files when their cell file changes") {
+        val dir = Files.createTempDirectory("CellLoaderTest")
+        val source = copy(testRscFile("Triad.cell"), dir)
+        val compiled = dir.resolve("Triad.cell.cellc")
+        CellLoader.loadCompiled(source.toUri.toURL)
+        val contents = Files.readAllBytes(compiled).toList
+        Files.copy(testRscFile("Tetrahedron.cell").openStream(), source,
+        StandardCopyOption.REPLACE_EXISTING)
+        CellLoader.loadCompiled(source.toUri.toURL)
+        assert(Files.readAllBytes(compiled).toList !== contents)
+      }
+      it("must rebuild corrupt compiled files") {
+        val dir = Files.createTempDirectory("CellLoaderTest")
+        val source = copy(testRscFile("Tetrahedron.cell"), dir)
+        val compiled = dir.resolve("Tetrahedron.cell.cellc")
+        CellLoader.loadCompiled(source.toUri.toURL)
+        val contents = Files.readAllBytes(compiled)
+        Files.write(compiled, contents.take(contents.length / 2))
+        CellLoader.loadCompiled(source.toUri.toURL)
+        assert(Files.readAllBytes(compiled).toList === contents.toList)
+      }
+    }
+  }
+
+/**
+Copy a test resource file to the specified directory.
+
+@param url URL of the test resource file.
+
+@param dir Directory to which the file is copied.
+
+@return Path of the copy.
+*/
+
+  def copy(url: URL, dir: Path) = {
+    val name = url.getPath.substring(url.getPath.lastIndexOf('/') + 1)
+    val path = dir.resolve(name)
+    Files.copy(url.openStream(), path)
+    path
   }
 }
\ No newline at end of file
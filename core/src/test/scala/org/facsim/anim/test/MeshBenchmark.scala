@@ -0,0 +1,93 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+========================================================================================================================
+Scala source file from the org.facsim.anim.test package.
+*/
+
+package org.facsim.anim.test
+
+import org.facsim.anim.{Mesh, Point3D}
+import org.facsim.test.RegressionBenchmark
+import org.scalameter.api._
+
+/**
+Benchmark of [[org.facsim.anim.Mesh]] generation, and of conversion of meshes to
+triangle meshes for rendering.
+*/
+
+object MeshBenchmark
+extends RegressionBenchmark {
+
+/**
+Numbers of divisions of each mesh to be benchmarked.
+*/
+
+  val divisions: Gen[Int] = Gen.exponential("divisions")(8, 512, 4)
+
+/**
+Cylinder meshes, with the indicated number of divisions.
+*/
+
+  val cylinders: Gen[Mesh] = for(d <- divisions) yield {
+    Mesh.cylinder(Point3D.Origin, 1.0, Point3D(0.0, 0.0, 1.0), d)
+  }
+
+/**
+Hemisphere meshes, with the indicated number of divisions.
+*/
+
+  val hemispheres: Gen[Mesh] = for(d <- divisions) yield {
+    Mesh.hemisphere(Point3D.Origin, 1.0, d)
+  }
+
+  performance of "Mesh" in {
+    measure method "cylinder" in {
+      using(divisions) in {d =>
+        Mesh.cylinder(Point3D.Origin, 1.0, Point3D(0.0, 0.0, 1.0), d)
+      }
+    }
+    measure method "hemisphere" in {
+      using(divisions) in {d =>
+        Mesh.hemisphere(Point3D.Origin, 1.0, d)
+      }
+    }
+    measure method "triangleMesh (cylinder)" in {
+      using(cylinders) in {m =>
+        m.triangleMesh
+      }
+    }
+    measure method "triangleMesh (hemisphere)" in {
+      using(hemispheres) in {m =>
+        m.triangleMesh
+      }
+    }
+  }
+}
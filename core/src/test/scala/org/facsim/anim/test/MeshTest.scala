@@ -0,0 +1,204 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+========================================================================================================================
+Scala source file from the org.facsim.anim.test package.
+*/
+
+package org.facsim.anim.test
+import org.facsim.anim.{Face, GeometryCache, LevelOfDetail, Mesh, Point3D,
+VertexTable}
+import org.scalatest.FunSpec
+import scala.annotation.tailrec
+
+/**
+Test suite for the [[org.facsim.anim.Mesh!]] class.
+*/
+
+class MeshTest
+extends FunSpec {
+
+/**
+Unit square, in the local ''X-Y'' plane.
+*/
+
+  val square = List(Point3D(0.0, 0.0, 0.0), Point3D(1.0, 0.0, 0.0),
+  Point3D(1.0, 1.0, 0.0), Point3D(0.0, 1.0, 0.0))
+
+/*
+Test fixture description.
+*/
+
+  describe(classOf[Mesh].getCanonicalName) {
+
+/*
+Triangle mesh conversion tests.
+*/
+
+    describe(".triangleMesh") {
+      it("must output each face as a fan of triangular faces") {
+        val mesh = new Mesh(List(new Face(square))).triangleMesh
+        assert(mesh.delegate.getPoints.toArray(null).toList ===
+        List(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f))
+        assert(mesh.delegate.getTexCoords.toArray(null).toList ===
+        List(0.0f, 0.0f))
+        assert(mesh.delegate.getFaces.toArray(null).toList ===
+        List(0, 0, 2, 0, 3, 0, 0, 0, 1, 0, 2, 0))
+        assert(mesh.delegate.getFaceSmoothingGroups.toArray(null).toList ===
+        List(0, 0))
+      }
+      it("must output shared vertices once") {
+        val other = List(square(1), Point3D(2.0, 0.0, 0.0),
+        Point3D(2.0, 1.0, 0.0), square(2))
+        val mesh = new Mesh(List(new Face(square), new Face(other)))
+        .triangleMesh
+        assert(mesh.delegate.getPoints.size === 6 * 3)
+        assert(mesh.delegate.getFaces.size === 4 * 6)
+      }
+      it("must treat negative and positive zero coordinates as the same") {
+        val negated = square.map(p => Point3D(p.x, p.y, -0.0))
+        val mesh = new Mesh(List(new Face(square), new Face(negated)))
+        .triangleMesh
+        assert(mesh.delegate.getPoints.size === 4 * 3)
+      }
+      it("must only reference defined points") {
+        val mesh = Mesh.cylinder(Point3D.Origin, 1.0, Point3D(0.0, 0.0, 1.0),
+        256).triangleMesh
+        val points = mesh.delegate.getPoints.size / 3
+        val texturePoints = mesh.delegate.getTexCoords.size / 2
+        val faces = mesh.delegate.getFaces.toArray(null).toList.grouped(2)
+        assert(faces.forall {
+          case List(p, t) => p >= 0 && p < points && t >= 0 &&
+          t < texturePoints
+          case _ => false
+        })
+        assert(mesh.delegate.getFaceSmoothingGroups.size * 6 ===
+        mesh.delegate.getFaces.size)
+      }
+    }
+  }
+
+/*
+Vertex table tests.
+*/
+
+  describe(classOf[VertexTable].getCanonicalName) {
+    describe(".index(Float, Float, Float)") {
+      it("must assign consecutive indices to distinct vertices") {
+        val table = new VertexTable(3)
+        @tailrec
+        def add(i: Int): Unit = {
+          if(i < 10000) {
+            assert(table.index(i.toFloat, -i.toFloat, 0.5f) === i)
+            add(i + 1)
+          }
+        }
+        add(0)
+        assert(table.size === 10000)
+        assert(table.index(1234.0f, -1234.0f, 0.5f) === 1234)
+        assert(table.toArray.length === 30000)
+      }
+      it("must ignore the third coordinate of two-dimensional vertices") {
+        val table = new VertexTable(2)
+        assert(table.index(0.25f, 0.5f, 0.0f) === 0)
+        assert(table.index(0.25f, 0.5f, 1.0f) === 0)
+        assert(table.toArray.toList === List(0.25f, 0.5f))
+      }
+    }
+  }
+
+/*
+Geometry cache tests.
+*/
+
+  describe(GeometryCache.getClass.getCanonicalName) {
+    describe(".cylinder(Int)") {
+      it("must share unit meshes with the same number of divisions") {
+        assert(GeometryCache.cylinder(16) eq GeometryCache.cylinder(16))
+        assert(GeometryCache.cylinder(16) ne GeometryCache.cylinder(32))
+      }
+    }
+    describe(".shape(Double, Double, Double, Double, Double)") {
+      it("must map the unit top center onto the primitive's top center") {
+        val p = GeometryCache.shape(2.0, 3.0, 0.5, -0.5, 4.0).delegate
+        .transform(0.0, 0.0, 1.0)
+        assert(p.getX === 0.5)
+        assert(p.getY === -0.5)
+        assert(p.getZ === 4.0)
+      }
+      it("must scale the unit base onto the primitive's base") {
+        val p = GeometryCache.shape(2.0, 3.0, 0.5, -0.5, 4.0).delegate
+        .transform(1.0, 1.0, 0.0)
+        assert(p.getX === 2.0)
+        assert(p.getY === 3.0)
+        assert(p.getZ === 0.0)
+      }
+    }
+  }
+
+/*
+Level-of-detail policy tests.
+*/
+
+  describe(classOf[LevelOfDetail].getCanonicalName) {
+    describe(".this(Double, Double, Int, Int)") {
+      it("must reject invalid arguments") {
+        intercept[IllegalArgumentException] {
+          LevelOfDetail(0.0)
+        }
+        intercept[IllegalArgumentException] {
+          LevelOfDetail(1.0, 0.0)
+        }
+        intercept[IllegalArgumentException] {
+          LevelOfDetail(1.0, 8.0, 2)
+        }
+        intercept[IllegalArgumentException] {
+          LevelOfDetail(1.0, 8.0, 16, 8)
+        }
+      }
+    }
+    describe(".divisions(Double)") {
+      it("must choose powers of two within the permitted range") {
+        val lod = LevelOfDetail(10.0, 8.0, 8, 128)
+        assert(lod.divisions(0.0) === 8)
+        assert(lod.divisions(1.0) === 8)
+        assert(lod.divisions(2.0) === 16)
+        assert(lod.divisions(5.0) === 64)
+        assert(lod.divisions(100.0) === 128)
+      }
+      it("must never choose fewer divisions for larger primitives") {
+        val lod = LevelOfDetail(7.0, 5.0, 3, 100)
+        val divisions = (0 to 200).map(r => lod.divisions(r * 0.25))
+        assert(divisions.zip(divisions.tail).forall(d => d._1 <= d._2))
+      }
+    }
+  }
+}
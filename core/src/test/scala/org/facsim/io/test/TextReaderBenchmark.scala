@@ -0,0 +1,90 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+========================================================================================================================
+Scala source file from the org.facsim.io.test package.
+*/
+
+package org.facsim.io.test
+
+import java.io.StringReader
+import org.facsim.io.TextReader
+import org.facsim.test.RegressionBenchmark
+import org.scalameter.api._
+
+/**
+Benchmark of [[org.facsim.io.TextReader!]] field parsing over large inputs.
+
+Fields read per second is given by dividing the number of fields by the reported
+time.
+*/
+
+object TextReaderBenchmark
+extends RegressionBenchmark {
+
+/**
+Numbers of fields to be read by each measurement.
+*/
+
+  val fields: Gen[Int] = Gen.exponential("fields")(10000, 1000000, 10)
+
+/**
+Whitespace-delimited integer data, with the indicated number of fields.
+*/
+
+  val intData: Gen[String] = for(n <- fields) yield {
+    (0 until n).map(i => (i * 7919 - n).toString).mkString("\n")
+  }
+
+/**
+Whitespace-delimited floating-point data, with the indicated number of fields.
+*/
+
+  val doubleData: Gen[String] = for(n <- fields) yield {
+    (0 until n).map(i => (i * 0.7919 - n).toString).mkString("\n")
+  }
+
+  performance of "TextReader" in {
+    measure method "readInt" in {
+      using(intData) in {data =>
+        val reader = new TextReader(new StringReader(data))
+        val n = data.count(_ == '\n') + 1
+        (0 until n).foreach(_ => reader.readInt())
+      }
+    }
+    measure method "readDouble" in {
+      using(doubleData) in {data =>
+        val reader = new TextReader(new StringReader(data))
+        val n = data.count(_ == '\n') + 1
+        (0 until n).foreach(_ => reader.readDouble())
+      }
+    }
+  }
+}
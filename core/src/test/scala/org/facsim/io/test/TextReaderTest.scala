@@ -34,6 +34,7 @@ Scala source file from the org.facsim.io.test package.
 package org.facsim.io.test
 
 import java.io.EOFException
+import java.io.Reader
 import java.io.StringReader
 import org.facsim.LibResource
 import org.facsim.io.FieldConversionException
@@ -144,6 +145,19 @@ fields, affect field parsing.
     val oldMacOsReader = new TextReader(oldMacOsData, testDelimiter)
   }
 
+/**
+Reader that supplies a single character per read operation, so that every
+character lies on a buffer boundary.
+*/
+
+  final class TrickleReader(data: String)
+  extends Reader {
+    private val reader = new StringReader(data)
+    override def read(buffer: Array[Char], offset: Int, length: Int): Int =
+    reader.read(buffer, offset, length.min(1))
+    override def close(): Unit = reader.close()
+  }
+
 /**
 Verify the contents of an EOF exception message.
 */
@@ -1448,5 +1462,122 @@ empty fields.
         }
       }
     }
+
+/*
+Verify that data is buffered correctly.
+*/
+
+    describe("buffering") {
+
+/*
+Line termination sequences that are split across blocks must be handled
+correctly, as must row and column numbers.
+*/
+
+      it("must handle data split across blocks") {
+        new TestData {
+          def readLines(reader: TextReader): Unit = {
+            assert(reader.readToEOL() === data)
+            assert(reader.getRow === 2)
+            assert(reader.readString()(WhitespaceDelimiter) === "a")
+            assert(reader.readInt()(WhitespaceDelimiter) === 1)
+            val e = intercept[FieldConversionException] {
+              reader.readInt()(WhitespaceDelimiter) // "1.1E1"
+            }
+            assert(e.getMessage() === LibResource("io.FieldConversion", 2, 5,
+            "1.1E1"))
+            assert(reader.readDouble()(WhitespaceDelimiter) === 1.1E1)
+            assert(reader.readToEOL() === "-1\t-1.1E-1\t 2\t3 \t 4 \t\t56fred")
+            assert(reader.readToEOL() === emptyLine)
+            assert(reader.getRow === 4)
+            assert(reader.readToEOL() === dataEnd)
+            assert(reader.atEOF)
+          }
+          readLines(new TextReader(new TrickleReader(data + "\r\n" + data +
+          "\r\n" + emptyLine + "\r\n" + dataEnd)))
+          readLines(new TextReader(new TrickleReader(rawFileData)))
+          readLines(new TextReader(new TrickleReader(data + "\r" + data + "\r"
+          + emptyLine + "\r" + dataEnd)))
+        }
+      }
+
+/*
+Fields larger than the buffer must be read, and reset, correctly.
+*/
+
+      it("must handle fields larger than its buffer") {
+        val big = "9" * 100000
+        val reader = new TextReader(new StringReader("x\n" + big + "\n1"))
+        assert(reader.readString() === "x")
+        intercept[FieldConversionException] {
+          reader.readInt()
+        }
+        assert(reader.getRow === 2)
+        assert(reader.getColumn === 1)
+        assert(reader.readString() === big)
+        assert(reader.getRow === 3)
+        assert(reader.readInt() === 1)
+      }
+
+/*
+Integer fields must be parsed from the buffer in the same way as by Java.
+*/
+
+      it("must parse integer fields correctly") {
+        val valid = Seq("0", "-0", "+5", "007", "2147483647", "-2147483648")
+        val invalid = Seq("-", "+", "2147483648", "-2147483649", "1.0", "1e3",
+        "--1", "0x10", "1_000")
+        val reader = new TextReader(new StringReader((valid ++
+        invalid).mkString(" ")))
+        valid.foreach(v => assert(reader.readInt() === v.toInt))
+        invalid.foreach {v =>
+          intercept[FieldConversionException] {
+            reader.readInt()
+          }
+          assert(reader.readString() === v)
+        }
+        val longs = new TextReader(new StringReader("9223372036854775807 " +
+        "-9223372036854775808 9223372036854775808"))
+        assert(longs.readLong() === Long.MaxValue)
+        assert(longs.readLong() === Long.MinValue)
+        intercept[FieldConversionException] {
+          longs.readLong()
+        }
+        val shorts = new TextReader(new StringReader("32767 32768 -129"))
+        assert(shorts.readShort() === Short.MaxValue)
+        intercept[FieldConversionException] {
+          shorts.readShort()
+        }
+        assert(shorts.readString() === "32768")
+        assert(shorts.readShort() === -129)
+      }
+
+/*
+Double fields must be parsed from the buffer to exactly the same value as by
+Java, whether or not they can be parsed directly.
+*/
+
+      it("must parse double fields exactly") {
+        val valid = Seq("0", "-0", "0.0", "-0.0", "1", "-1", "0.1", "-0.1",
+        ".5", "5.", "1e22", "1e23", "1E-22", "1e-23", "3.141592653589793",
+        "123456789012345", "1234567890123456", "12345678901234567890",
+        "0.000000000000000000000000001", "1.7976931348623157E308", "4.9e-324",
+        "2.2250738585072014E-308", "1e400", "1e-400", "00012.3400e+0002",
+        "NaN", "-Infinity", "0x1.8p1", "1d", "2.5f")
+        val invalid = Seq(".", "e5", "1e", "1e+", "1.2.3", "1ee2", "+")
+        val reader = new TextReader(new StringReader((valid ++
+        invalid).mkString(" ")))
+        valid.foreach {v =>
+          val x = reader.readDouble()
+          assert(java.lang.Double.compare(x, v.toDouble) === 0, v)
+        }
+        invalid.foreach {v =>
+          intercept[FieldConversionException] {
+            reader.readDouble()
+          }
+          assert(reader.readString() === v)
+        }
+      }
+    }
   }
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+Facsimile: A Discrete-Event Simulation Library
+Copyright © 2004-2020, Michael J Allen.
+
+This file is part of Facsimile.
+
+Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+version.
+
+Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see
+http://www.gnu.org/licenses/lgpl.
+
+The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+project home page at:
+
+  http://facsim.org/
+
+Thank you for your interest in the Facsimile project!
+
+IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for inclusion
+as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If your code
+fails to comply with the standard, then your patches will be rejected. For further information, please visit the coding
+standards at:
+
+  http://facsim.org/Documentation/CodingStandards/
+========================================================================================================================
+========================================================================================================================
+Scala source file from the org.facsim.test package.
+*/
+
+package org.facsim.test
+
+import java.io.File
+import org.scalameter.{Context, Key}
+import org.scalameter.api._
+
+/**
+Base class for ''Facsimile'' benchmarks, whose results are retained for
+regression testing.
+
+Each benchmark is measured in separate JVMs, and its results are persisted in
+the `benchmarks` directory (or in the directory named by the
+`facsimile.benchmarks` system property, if defined), so that they can be
+compared against those of subsequent builds. Any performance regressions are
+reported as test failures.
+*/
+
+abstract class RegressionBenchmark
+extends Bench.OfflineRegressionReport {
+
+/**
+@inheritdoc
+*/
+
+  override def defaultConfig: Context =
+  Context(Key.reports.resultDir -> RegressionBenchmark.ResultDirectory)
+
+/**
+@inheritdoc
+*/
+
+  override def persistor: Persistor =
+  new GZIPJSONSerializationPersistor(new File(RegressionBenchmark.ResultDirectory))
+}
+
+/**
+Regression benchmark companion.
+*/
+
+object RegressionBenchmark {
+
+/**
+Directory in which benchmark results are stored.
+*/
+
+  val ResultDirectory: String =
+  sys.props.getOrElse("facsimile.benchmarks", "benchmarks")
+}
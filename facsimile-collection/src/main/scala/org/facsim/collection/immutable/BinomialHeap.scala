@@ -37,7 +37,7 @@
 package org.facsim.collection.immutable
 
 import scala.annotation.tailrec
-import scala.reflect.runtime.universe._
+import scala.reflect.ClassTag
 
 /** Immutable ''[[https://en.wikipedia.org/wiki/Binomial_heap binomial heap]]'' container.
  *
@@ -53,7 +53,7 @@ import scala.reflect.runtime.universe._
  *
  *  @param ordering Ordering allowing elements of type `A` to be compared.
  *
- *  @param typeTag Actual type of `A`.
+ *  @param classTag Runtime class of `A`, used to distinguish heaps holding different element types.
  *
  *  @see ''[[https://en.wikipedia.org/wiki/Binomial_heap Binomial heap on Wikipedia]]''.
  *
@@ -62,7 +62,7 @@ import scala.reflect.runtime.universe._
  *  @since 0.0
  */
 final class BinomialHeap[A] private(private val rootTree: BinomialTree[A])(implicit private val ordering: Ordering[A],
-implicit private val typeTag: TypeTag[A])
+implicit private val classTag: ClassTag[A])
 extends Heap[A, BinomialHeap[A]] {
 
   /** Cached minimum value and heap remainder.
@@ -95,6 +95,25 @@ extends Heap[A, BinomialHeap[A]] {
     new BinomialHeap(meld(rootTree, h.rootTree))
   }
 
+  /** Add a number of elements to this heap.
+   *
+   *  The elements are inserted directly into the heap's root tree, so that only a single new heap instance is created,
+   *  regardless of the number of elements added.
+   *
+   *  @param as Elements to be added to this heap.
+   *
+   *  @return New heap containing the elements of this heap, together with `as`.
+   *
+   *  @note Adding ''k'' elements takes ''O(k + ''log'' n)'' time.
+   *
+   *  @since 0.3
+   */
+  def ++(as: IterableOnce[A]): BinomialHeap[A] = {
+    val it = as.iterator
+    if(it.isEmpty) this
+    else new BinomialHeap(it.foldLeft(rootTree)((t, a) => insert(BinomialTreeNode(a, 0, Nil), t)))
+  }
+
   /** @inheritdoc
    *
    *  @note Identifying the heap minimum value takes ''Θ(''log'' n)'' time.
@@ -275,8 +294,9 @@ extends Heap[A, BinomialHeap[A]] {
 
     // If that is a heap of type H (i.e. the same type as this heap), then we can compare the two for equality.
     //
-    // NOTE: This requires a direct comparison of the types of the two heaps, which we obtain through reflection.
-    case other: BinomialHeap[A] => typeTag.tpe =:= other.typeTag.tpe
+    // NOTE: This requires a comparison of the element types of the two heaps, which we obtain from their class tags.
+    // Since type arguments of the element types are erased, heaps of List[Int] and List[String] can be compared.
+    case other: BinomialHeap[A] => classTag == other.classTag
 
     // If that is anything else (a different type of heap, or a different object altogether), then we cannot compare for
     // equality.
@@ -363,11 +383,13 @@ object BinomialHeap {
    *
    *  @param ordering Ordering allowing elements of type `A` to be compared.
    *
+   *  @param classTag Runtime class of `A`.
+   *
    *  @return Empty heap.
    *
    *  @since 0.0
    */
-  def empty[A: TypeTag](implicit ordering: Ordering[A]): BinomialHeap[A] = new BinomialHeap[A](Nil)
+  def empty[A](implicit ordering: Ordering[A], classTag: ClassTag[A]): BinomialHeap[A] = new BinomialHeap[A](Nil)
 
   /** Create a new heap containing the specified elements.
    *
@@ -377,11 +399,13 @@ object BinomialHeap {
    *
    *  @param ordering Ordering allowing elements of type `A` to be compared.
    *
+   *  @param classTag Runtime class of `A`.
+   *
    *  @return New heap containing the specified elements.
    *
+   *  @note Heap construction takes ''O(n)'' time.
+   *
    *  @since 0.0
    */
-  def apply[A: TypeTag](as: A*)(implicit ordering: Ordering[A]): BinomialHeap[A] = {
-    as.foldLeft(empty[A])((h, a) => h + a)
-  }
+  def apply[A](as: A*)(implicit ordering: Ordering[A], classTag: ClassTag[A]): BinomialHeap[A] = empty[A] ++ as
 }
@@ -0,0 +1,101 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.collection.immutable.test package.
+//======================================================================================================================
+package org.facsim.collection.immutable.test
+
+import org.facsim.collection.immutable.BinomialHeap
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+import scala.util.Random
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Benchmark of the principal `[[org.facsim.collection.immutable.BinomialHeap BinomialHeap]]` operations.
+ *
+ *  Elements are pseudo-random integers, generated from a fixed seed, so that each run measures the same operations.
+ */
+object BinomialHeapBenchmark
+extends RegressionBenchmark {
+
+  /** Seed of the generator of heap elements. */
+  val Seed = 1234L
+
+  /** Heap sizes to be benchmarked. */
+  val sizes: Gen[Int] = Gen.exponential("size")(1000, 1000000, 10)
+
+  /** Elements to be inserted into heaps of each size. */
+  val elements: Gen[Vector[Int]] = for(n <- sizes) yield {
+    val r = new Random(Seed)
+    Vector.fill(n)(r.nextInt())
+  }
+
+  /** Heaps of each size. */
+  val heaps: Gen[BinomialHeap[Int]] = for(es <- elements) yield BinomialHeap.empty[Int] ++ es
+
+  /** Pairs of distinct heaps of each size. */
+  val heapPairs: Gen[(BinomialHeap[Int], BinomialHeap[Int])] = for(es <- elements) yield {
+    (BinomialHeap.empty[Int] ++ es, BinomialHeap.empty[Int] ++ es.map(~_))
+  }
+
+  performance of "BinomialHeap" in {
+    measure method "+" in {
+      using(elements) in {es =>
+        es.foldLeft(BinomialHeap.empty[Int])(_ + _)
+      }
+    }
+    measure method "minimumRemove" in {
+      using(heaps) in {h =>
+
+        // Remove every element of the heap.
+        var rem = h //scalastyle:ignore var.local
+        while(rem.nonEmpty) rem = rem.minimumRemove._2 //scalastyle:ignore while
+      }
+    }
+    measure method "++ (meld)" in {
+      using(heapPairs) in {
+        case (h1, h2) => h1 ++ h2
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
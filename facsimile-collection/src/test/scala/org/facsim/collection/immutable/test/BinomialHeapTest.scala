@@ -355,6 +355,27 @@ with ScalaCheckPropertyChecks {
         }
       }
     }
+
+    // Test the bulk insertion operator.
+    describe(".++(IterableOnce[A])") {
+
+      // Adding no elements must leave the heap unchanged.
+      it("must return the same heap if no elements are added") {
+        forAll {li: List[Int] =>
+          val h = BinomialHeap(li: _*)
+          assert((h ++ Nil) eq h)
+        }
+      }
+
+      // It must add all of the elements to the heap.
+      it("must create a new heap containing the original and added elements") {
+        forAll {(l1: List[Int], l2: List[Int]) =>
+          val h = BinomialHeap(l1: _*) ++ l2
+          verifyMultiMemberHeap(h, l1 ::: l2)
+          assert(h === l2.foldLeft(BinomialHeap(l1: _*))(_ + _))
+        }
+      }
+    }
   }
 }
 
@@ -35,13 +35,15 @@
 package org.facsim.sfx.importers.cell
 
 import java.io.InputStream
+import java.nio.ByteBuffer
+import java.nio.file.Path
 import javafx.geometry.Point3D
 import javafx.scene.Node
 import javafx.scene.paint.Material
 import javafx.scene.transform._
-import org.facsim.util.parse.BaseParser
+import org.facsim.util.parse.{BaseParser, ByteBufferInput}
 import org.parboiled2._
-import scala.util.Try
+import scala.util.{Failure, Try}
 import shapeless.PolyDefns.~>
 
 /** Parser for ''AutoMod® cell''-format 3D scenegraph files.
@@ -69,8 +71,9 @@ import shapeless.PolyDefns.~>
  *
  *  Traditionally, ''cell'' files were 7-bit US ''ASCII'' encoded files. However, ''cell'' files can now contain text
  *  encoded in ''UTF-8'' form, and should be processed as such. There is no formal method for specifying file encoding
- *  within a ''cell'' scene. This parser assumes that the input has been decoded, and so represents natural _Java_
- *  strings; input should not be initialized from a raw byte array.
+ *  within a ''cell'' scene. Input may either be supplied as a decoded string, or as raw ''UTF-8'' bytes via a
+ *  [[org.facsim.util.parse.ByteBufferInput]]; the latter allows large ''cell'' scenes to be parsed directly from a
+ *  memory-mapped file, without first decoding them into a string.
  *
  *  @constructor Construct a ''Parboiled2'' parser for an ''AutoMod® cell''-format 3D scene.
  *
@@ -78,7 +81,7 @@ import shapeless.PolyDefns.~>
  *
  *  @param colorScheme Color scheme to be employed for the ''cell'' scene's colors.
  */
-private[cell] final class CellParser(input: ParserInput, colorScheme: CellColorScheme)
+private[cell] final class CellParser(override val input: ParserInput, colorScheme: CellColorScheme)
 extends BaseParser {
 
   /** Rule to process a ''cell'' Boolean field.
@@ -642,9 +645,24 @@ extends BaseParser {
  */
 object CellParser {
 
+  /** Parse an input stream containing an ''AutoMod cell'' scene definition, using the default ''JavaFX'' color scheme.
+   *
+   *  @param is Input stream to be parsed as a ''cell format'' scene. The stream is read to its end, but is not closed.
+   *
+   *  @return Parsed ''JavaFX'' [[javafx.scene.Node]], as for the overload taking a color scheme.
+   *
+   *  @since 0.0
+   */
+  def apply(is: InputStream): Try[Node] = apply(is, JFXCellColorScheme)
+
   /** Parse an input stream containing an ''AutoMod cell'' scene definition.
    *
-   *  @param is Input stream to be parsed as a ''cell format'' scene.
+   *  The stream's contents are read as raw bytes and parsed directly, without being decoded into a string. To parse a
+   *  large ''cell'' file without holding its contents on the heap, use the `Path` overload instead.
+   *
+   *  @param is Input stream to be parsed as a ''cell format'' scene. The stream is read to its end, but is not closed.
+   *
+   *  @param colorScheme Color scheme to be employed for the ''cell'' scene's colors.
    *
    *  @return ''JavaFX'' [[javafx.scene.Node]] wrapped in a [[scala.util.Success]] containing the equivalent ''JavaFX''
    *  scene, if `is` was parsed successfully, or a failure exception wrapped in a [[scala.util.Failure]] otherwise. In
@@ -653,17 +671,56 @@ object CellParser {
    *
    *  @since 0.0
    */
-  def apply(is: InputStream): Try[Node] = {
+  def apply(is: InputStream, colorScheme: CellColorScheme): Try[Node] = {
+    Try(ByteBuffer.wrap(is.readAllBytes())).flatMap(b => parse(new ByteBufferInput(b), colorScheme))
+  }
 
-    ??? // TODO: Convert input stream to a byte array.
-    val bs = Array[Byte]()
-    new CellParser(is).cellScene.run()
+  /** Parse a file containing an ''AutoMod cell'' scene definition, using the default ''JavaFX'' color scheme.
+   *
+   *  @param path Path of the file to be parsed as a ''cell format'' scene.
+   *
+   *  @return Parsed ''JavaFX'' [[javafx.scene.Node]], as for the overload taking a color scheme.
+   *
+   *  @since 0.3
+   */
+  def apply(path: Path): Try[Node] = apply(path, JFXCellColorScheme)
+
+  /** Parse a file containing an ''AutoMod cell'' scene definition.
+   *
+   *  The file is memory-mapped and parsed directly from the mapping, so that heap use does not grow with the size of
+   *  the file.
+   *
+   *  @param path Path of the file to be parsed as a ''cell format'' scene.
+   *
+   *  @param colorScheme Color scheme to be employed for the ''cell'' scene's colors.
+   *
+   *  @return ''JavaFX'' [[javafx.scene.Node]] wrapped in a [[scala.util.Success]] containing the equivalent ''JavaFX''
+   *  scene, if the file was parsed successfully, or a failure exception wrapped in a [[scala.util.Failure]] otherwise.
+   *  In the latter case, an exception will describe the cause of the failure and indicate the line and column of the
+   *  file at which the parser failed.
+   *
+   *  @since 0.3
+   */
+  def apply(path: Path, colorScheme: CellColorScheme): Try[Node] = {
+    Try(ByteBufferInput.map(path)).flatMap(parse(_, colorScheme))
   }
 
+  /** Parse a string containing an ''AutoMod cell'' scene definition, using the default ''JavaFX'' color scheme.
+   *
+   *  @param s String to be parsed as a ''cell format'' scene.
+   *
+   *  @return Parsed ''JavaFX'' [[javafx.scene.Node]], as for the overload taking a color scheme.
+   *
+   *  @since 0.0
+   */
+  def apply(s: String): Try[Node] = apply(s, JFXCellColorScheme)
+
   /** Parse a string containing an ''AutoMod cell'' scene definition.
    *
    *  @param s String to be parsed as a ''cell format'' scene.
    *
+   *  @param colorScheme Color scheme to be employed for the ''cell'' scene's colors.
+   *
    *  @return ''JavaFX'' [[javafx.scene.Node]] wrapped in a [[scala.util.Success]] containing the equivalent ''JavaFX''
    *  scene, if `is` was parsed successfully, or a failure exception wrapped in a [[scala.util.Failure]] otherwise. In
    *  the latter case, an exception will describe the cause of the failure and indicate where in the stream the parser
@@ -671,7 +728,28 @@ object CellParser {
    *
    *  @since 0.0
    */
-  def apply(s: String): Try[Node] = new CellParser(s).cellScene.run()
+  def apply(s: String, colorScheme: CellColorScheme): Try[Node] = {
+    parse(ParserInput(s), colorScheme)
+  }
+
+  /** Parse a ''cell'' scene from the specified input.
+   *
+   *  Parse errors are reported as exceptions whose messages identify the line and column at which the error occurred,
+   *  together with the offending line and the input that was expected.
+   *
+   *  @param input Input to be parsed as a ''cell format'' scene.
+   *
+   *  @param colorScheme Color scheme to be employed for the ''cell'' scene's colors.
+   *
+   *  @return Equivalent ''JavaFX'' scene wrapped in [[scala.util.Success]], or a failure exception wrapped in a
+   *  [[scala.util.Failure]].
+   */
+  private def parse(input: ParserInput, colorScheme: CellColorScheme): Try[Node] = {
+    val parser = new CellParser(input, colorScheme)
+    parser.cellScene.run().recoverWith {
+      case e: ParseError => Failure(new IllegalArgumentException(parser.formatError(e), e))
+    }
+  }
 
   /** X-, Y- then Z-axis rotation order. */
   private val XYZ = 0
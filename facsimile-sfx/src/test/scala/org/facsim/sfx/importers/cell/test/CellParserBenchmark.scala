@@ -0,0 +1,103 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sfx.importers.cell.test package.
+//======================================================================================================================
+package org.facsim.sfx.importers.cell.test
+
+import java.nio.charset.Charset
+import java.nio.file.{Files, Path, Paths}
+import org.facsim.sfx.importers.cell.CellParser
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Benchmark of `[[org.facsim.sfx.importers.cell.CellParser CellParser]]` parsing of ''AutoMod® cell'' files.
+ *
+ *  Each measurement parses a file from the `cellFiles` test resource corpus of the legacy core tree, so that results
+ *  can be compared directly with those of the core tree's `CellLoaderBenchmark`. Files are parsed both from a string,
+ *  read before measurement begins, and from their paths.
+ *
+ *  The corpus is located in the directory named by the `facsimile.cellFiles` system property, if defined, or in the
+ *  core tree's test resources, relative to this project's directory, otherwise.
+ */
+object CellParserBenchmark
+extends RegressionBenchmark {
+
+  /** Name of the system property identifying the directory holding the cell file corpus. */
+  val CorpusDirectoryProperty = "facsimile.cellFiles"
+
+  /** Directory holding the cell file corpus. */
+  val corpus: Path = Paths.get(sys.props.getOrElse(CorpusDirectoryProperty, "../core/src/test/resources/cellFiles"))
+
+  /** Paths of the cell files to be parsed. */
+  val files: Gen[Path] = Gen.enumeration("file")(
+    "ArcFine.cell",
+    "CircleFineSolid.cell",
+    "ConeFine.cell",
+    "CylinderFine.cell",
+    "FrustumFine.cell",
+    "HemisphereFine.cell",
+    "SectorFine.cell",
+    "Tetrahedron.cell",
+    "Trapezoid.cell",
+    "Triad.cell",
+    "WorldText.cell"
+  ).map(corpus.resolve)
+
+  /** Contents of the cell files to be parsed, decoded using the character set employed by ''AutoMod''. */
+  val contents: Gen[String] = files.map(p => new String(Files.readAllBytes(p), Charset.forName("windows-1252")))
+
+  performance of "CellParser" in {
+    measure method "apply(String)" in {
+      using(contents) in {s =>
+        CellParser(s).get
+      }
+    }
+    measure method "apply(Path)" in {
+      using(files) in {p =>
+        CellParser(p).get
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
@@ -38,6 +38,7 @@ package org.facsim.sim.application
 
 import java.io.File
 import org.facsim.sim.LibResource
+import org.facsim.stat.prng.SimplePRNG
 import org.facsim.util.log.Severity
 import org.facsim.util.{LS, SQ}
 import scopt.OptionParser
@@ -89,6 +90,18 @@ private[application] final class CLIParser(appName: String, appCopyright: Seq[St
       c.copy(configFile = Some(f))
     }
 
+    // Option to run the simulation's warm-up period just once, forking all replications from the warmed-up state.
+    //
+    // For models with long warm-up periods, this can save a great deal of execution time. Each replication still has
+    // its own random number stream, which takes effect from the end of the warm-up period.
+    opt[Unit]('f', "fork-warm-up")
+    .text(LibResource("application.CLIParser.ForkWarmUpText"))
+    .optional
+    .maxOccurs(1)
+    .action {(_, c) =>
+      c.copy(forkWarmUp = true)
+    }
+
     // Option to run the simulation in "headless" mode, without a GUI interface.
     //
     // If this option is provided, then the simulation will not produce a graphical user interface (GUI) for the
@@ -117,6 +130,31 @@ private[application] final class CLIParser(appName: String, appCopyright: Seq[St
       c.copy(runModel = false, showUsage = true)
     }
 
+    // Option to instrument the simulation engine, measuring the performance of each type of action dispatched.
+    //
+    // Instrumentation has a small effect on execution time, so it is off by default. A summary of the measurements is
+    // written to the report file, if there is one, or to the standard output otherwise.
+    opt[Unit]('i', "instrument")
+    .text(LibResource("application.CLIParser.InstrumentText"))
+    .optional
+    .maxOccurs(1)
+    .action {(_, c) =>
+      c.copy(instrument = true)
+    }
+
+    // Option defining a file holding a previously saved, warmed-up simulation state, from which all replications are
+    // forked.
+    //
+    // Note: The file argument should not be validated until we attempt to open it.
+    opt[File]('w', "load-warm-up")
+    .valueName(CLIParser.FileValueName)
+    .text(LibResource("application.CLIParser.LoadWarmUpText"))
+    .optional
+    .maxOccurs(1)
+    .action {(f, c) =>
+      c.copy(forkWarmUp = true, loadWarmUp = Some(f))
+    }
+
     // Option defining the output file for writing simulation log messages.
     //
     // This option is not necessary to run the simulation. Only a single log file may be specified.
@@ -156,6 +194,23 @@ private[application] final class CLIParser(appName: String, appCopyright: Seq[St
       c.copy(logLevel = Severity.withName(sl).get)
     }
 
+    // Option defining the number of independent replications of the simulation to be run.
+    //
+    // Each replication is assigned its own random number stream, so the number of replications is limited by the
+    // number of available streams.
+    opt[Int]('n', "replications")
+    .valueName(CLIParser.CountValueName)
+    .text(LibResource("application.CLIParser.ReplicationsText", FacsimileConfig().replications))
+    .optional
+    .maxOccurs(1)
+    .validate {n =>
+      if(n > 0 && n <= SimplePRNG.StreamCount) success
+      else failure(LibResource("application.CLIParser.ReplicationsFailure", n, SimplePRNG.StreamCount))
+    }
+    .action {(n, c) =>
+      c.copy(replications = n)
+    }
+
     // Option defining the report output file for this simulation run.
     //
     // This option is not necessary to run the simulation. Only a single report file may be specified.
@@ -175,6 +230,33 @@ private[application] final class CLIParser(appName: String, appCopyright: Seq[St
       c.copy(reportFile = Some(f))
     }
 
+    // Option defining a file into which the warmed-up simulation state is saved, so that later runs can skip the
+    // warm-up period entirely.
+    //
+    // Note: The file argument should not be validated until we attempt to open it.
+    opt[File]('s', "save-warm-up")
+    .valueName(CLIParser.FileValueName)
+    .text(LibResource("application.CLIParser.SaveWarmUpText"))
+    .optional
+    .maxOccurs(1)
+    .action {(f, c) =>
+      c.copy(forkWarmUp = true, saveWarmUp = Some(f))
+    }
+
+    // Option defining the maximum number of threads employed to run replications concurrently.
+    opt[Int]('t', "threads")
+    .valueName(CLIParser.CountValueName)
+    .text(LibResource("application.CLIParser.ThreadsText"))
+    .optional
+    .maxOccurs(1)
+    .validate {t =>
+      if(t > 0) success
+      else failure(LibResource("application.CLIParser.ThreadsFailure", t))
+    }
+    .action {(t, c) =>
+      c.copy(threads = t)
+    }
+
     // Option to provide application version information and immediately exit.
     //
     // Note: This is defined as an option, instead of using the built-in Scopt "version" definition, in order to better
@@ -218,6 +300,9 @@ private[application] final class CLIParser(appName: String, appCopyright: Seq[St
 /** Command line interpreter parser companion object. */
 private object CLIParser {
 
+  /** Value description to output for a command line count option. */
+  private val CountValueName = LibResource("application.CLIParser.CountValueName")
+
   /** Value description to output for a command line file parameter or option. */
   private val FileValueName = LibResource("application.CLIParser.FileValueName")
 }
\ No newline at end of file
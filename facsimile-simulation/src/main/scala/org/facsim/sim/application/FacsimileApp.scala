@@ -36,18 +36,24 @@
 //======================================================================================================================
 package org.facsim.sim.application
 
+import com.typesafe.config.Config
+import java.io.{File, PrintWriter}
+import java.nio.charset.StandardCharsets
 import java.util.jar.Attributes.Name
 import org.facsim.sim.LibResource
+import org.facsim.sim.engine.{ReplicationSummary, Replications}
+import org.facsim.stat.prng.SimplePRNG
 import org.facsim.util.{Manifest, NonPure, Version}
-import scala.annotation.unused
+import scala.util.Try
 
 /** Base class for a ''Facsimile'' application.
  *
  *  ''Facsimile'' applications commence as command line/non-graphical programs. However, if required, a GUI interface
  *  for the model is created, which also provides a ''3D'' animation of the simulation.
  *
- *  @note ''Facsimile'' applications perform one run of a specific simulation configuration; ''Facsimile'' is not a
- *  simulation model editing environment, but a library for writing simulation models.
+ *  @note ''Facsimile'' applications perform one run of a specific simulation configuration, made up of one or more
+ *  independent replications; ''Facsimile'' is not a simulation model editing environment, but a library for writing
+ *  simulation models.
  *
  *  @since 0.2
  */
@@ -173,12 +179,90 @@ extends App {
     }
   }
 
+  /** Run a single replication of the simulation model.
+   *
+   *  Replications may be run concurrently, on different threads, and so must not share any mutable state. Typically,
+   *  each replication creates and runs its own `[[org.facsim.sim.engine.Simulation Simulation]]` instance.
+   *
+   *  By default, a replication does nothing and reports no statistics, so that applications that do not override this
+   *  method run as they did before replications were supported.
+   *
+   *  @param replication Number of this replication, starting from 0.
+   *
+   *  @param prng Random number generator, positioned at the start of this replication's own random number stream.
+   *
+   *  @param parameters Configuration of this simulation run.
+   *
+   *  @return Values of the statistics, keyed by name, reported by this replication. A confidence interval for the mean
+   *  of each statistic is reported once all replications have completed.
+   *
+   *  @since 0.3
+   */
+  protected def replicate(replication: Int, prng: SimplePRNG, parameters: Config): Map[String, Double] = Map.empty
+
+  /** Run the configured replications of the simulation model.
+   *
+   *  By default, each replication is run by `[[replicate]]`, on its own random number stream.
+   *
+   *  @param config Configuration for this simulation run.
+   *
+   *  @return Summary of the statistics reported by the replications, together with any further lines to be written to
+   *  the report after the confidence intervals, wrapped in a `[[scala.util.Success Success]]`, if all replications
+   *  succeeded; the first failure to occur, wrapped in a `[[scala.util.Failure Failure]]`, otherwise.
+   */
+  @NonPure
+  private[application] def runReplications(config: FacsimileConfig): Try[(ReplicationSummary, Seq[String])] = {
+
+    // Resolve the configuration before any replications start, so that configuration errors are reported up front.
+    val parameters = config.parameters
+    Replications.run(config.replications, config.threads, config.seed) {(r, prng) =>
+      replicate(r, prng, parameters)
+    }.map((_, Nil))
+  }
+
   /** Run the simulation model.
+   *
+   *  The configured number of replications are run, concurrently, and a confidence interval for each of the statistics
+   *  they report is written to the report file, or to the standard output if there is no report file.
    *
    *  @param config Configuration for this simulation run.
    */
-  private def runModel(@unused config: FacsimileConfig): Unit = { // Temporary: config is marked unused to avoid error
+  @NonPure
+  private def runModel(config: FacsimileConfig): Unit = {
 
+    // Run the replications, re-throwing the first failure (if any) to be reported by the caller.
+    val (summary, further) = runReplications(config).get
+
+    // Report the confidence intervals, sorted by statistic name, followed by any further report lines.
+    val intervals = summary.intervals.toSeq.sortBy(_._1).map {
+      case (name, ci) => {
+        LibResource("application.FacsimileApp.Interval", name, ci.mean, ci.halfWidth, ci.level, ci.size)
+      }
+    }
+    writeReport(config.reportFile, intervals ++ further).get
+  }
+
+  /** Write the report of a simulation run.
+   *
+   *  @param reportFile Report file to which the report is to be written, wrapped in `[[scala.Some Some]]`, or
+   *  `[[scala.None None]]` if the report is to be written to the standard output.
+   *
+   *  @param lines Lines of the report.
+   *
+   *  @return `Unit`, wrapped in a `[[scala.util.Success Success]]`, if the report was written successfully; an
+   *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   */
+  @NonPure
+  private def writeReport(reportFile: Option[File], lines: Seq[String]): Try[Unit] = Try {
+    reportFile.fold(lines.foreach(println)) {f =>
+      val out = new PrintWriter(f, StandardCharsets.UTF_8.name)
+      try {
+        lines.foreach(line => out.println(line))
+      }
+      finally {
+        out.close()
+      }
+    }
   }
 }
 
@@ -36,8 +36,10 @@
 //======================================================================================================================
 package org.facsim.sim.application
 
-import com.typesafe.config.{Config, ConfigFactory}
+import com.typesafe.config.{Config, ConfigException, ConfigFactory}
 import java.io.File
+import org.facsim.sim.LibResource
+import org.facsim.sim.engine.EventCalendarType
 import org.facsim.util.log.{Severity, WarningSeverity}
 import squants.time.{Seconds, Time}
 
@@ -58,6 +60,17 @@ import squants.time.{Seconds, Time}
  *  Some]]`, or `[[scala.None None]]` if the simulation is to solely use command line ''Java''-style configuration
  *  properties and/or default configuration values.
  *
+ *  @param forkWarmUp Flag indicating whether the simulation's warm-up period should be run just once, with all
+ *  replications starting from the resulting warmed-up simulation state. By default, each replication performs its own
+ *  warm-up.
+ *
+ *  @param instrument Flag indicating whether the simulation engine should be instrumented, measuring the performance
+ *  of each type of action dispatched. By default, the engine is not instrumented.
+ *
+ *  @param loadWarmUp File from which a previously saved warmed-up simulation state is to be loaded, wrapped in
+ *  `[[scala.Some Some]]`, or `[[scala.None None]]` if the warm-up period is to be simulated. If defined, `forkWarmUp`
+ *  must be `true`.
+ *
  *  @param logFile File into which log information should be written, wrapped in `[[scala.Some  Some]]`, or
  *  `[[scala.None None]]` if the simulation should not write any log information.
  *
@@ -65,24 +78,34 @@ import squants.time.{Seconds, Time}
  *  severity level will be written into the log file. If `useGui` is false, this also defines the log level for writing
  *  log messages to the standard output.
  *
+ *  @param replications Number of independent replications of the simulation to be run.
+ *
  *  @param reportFile Simulation report file to be generated by this run, wrapped in `[[scala.Some Some]]`, or
  *  `[[scala.None None]]` if the simulation is not to issue a report for this run.
  *
  *  @param runModel Flag indicating whether the program should run this simulation. Typically, this will not happen if
  *  the user has requested the program version or help information; otherwise the simulation should be run.
  *
+ *  @param saveWarmUp File into which the warmed-up simulation state is to be saved, wrapped in `[[scala.Some Some]]`,
+ *  or `[[scala.None None]]` if it is not to be saved. If defined, `forkWarmUp` must be `true`.
+ *
  *  @param showVersion Flag indicating whether program version information should be displayed at the start of the run.
  *  By default, no version information will be displayed.
  *
  *  @param showUsage Flag indicating whether program usage information should be displayed at the start of the run. By
  *  default, no usage information will be displayed.
  *
+ *  @param threads Maximum number of threads to be employed to run replications concurrently. By default, this is the
+ *  number of processors available to the ''Java'' virtual machine.
+ *
  *  @param useGUI Flag indicating whether a ''graphical user interface'' (''GUI'') is to be utilized to control and view
  *  the simulation.
  */
-private[application] final case class FacsimileConfig(configFile: Option[File] = None, logFile: Option[File] = None,
-logLevel: Severity = WarningSeverity, reportFile: Option[File] = None, runModel: Boolean = true,
-showVersion: Boolean = false, showUsage: Boolean = false, useGUI: Boolean = true) {
+private[application] final case class FacsimileConfig(configFile: Option[File] = None, forkWarmUp: Boolean = false,
+instrument: Boolean = false, loadWarmUp: Option[File] = None, logFile: Option[File] = None,
+logLevel: Severity = WarningSeverity, replications: Int = 1, reportFile: Option[File] = None, runModel: Boolean = true,
+saveWarmUp: Option[File] = None, showVersion: Boolean = false, showUsage: Boolean = false,
+threads: Int = Runtime.getRuntime.availableProcessors, useGUI: Boolean = true) {
 
   /** Retrieve this simulation run's parameters.
    *
@@ -104,31 +127,13 @@ showVersion: Boolean = false, showUsage: Boolean = false, useGUI: Boolean = true
    */
   def parameters: Config = params
 
-  /** Retrieve a parameter value as a string, converting to a time value.
-   *
-   *  @param path Path defining location of the parameter in the configuration.
-   *
-   *  @return Parameter parsed as a time value.
-   *
-   *  @throws com.typesafe.config.ConfigException if `path` does not identify a parameter, or if it cannot be resolved
-   *  as a string.
-   */
-  private def timeParameter(path: String): Time = {
-
-    // Retrieve the value as a string.
-    val t = params.getString(path)
-
-    // Convert the result to a time and return.
-    Time.parseString(t).get
-  }
-
   /** Report the configured warm-up duration.
    *
    *  @return Configured simulation warm-up duration.
    *
    *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
    */
-  def warmUpDuration: Time = timeParameter(FacsimileConfig.WarmUpDurationName) ensuring(_ > Seconds(0.0))
+  def warmUpDuration: Time = FacsimileConfig.warmUpDuration(params)
 
   /** Report the configured snap duration.
    *
@@ -136,7 +141,7 @@ showVersion: Boolean = false, showUsage: Boolean = false, useGUI: Boolean = true
    *
    *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
    */
-  def snapDuration: Time = timeParameter(FacsimileConfig.SnapDurationName) ensuring(_ > Seconds(0.0))
+  def snapDuration: Time = FacsimileConfig.snapDuration(params)
 
   /** Report the configured snap count.
    *
@@ -144,7 +149,32 @@ showVersion: Boolean = false, showUsage: Boolean = false, useGUI: Boolean = true
    *
    *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
    */
-  def snapCount: Int = params.getInt(FacsimileConfig.SnapCountName) ensuring(_ > 0)
+  def snapCount: Int = FacsimileConfig.snapCount(params)
+
+  /** Report the configured random number seed.
+   *
+   *  @return Configured seed, from which the random number stream of each replication is derived.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  def seed: Long = params.getLong(FacsimileConfig.SeedName)
+
+  /** Report the configured simulation clock resolution.
+   *
+   *  @return Configured simulation time resolution.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  def timeResolution: Time = FacsimileConfig.timeResolution(params)
+
+  /** Report the configured event queue (event calendar) type.
+   *
+   *  @return Configured simulation event calendar type.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified, or if it
+   *  does not name a valid event calendar type.
+   */
+  def eventCalendar: EventCalendarType = FacsimileConfig.eventCalendar(params)
 }
 
 /** Facsimile configuration companion object. */
@@ -161,4 +191,96 @@ private object FacsimileConfig {
 
   /** Name of the snap count parameter. */
   private val SnapCountName = s"${BaseName}snap-count"
-}
\ No newline at end of file
+
+  /** Name of the random number seed parameter. */
+  private val SeedName = s"${BaseName}seed"
+
+  /** Name of the time resolution parameter. */
+  private val TimeResolutionName = s"${BaseName}time-resolution"
+
+  /** Name of the event queue parameter. */
+  private val EventQueueName = s"${BaseName}event-queue"
+
+  /** Retrieve a parameter value as a string, converting to a time value.
+   *
+   *  @param params Configuration from which the parameter is to be retrieved.
+   *
+   *  @param path Path defining location of the parameter in the configuration.
+   *
+   *  @return Parameter parsed as a time value.
+   *
+   *  @throws com.typesafe.config.ConfigException if `path` does not identify a parameter, or if it cannot be resolved
+   *  as a string.
+   */
+  private def timeParameter(params: Config, path: String): Time = {
+
+    // Retrieve the value as a string.
+    val t = params.getString(path)
+
+    // Convert the result to a time and return.
+    Time.parseString(t).get
+  }
+
+  /** Report the warm-up duration defined by a configuration.
+   *
+   *  @param params Configuration of the simulation run.
+   *
+   *  @return Configured simulation warm-up duration.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  private[application] def warmUpDuration(params: Config): Time = {
+    timeParameter(params, WarmUpDurationName) ensuring(_ > Seconds(0.0))
+  }
+
+  /** Report the snap duration defined by a configuration.
+   *
+   *  @param params Configuration of the simulation run.
+   *
+   *  @return Configured simulation snap duration.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  private[application] def snapDuration(params: Config): Time = {
+    timeParameter(params, SnapDurationName) ensuring(_ > Seconds(0.0))
+  }
+
+  /** Report the snap count defined by a configuration.
+   *
+   *  @param params Configuration of the simulation run.
+   *
+   *  @return Configured simulation snap count.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  private[application] def snapCount(params: Config): Int = params.getInt(SnapCountName) ensuring(_ > 0)
+
+  /** Report the simulation clock resolution defined by a configuration.
+   *
+   *  @param params Configuration of the simulation run.
+   *
+   *  @return Configured simulation time resolution.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified.
+   */
+  private[application] def timeResolution(params: Config): Time = {
+    timeParameter(params, TimeResolutionName) ensuring(_ > Seconds(0.0))
+  }
+
+  /** Report the event queue (event calendar) type defined by a configuration.
+   *
+   *  @param params Configuration of the simulation run.
+   *
+   *  @return Configured simulation event calendar type.
+   *
+   *  @throws com.typesafe.config.ConfigException if corresponding configuration item cannot be identified, or if it
+   *  does not name a valid event calendar type.
+   */
+  private[application] def eventCalendar(params: Config): EventCalendarType = {
+    EventCalendarType.fromConfigValue(params.getString(EventQueueName)).getOrElse {
+      val valid = EventCalendarType.values.map(_.configValue).mkString(", ")
+      val msg = LibResource("application.FacsimileConfig.BadEventQueue", valid)
+      throw new ConfigException.BadValue(EventQueueName, msg)
+    }
+  }
+}
@@ -0,0 +1,248 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.application package.
+//======================================================================================================================
+package org.facsim.sim.application
+
+import akka.stream.QueueOfferResult
+import com.typesafe.config.Config
+import java.util.concurrent.atomic.AtomicReference
+import org.facsim.sim.LibResource
+import org.facsim.sim.engine.{Instrumentation, InstrumentationReport, ReplicationSummary, Replications, Simulation,
+SimulationSnapshot, SimulationState}
+import org.facsim.sim.model.{Action, ModelState}
+import org.facsim.stat.prng.SimplePRNG
+import org.facsim.util.NonPure
+import org.facsim.util.log.LogStream
+import scala.concurrent.Await
+import scala.concurrent.duration.Duration
+import scala.util.{Failure, Success, Try}
+
+/** Base class for a ''Facsimile'' application that runs a single simulation model.
+ *
+ *  Each replication runs its own `[[org.facsim.sim.engine.Simulation Simulation]]`, configured from the run's
+ *  parameters, reporting statistics derived from the final model state.
+ *
+ *  If the `--fork-warm-up` option is specified, then the warm-up period is simulated just once (or loaded from a file,
+ *  if `--load-warm-up` is also specified), and every replication is resumed from the resulting warmed-up state, with
+ *  its model state reseeded to use the replication's own random number stream. The warm-up itself employs the last
+ *  available stream, `[[org.facsim.stat.prng.SimplePRNG.StreamCount SimplePRNG.StreamCount]] - 1`.
+ *
+ *  If the `--instrument` option is specified, then the simulation engine is instrumented during each replication (but
+ *  not during a forked warm-up), and a summary of the merged measurements is written, after the confidence intervals,
+ *  to the report file, or to the standard output if there is no report file. If `[[instrumentationLog]]` supplies a
+ *  log stream, the summary is also published to it.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @since 0.3
+ */
+abstract class SimulationApp[M <: ModelState[M]]
+extends FacsimileApp {
+
+  /** Create the initial model state of a replication.
+   *
+   *  @param prng Random number generator to be employed by the model.
+   *
+   *  @param parameters Configuration of this simulation run.
+   *
+   *  @return Initial model state.
+   *
+   *  @since 0.3
+   */
+  protected def initialModelState(prng: SimplePRNG, parameters: Config): M
+
+  /** Actions initializing the simulation, such as scheduling initial events.
+   *
+   *  @param parameters Configuration of this simulation run.
+   *
+   *  @param simulation Simulation being initialized.
+   *
+   *  @return Initialization actions.
+   *
+   *  @since 0.3
+   */
+  protected def initialization(parameters: Config)(implicit simulation: Simulation[M]): Action[M]
+
+  /** Reseed a warmed-up model state, so that it employs a different random number stream.
+   *
+   *  @param modelState Model state at the end of the warm-up period.
+   *
+   *  @param prng Random number generator, positioned at the start of the replication's own random number stream.
+   *
+   *  @return Model state employing `prng` for all subsequent random number generation.
+   *
+   *  @since 0.3
+   */
+  protected def reseed(modelState: M, prng: SimplePRNG): M
+
+  /** Report the statistics of a completed replication.
+   *
+   *  @param modelState Final model state of the replication.
+   *
+   *  @return Values of the statistics, keyed by name, reported by the replication.
+   *
+   *  @since 0.3
+   */
+  protected def statistics(modelState: M): Map[String, Double]
+
+  /** Log stream to which instrumentation summaries are published, if any.
+   *
+   *  Each line of the summary is published as a separate message, using this application's name as its prefix. By
+   *  default, there is no such log stream.
+   *
+   *  @note The log stream must be connected to a sink, and run, before replications are run, otherwise publication of
+   *  the summary will wait indefinitely once the stream's buffer has filled.
+   *
+   *  @return Log stream to which instrumentation summaries are to be published, wrapped in `[[scala.Some Some]]`, or
+   *  `[[scala.None None]]` if summaries are not to be published.
+   *
+   *  @since 0.3
+   */
+  protected def instrumentationLog: Option[LogStream[String]] = None
+
+  /** Report the final results of a replication.
+   *
+   *  @param result Final simulation state, and the result of the last transition.
+   *
+   *  @return Values of the statistics reported by the replication.
+   *
+   *  @throws Throwable if the replication failed.
+   */
+  private def report(result: (SimulationState[M], Try[Unit])): Map[String, Double] = {
+    val (s, r) = result
+    r.get
+    statistics(s.simulation.modelState.runA(s).value)
+  }
+
+  /** Run a replication from the start, including its warm-up period.
+   *
+   *  @param prng Random number generator, positioned at the start of the replication's own random number stream.
+   *
+   *  @param parameters Configuration of this simulation run.
+   *
+   *  @param instrumentation Engine instrumentation recorder, if the replication is to be instrumented.
+   *
+   *  @return Final simulation state, and the result of the last transition.
+   */
+  private def fullRun(prng: SimplePRNG, parameters: Config, instrumentation: Option[Instrumentation]):
+  (SimulationState[M], Try[Unit]) = {
+    implicit val simulation: Simulation[M] = new Simulation[M](FacsimileConfig.eventCalendar(parameters),
+      FacsimileConfig.timeResolution(parameters))
+    simulation.runFast(initialModelState(prng, parameters), FacsimileConfig.warmUpDuration(parameters),
+      FacsimileConfig.snapDuration(parameters), FacsimileConfig.snapCount(parameters),
+      instrumentation)(initialization(parameters))
+  }
+
+  /** @inheritdoc */
+  override protected final def replicate(replication: Int, prng: SimplePRNG, parameters: Config):
+  Map[String, Double] = report(fullRun(prng, parameters, None))
+
+  /** @inheritdoc */
+  @NonPure
+  override private[application] final def runReplications(config: FacsimileConfig):
+  Try[(ReplicationSummary, Seq[String])] = {
+
+    // If each replication is to perform its own warm-up, without instrumentation, then there's nothing more to do.
+    if(!config.forkWarmUp && !config.instrument) super.runReplications(config)
+    else {
+
+      // Merged instrumentation reports of the replications that have completed so far.
+      val merged = new AtomicReference(InstrumentationReport.Empty)
+
+      // Helper to run a replication, instrumenting it if required, and merging its instrumentation report.
+      def instrumented(run: Option[Instrumentation] => (SimulationState[M], Try[Unit])): Map[String, Double] = {
+        if(!config.instrument) report(run(None))
+        else {
+          val instrumentation = new Instrumentation
+          val result = run(Some(instrumentation))
+          merged.accumulateAndGet(instrumentation.report, _.merge(_))
+          report(result)
+        }
+      }
+
+      // Run the replications, either from the start, or by resuming them from the warmed-up simulation state.
+      val parameters = config.parameters
+      val summary = if(!config.forkWarmUp) {
+        Replications.run(config.replications, config.threads, config.seed) {(_, prng) =>
+          instrumented(i => fullRun(prng, parameters, i))
+        }
+      }
+      else {
+
+        // Obtain the warmed-up simulation state, either from the specified file or by simulating the warm-up period.
+        implicit val simulation: Simulation[M] = new Simulation[M](config.eventCalendar, config.timeResolution)
+        val snapshot = config.loadWarmUp.fold {
+          val prng = SimplePRNG.stream(config.seed, SimplePRNG.StreamCount - 1)
+          simulation.warmUp(initialModelState(prng, parameters), config.warmUpDuration, config.snapDuration,
+            config.snapCount)(initialization(parameters))
+        }(f => SimulationSnapshot.load[M](f))
+
+        // Save the warmed-up state, if requested, then resume each replication from it.
+        for {
+          ss <- snapshot
+          _ <- config.saveWarmUp.fold(Try(()))(ss.save)
+          rs <- Replications.run(config.replications, config.threads, config.seed) {(_, prng) =>
+            instrumented(i => simulation.resume(ss, i)(reseed(_, prng)))
+          }
+        } yield rs
+      }
+
+      // If instrumented, publish the instrumentation summary to the log stream, if there is one, and report it.
+      for {
+        rs <- summary
+        _ <- if(config.instrument) publishInstrumentation(merged.get) else Try(())
+      } yield (rs, if(config.instrument) merged.get.summary else Nil)
+    }
+  }
+
+  /** Publish an instrumentation summary to the instrumentation log stream, if there is one.
+   *
+   *  @param instrumentation Merged instrumentation report of all replications.
+   *
+   *  @return `Unit`, wrapped in a `[[scala.util.Success Success]]`, if there is no log stream, or if the summary was
+   *  queued by it; an exception instance identifying the cause of the failure, wrapped in a
+   *  `[[scala.util.Failure Failure]]` otherwise.
+   */
+  @NonPure
+  private def publishInstrumentation(instrumentation: InstrumentationReport): Try[Unit] = {
+    instrumentationLog.fold(Try(())) {log =>
+      Try(Await.result(instrumentation.publish(log, appName), Duration.Inf)).flatMap {
+        case QueueOfferResult.Enqueued => Success(())
+        case r => Failure(new IllegalStateException(LibResource("application.SimulationApp.PublishFailed", r)))
+      }
+    }
+  }
+}
@@ -0,0 +1,279 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.sim.model.ModelState
+
+/** Mutable event calendar, implemented as an array-backed 4-ary heap.
+ *
+ *  The ordering keys of each event (its due time, in clock ticks, its priority and its identifier) are held in parallel
+ *  primitive arrays, so that sifting events through the heap compares contiguous, unboxed values; the events
+ *  themselves are stored to the side, and are only moved, never examined, during a sift. A 4-ary heap is half as deep
+ *  as a binary heap, and the four children of each node typically share a cache line.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @note This calendar is updated in place: `+` and `minimumRemove` return this same instance. It must therefore be
+ *  used ''linearly'': simulation states that refer to it cannot be retained and later resumed, since they will observe
+ *  subsequent changes to the calendar. Use a `[[HeapEventCalendar]]` if persistent simulation states are required.
+ *
+ *  @constructor Create a new, empty, mutable event calendar.
+ *
+ *  @param initialCapacity Number of events that can be stored before the calendar's arrays must be reallocated.
+ */
+private[engine] final class ArrayEventCalendar[M <: ModelState[M]](initialCapacity: Int =
+ArrayEventCalendar.DefaultCapacity)
+extends EventCalendar[M] {
+
+  /** Due time of each event, in clock ticks. */
+  private var dueAt = new Array[Long](initialCapacity.max(1)) //scalastyle:ignore var.field
+
+  /** Priority of each event. */
+  private var priority = new Array[Int](dueAt.length) //scalastyle:ignore var.field
+
+  /** Identifier of each event. */
+  private var id = new Array[Long](dueAt.length) //scalastyle:ignore var.field
+
+  /** Events, stored in the same positions as their keys. */
+  private var events = new Array[Event[M]](dueAt.length) //scalastyle:ignore var.field
+
+  /** Number of events currently stored. */
+  private var count = 0 //scalastyle:ignore var.field
+
+  /** @inheritdoc */
+  override def isEmpty: Boolean = count == 0
+
+  /** @inheritdoc */
+  override def size: Int = count
+
+  /** @inheritdoc */
+  override def +(e: Event[M]): ArrayEventCalendar[M] = {
+    if(count == dueAt.length) grow()
+    siftUp(count, e.dueAt, e.priority, e.id, e)
+    count += 1
+    this
+  }
+
+  /** @inheritdoc
+   *
+   *  @note If the number of events added is large compared to the number already scheduled, the events are appended
+   *  to the heap's arrays, which are then re-ordered in linear time (''Floyd's'' heap construction); otherwise, the
+   *  events are added one at a time.
+   */
+  override def ++(es: Seq[Event[M]]): ArrayEventCalendar[M] = {
+    val n = es.size
+    if(n < count) es.foreach(e => this + e)
+    else if(n > 0) {
+      reserve(Math.addExact(count, n))
+      es.foreach {e =>
+        store(count, e.dueAt, e.priority, e.id, e)
+        count += 1
+      }
+      heapify()
+    }
+    this
+  }
+
+  /** @inheritdoc */
+  override def minimumRemove: (Option[Event[M]], ArrayEventCalendar[M]) = {
+    if(count == 0) (None, this)
+    else {
+      val min = events(0)
+      count -= 1
+      val last = count
+      val lastEvent = events(last)
+      events(last) = null //scalastyle:ignore null
+      if(last > 0) siftDown(0, dueAt(last), priority(last), id(last), lastEvent)
+      (Some(min), this)
+    }
+  }
+
+  /** @inheritdoc */
+  override def toVector: Vector[Event[M]] = events.iterator.take(count).toVector
+
+  /** Double the capacity of the calendar's arrays. */
+  private def grow(): Unit = resize(Math.multiplyExact(dueAt.length, 2))
+
+  /** Ensure that the calendar's arrays can store at least the indicated number of events.
+   *
+   *  @param required Number of events to be accommodated.
+   */
+  private def reserve(required: Int): Unit = {
+    if(required > dueAt.length) resize(Math.max(required, Math.multiplyExact(dueAt.length, 2)))
+  }
+
+  /** Reallocate the calendar's arrays.
+   *
+   *  @param capacity New capacity of the arrays, which must be at least the number of events stored.
+   */
+  private def resize(capacity: Int): Unit = {
+    dueAt = Array.copyOf(dueAt, capacity)
+    priority = Array.copyOf(priority, capacity)
+    id = Array.copyOf(id, capacity)
+    events = Array.copyOf(events, capacity)
+  }
+
+  /** Restore the heap property over all stored events, by sifting down each parent node, starting with the last. */
+  private def heapify(): Unit = {
+    var n = (count - 2) / ArrayEventCalendar.Arity //scalastyle:ignore var.local
+    while(n >= 0) { //scalastyle:ignore while
+      siftDown(n, dueAt(n), priority(n), id(n), events(n))
+      n -= 1
+    }
+  }
+
+  /** Determine whether a key precedes the key stored at the indicated position.
+   *
+   *  @param t Due time, in clock ticks.
+   *
+   *  @param p Priority.
+   *
+   *  @param i Identifier.
+   *
+   *  @param j Position of the key to be compared against.
+   *
+   *  @return `true` if the specified key must be dispatched before that at position `j`; `false` otherwise.
+   */
+  private def precedes(t: Long, p: Int, i: Long, j: Int): Boolean = {
+    if(t != dueAt(j)) t < dueAt(j)
+    else if(p != priority(j)) p < priority(j)
+    else i < id(j)
+  }
+
+  /** Store an event at the indicated position.
+   *
+   *  @param n Position at which the event is to be stored.
+   *
+   *  @param t Due time of the event, in clock ticks.
+   *
+   *  @param p Priority of the event.
+   *
+   *  @param i Identifier of the event.
+   *
+   *  @param e Event to be stored.
+   */
+  private def store(n: Int, t: Long, p: Int, i: Long, e: Event[M]): Unit = {
+    dueAt(n) = t
+    priority(n) = p
+    id(n) = i
+    events(n) = e
+  }
+
+  /** Move the event at one position to another position.
+   *
+   *  @param from Position of the event to be moved.
+   *
+   *  @param to Position to which the event is to be moved.
+   */
+  private def move(from: Int, to: Int): Unit = store(to, dueAt(from), priority(from), id(from), events(from))
+
+  /** Insert an event into the heap, starting from a vacant position and moving towards the root.
+   *
+   *  @param start Vacant position at which to start.
+   *
+   *  @param t Due time of the event, in clock ticks.
+   *
+   *  @param p Priority of the event.
+   *
+   *  @param i Identifier of the event.
+   *
+   *  @param e Event to be inserted.
+   */
+  private def siftUp(start: Int, t: Long, p: Int, i: Long, e: Event[M]): Unit = {
+    var n = start //scalastyle:ignore var.local
+    var placed = false //scalastyle:ignore var.local
+    while(!placed && n > 0) { //scalastyle:ignore while
+      val parent = (n - 1) / ArrayEventCalendar.Arity
+      if(precedes(t, p, i, parent)) {
+        move(parent, n)
+        n = parent
+      }
+      else placed = true
+    }
+    store(n, t, p, i, e)
+  }
+
+  /** Insert an event into the heap, starting from a vacant position and moving away from the root.
+   *
+   *  @param start Vacant position at which to start.
+   *
+   *  @param t Due time of the event, in clock ticks.
+   *
+   *  @param p Priority of the event.
+   *
+   *  @param i Identifier of the event.
+   *
+   *  @param e Event to be inserted.
+   */
+  private def siftDown(start: Int, t: Long, p: Int, i: Long, e: Event[M]): Unit = {
+    var n = start //scalastyle:ignore var.local
+    var placed = false //scalastyle:ignore var.local
+    while(!placed) { //scalastyle:ignore while
+      val first = n * ArrayEventCalendar.Arity + 1
+      if(first >= count) placed = true
+      else {
+
+        // Find the child that must be dispatched first.
+        val end = Math.min(first + ArrayEventCalendar.Arity, count)
+        var min = first //scalastyle:ignore var.local
+        var c = first + 1 //scalastyle:ignore var.local
+        while(c < end) { //scalastyle:ignore while
+          if(precedes(dueAt(c), priority(c), id(c), min)) min = c
+          c += 1
+        }
+
+        // If that child precedes the event being inserted, move it up and continue from its position.
+        if(!precedes(t, p, i, min)) {
+          move(min, n)
+          n = min
+        }
+        else placed = true
+      }
+    }
+    store(n, t, p, i, e)
+  }
+}
+
+/** Mutable event calendar companion. */
+private[engine] object ArrayEventCalendar {
+
+  /** Number of children of each heap node. */
+  private val Arity = 4
+
+  /** Default initial capacity of a new calendar. */
+  private[engine] val DefaultCapacity = 64
+}
@@ -0,0 +1,398 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.sim.model.ModelState
+
+/** Mutable event calendar, implemented as a ''calendar queue''.
+ *
+ *  A calendar queue (R. Brown, "Calendar Queues: A Fast O(1) Priority Queue Implementation for the Simulation Event
+ *  Set Problem", ''Communications of the ACM'', 31(10), 1988) divides simulation time into ''days'' of fixed width,
+ *  arranged cyclically into a ''year'' of buckets. Each bucket holds a list, sorted in dispatch order, of the events
+ *  due on any of its days. Provided that the day width is comparable to the mean separation of events, scheduling and
+ *  removing events both take expected constant time, regardless of the number of pending events. The numbers of
+ *  buckets and the day width are re-estimated whenever the number of events doubles or halves. The day width is also
+ *  re-estimated if the next event repeatedly cannot be found within a year of the current day, so that a calendar
+ *  whose number of events is steady recovers from a poor initial width.
+ *
+ *  Events are assigned to ''virtual bucket'' (day) numbers, computed by integer division of their due times (in clock
+ *  ticks) by the day width, so that bucket boundaries are exact and are computed identically when scheduling and when
+ *  removing events. Since all events sharing a due time
+ *  share a day, and each bucket's list is sorted by due time, priority and identifier, events are removed in exactly
+ *  the same order as that defined by `[[Event.compare]]`.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @note This calendar is updated in place: `+` and `minimumRemove` return this same instance. It must therefore be
+ *  used ''linearly'': simulation states that refer to it cannot be retained and later resumed, since they will observe
+ *  subsequent changes to the calendar. Use a `[[HeapEventCalendar]]` if persistent simulation states are required.
+ *
+ *  @constructor Create a new, empty, calendar queue.
+ */
+private[engine] final class CalendarQueueEventCalendar[M <: ModelState[M]]
+extends EventCalendar[M] {
+
+  import CalendarQueueEventCalendar._
+
+  /** Buckets, each referencing the first node of a sorted list of events, or `null` if empty. */
+  private var buckets = new Array[Node[M]](MinBuckets) //scalastyle:ignore var.field
+
+  /** Mask mapping a virtual bucket number to a bucket index. The number of buckets must be a power of two. */
+  private var mask = MinBuckets - 1 //scalastyle:ignore var.field
+
+  /** Width of each day, in clock ticks. */
+  private var width = DefaultWidth //scalastyle:ignore var.field
+
+  /** Virtual bucket (day) number from which the search for the next event commences. */
+  private var currentDay = 0L //scalastyle:ignore var.field
+
+  /** Number of events currently stored. */
+  private var count = 0 //scalastyle:ignore var.field
+
+  /** Number of consecutive removals for which the next event was not due within a year of the current day. */
+  private var directSearches = 0 //scalastyle:ignore var.field
+
+  /** Number of buckets examined, in total, while searching for and redistributing events. */
+  private var examined = 0L //scalastyle:ignore var.field
+
+  /** Report the number of buckets examined so far while searching for and redistributing events.
+   *
+   *  This measures the work performed by the calendar, which should be a small constant for each operation.
+   *
+   *  @return Total number of buckets examined since this calendar was created.
+   */
+  private[engine] def bucketsExamined: Long = examined
+
+  /** @inheritdoc */
+  override def isEmpty: Boolean = count == 0
+
+  /** @inheritdoc */
+  override def size: Int = count
+
+  /** @inheritdoc */
+  override def +(e: Event[M]): CalendarQueueEventCalendar[M] = {
+    insert(new Node(e.dueAt, e.priority, e.id, e))
+    count += 1
+    if(count > GrowFactor * buckets.length) resize(buckets.length * GrowFactor)
+    this
+  }
+
+  /** @inheritdoc */
+  override def minimumRemove: (Option[Event[M]], CalendarQueueEventCalendar[M]) = {
+    if(count == 0) (None, this)
+    else {
+      val b = nextBucket()
+      val n = buckets(b)
+      buckets(b) = n.next
+      count -= 1
+      if(count < buckets.length / GrowFactor && buckets.length > MinBuckets) resize(buckets.length / GrowFactor)
+      else if(directSearches >= MaxDirectSearches) resize(buckets.length)
+      (Some(n.event), this)
+    }
+  }
+
+  /** @inheritdoc */
+  override def toVector: Vector[Event[M]] = {
+    val nodes = buckets.iterator.flatMap(h => Iterator.iterate(h)(_.next).takeWhile(_ ne null)) //scalastyle:ignore null
+    nodes.map(_.event).toVector
+  }
+
+  /** Determine the virtual bucket (day) number of a due time.
+   *
+   *  @param t Due time, in clock ticks.
+   *
+   *  @return Day number on which `t` falls.
+   */
+  private def day(t: Long): Long = Math.floorDiv(t, width)
+
+  /** Insert a node into its bucket, maintaining the bucket's sort order.
+   *
+   *  @param n Node to be inserted.
+   */
+  private def insert(n: Node[M]): Unit = {
+    val d = day(n.dueAt)
+    val b = (d & mask).toInt
+
+    // If the event is due before the current day, then the search for the next event must start from its day.
+    if(d < currentDay) currentDay = d
+
+    // Find the node that the new node must follow, if any.
+    val head = buckets(b)
+    if(head == null || n.precedes(head)) { //scalastyle:ignore null
+      n.next = head
+      buckets(b) = n
+    }
+    else {
+      var prev = head //scalastyle:ignore var.local
+      while(prev.next != null && !n.precedes(prev.next)) prev = prev.next //scalastyle:ignore null while
+      n.next = prev.next
+      prev.next = n
+    }
+  }
+
+  /** Identify the bucket whose first node holds the next event to be dispatched, updating the current day.
+   *
+   *  @note The calendar must not be empty.
+   *
+   *  @return Index of the bucket holding the next event.
+   */
+  private def nextBucket(): Int = {
+
+    // Scan a year's worth of days, starting from the current day, for an event due on the day being examined. Since
+    // each bucket is sorted, only the first node of each bucket need be examined.
+    var scanned = 0 //scalastyle:ignore var.local
+    var found = -1 //scalastyle:ignore var.local
+    while(found < 0 && scanned < buckets.length) { //scalastyle:ignore while
+      val b = (currentDay & mask).toInt
+      val head = buckets(b)
+      examined += 1
+      if(head != null && day(head.dueAt) <= currentDay) found = b //scalastyle:ignore null
+      else {
+        currentDay += 1
+        scanned += 1
+      }
+    }
+
+    // If no event is due within the year, then the events are sparse: search all of the buckets directly for the
+    // earliest event, and move the current day to its day. If this keeps happening, the day width is too narrow, and
+    // will be re-estimated once the event has been removed.
+    if(found < 0) {
+      found = directSearch()
+      currentDay = day(buckets(found).dueAt)
+      directSearches += 1
+    }
+    else directSearches = 0
+    found
+  }
+
+  /** Search all buckets for the bucket whose first node holds the next event to be dispatched.
+   *
+   *  @note The calendar must not be empty.
+   *
+   *  @return Index of the bucket holding the next event.
+   */
+  private def directSearch(): Int = {
+    var min = -1 //scalastyle:ignore var.local
+    var b = 0 //scalastyle:ignore var.local
+    while(b < buckets.length) { //scalastyle:ignore while
+      val head = buckets(b)
+      if(head != null && (min < 0 || head.precedes(buckets(min)))) min = b //scalastyle:ignore null
+      b += 1
+    }
+    examined += buckets.length
+    assert(min >= 0)
+    min
+  }
+
+  /** Estimate the day width from the separation of the next few events to be dispatched.
+   *
+   *  If too few of the next events lie within a year of the current day to be sampled, then the current width is too
+   *  narrow, and the width is instead estimated from the mean separation of all of the events.
+   *
+   *  @return Estimated day width, in clock ticks, or the current width if there is insufficient information to
+   *  estimate a new value.
+   */
+  private def estimateWidth(): Long = {
+    val samples = sampleDueTimes()
+    val separation = {
+      if(samples.length >= MinSamples) meanSeparation(samples)
+      else if(count > 1) overallSeparation()
+      else 0.0
+    }
+    val newWidth = Math.round(WidthFactor * separation)
+    if(newWidth > 0L) newWidth else width
+  }
+
+  /** Determine the mean separation of all of the stored events, from the range of their due times.
+   *
+   *  @note The calendar must hold at least two events.
+   *
+   *  @return Mean separation of the stored events, in clock ticks.
+   */
+  private def overallSeparation(): Double = {
+    var first = Long.MaxValue //scalastyle:ignore var.local
+    var last = Long.MinValue //scalastyle:ignore var.local
+    var b = 0 //scalastyle:ignore var.local
+    while(b < buckets.length) { //scalastyle:ignore while
+
+      // Each bucket is sorted, so its earliest event is its first node, and its latest event is its last node.
+      var n = buckets(b) //scalastyle:ignore var.local
+      if(n != null) { //scalastyle:ignore null
+        first = Math.min(first, n.dueAt)
+        while(n.next != null) n = n.next //scalastyle:ignore null while
+        last = Math.max(last, n.dueAt)
+      }
+      b += 1
+    }
+    examined += buckets.length
+    (last.toDouble - first.toDouble) / (count - 1).toDouble
+  }
+
+  /** Sample the due times of the next few events to be dispatched, without removing them.
+   *
+   *  The events are sampled by stepping through the days from the current day, giving up if a year is scanned without
+   *  finding enough of them.
+   *
+   *  @return Due times, in clock ticks, of up to `SampleSize` events, in dispatch order.
+   */
+  private def sampleDueTimes(): Array[Long] = {
+    val samples = new Array[Long](Math.min(count, SampleSize))
+    var taken = 0 //scalastyle:ignore var.local
+    var d = currentDay //scalastyle:ignore var.local
+    while(taken < samples.length && d - currentDay < buckets.length) { //scalastyle:ignore while
+
+      // Since no event is due before the current day, the events due on day d are at the front of their bucket.
+      var n = buckets((d & mask).toInt) //scalastyle:ignore var.local
+      while(n != null && taken < samples.length && day(n.dueAt) == d) { //scalastyle:ignore null while
+        samples(taken) = n.dueAt
+        taken += 1
+        n = n.next
+      }
+      examined += 1
+      d += 1
+    }
+    Array.copyOf(samples, taken)
+  }
+
+  /** Determine the mean separation of a sorted sequence of due times.
+   *
+   *  Following Brown's heuristic, separations greater than twice the overall mean are discounted as outliers.
+   *
+   *  @param samples Sorted due times, in clock ticks. There must be at least two samples.
+   *
+   *  @return Mean separation of the samples, in clock ticks.
+   */
+  private def meanSeparation(samples: Array[Long]): Double = {
+    val overall = (samples(samples.length - 1) - samples(0)).toDouble / (samples.length - 1).toDouble
+    var sum = 0.0 //scalastyle:ignore var.local
+    var used = 0 //scalastyle:ignore var.local
+    var i = 1 //scalastyle:ignore var.local
+    while(i < samples.length) { //scalastyle:ignore while
+      val sep = (samples(i) - samples(i - 1)).toDouble
+      if(sep <= GrowFactor.toDouble * overall) {
+        sum += sep
+        used += 1
+      }
+      i += 1
+    }
+    sum / Math.max(used, 1).toDouble
+  }
+
+  /** Change the number of buckets, re-estimating the day width and redistributing the events.
+   *
+   *  @param newSize New number of buckets, which must be a power of two.
+   */
+  private def resize(newSize: Int): Unit = {
+    val newWidth = estimateWidth()
+    val old = buckets
+    buckets = new Array[Node[M]](newSize)
+    mask = newSize - 1
+    width = newWidth
+    currentDay = Long.MaxValue
+    directSearches = 0
+    var b = 0 //scalastyle:ignore var.local
+    while(b < old.length) { //scalastyle:ignore while
+      var n = old(b) //scalastyle:ignore var.local
+      while(n != null) { //scalastyle:ignore null while
+        val next = n.next
+        insert(n)
+        n = next
+      }
+      b += 1
+    }
+    examined += old.length
+    if(count == 0) currentDay = 0L
+  }
+}
+
+/** Calendar queue companion. */
+private object CalendarQueueEventCalendar {
+
+  /** Minimum number of buckets. */
+  private val MinBuckets = 16
+
+  /** Factor by which the number of buckets grows or shrinks. */
+  private val GrowFactor = 2
+
+  /** Initial day width, in clock ticks. */
+  private val DefaultWidth = 1L
+
+  /** Maximum number of events sampled when estimating the day width. */
+  private val SampleSize = 25
+
+  /** Minimum number of events that must be sampled in order to estimate the day width. */
+  private val MinSamples = 3
+
+  /** Ratio of the day width to the mean separation of events. */
+  private val WidthFactor = 3.0
+
+  /** Number of consecutive removals requiring a direct search after which the day width is re-estimated. */
+  private val MaxDirectSearches = 4
+
+  /** Calendar queue list node.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @constructor Create a new list node.
+   *
+   *  @param dueAt Due time of the event, in clock ticks.
+   *
+   *  @param priority Priority of the event.
+   *
+   *  @param id Identifier of the event.
+   *
+   *  @param event Event stored in this node.
+   */
+  private final class Node[M <: ModelState[M]](val dueAt: Long, val priority: Int, val id: Long,
+  val event: Event[M]) {
+
+    /** Next node in the same bucket, or `null` if this is the last node. */
+    var next: Node[M] = _ //scalastyle:ignore var.field
+
+    /** Determine whether this node's event must be dispatched before that of another node.
+     *
+     *  @param that Node to be compared against.
+     *
+     *  @return `true` if this node's event precedes `that` node's event; `false` otherwise.
+     */
+    def precedes(that: Node[M]): Boolean = {
+      if(dueAt != that.dueAt) dueAt < that.dueAt
+      else if(priority != that.priority) priority < that.priority
+      else id < that.id
+    }
+  }
+}
@@ -0,0 +1,144 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+/** Instrumentation data for the dispatches of a single type of action.
+ *
+ *  Dispatch times are recorded in a histogram having logarithmic bins: bin ''i'' counts dispatches that took at least
+ *  2^i^ nanoseconds, but less than 2^i+1^ nanoseconds (with bin 0 also counting dispatches that took less than a
+ *  nanosecond to complete).
+ *
+ *  @constructor Create a new dispatch profile.
+ *
+ *  @param dispatches Number of events dispatched.
+ *
+ *  @param scheduled Total number of events scheduled by those dispatches.
+ *
+ *  @param totalNanos Total wall-clock time, in nanoseconds, taken by those dispatches.
+ *
+ *  @param histogram Number of dispatches falling in each bin of the dispatch time histogram. There must be
+ *  `[[DispatchProfile.Bins Bins]]` elements.
+ *
+ *  @since 0.3
+ */
+final case class DispatchProfile(dispatches: Long, scheduled: Long, totalNanos: Long, histogram: Vector[Long]) {
+
+  // Sanity check.
+  require(histogram.length == DispatchProfile.Bins, s"Dispatch histogram must have ${DispatchProfile.Bins} bins")
+
+  /** Mean wall-clock time taken by each dispatch.
+   *
+   *  @return Mean dispatch time, in nanoseconds, or 0 if there have been no dispatches.
+   *
+   *  @since 0.3
+   */
+  def meanNanos: Double = if(dispatches == 0L) 0.0 else totalNanos.toDouble / dispatches
+
+  /** Mean number of events scheduled by each dispatch.
+   *
+   *  @return Mean number of events scheduled per dispatch, or 0 if there have been no dispatches.
+   *
+   *  @since 0.3
+   */
+  def scheduledPerDispatch: Double = if(dispatches == 0L) 0.0 else scheduled.toDouble / dispatches
+
+  /** Upper bound on a percentile of the dispatch times.
+   *
+   *  @param p Percentile required, as a value in the range [0, 1].
+   *
+   *  @return Upper bound of the histogram bin containing the `p` percentile of the dispatch times, in nanoseconds, or 0
+   *  if there have been no dispatches.
+   *
+   *  @throws IllegalArgumentException if `p` is outside of the range [0, 1].
+   *
+   *  @since 0.3
+   */
+  def percentileNanos(p: Double): Long = {
+    require(p >= 0.0 && p <= 1.0, s"Percentile must be in the range [0, 1]: $p")
+    if(dispatches == 0L) 0L
+    else {
+      val rank = Math.max(1L, Math.ceil(p * dispatches).toLong)
+      val bin = histogram.scanLeft(0L)(_ + _).indexWhere(_ >= rank) - 1
+
+      // The upper bound of bin b is 2^(b + 1), which cannot be represented as a Long for the top two bins.
+      if(bin >= DispatchProfile.Bins - 2) Long.MaxValue else 1L << (bin + 1)
+    }
+  }
+
+  /** Combine this profile with another.
+   *
+   *  @param that Profile to be combined with this profile.
+   *
+   *  @return Profile containing the dispatches of both profiles.
+   *
+   *  @since 0.3
+   */
+  def merge(that: DispatchProfile): DispatchProfile = {
+    DispatchProfile(dispatches + that.dispatches, scheduled + that.scheduled, totalNanos + that.totalNanos,
+      histogram.lazyZip(that.histogram).map(_ + _))
+  }
+}
+
+/** Dispatch profile companion.
+ *
+ *  @since 0.3
+ */
+object DispatchProfile {
+
+  /** Number of bins in each dispatch time histogram, one for each bit of a nanosecond count.
+   *
+   *  @since 0.3
+   */
+  val Bins: Int = java.lang.Long.SIZE
+
+  /** Profile of no dispatches.
+   *
+   *  @since 0.3
+   */
+  val Empty: DispatchProfile = DispatchProfile(0L, 0L, 0L, Vector.fill(Bins)(0L))
+
+  /** Identify the histogram bin for a dispatch time.
+   *
+   *  @param nanos Dispatch time, in nanoseconds.
+   *
+   *  @return Index of the histogram bin into which `nanos` falls.
+   */
+  private[engine] def bin(nanos: Long): Int = {
+    if(nanos <= 1L) 0
+    else java.lang.Long.SIZE - 1 - java.lang.Long.numberOfLeadingZeros(nanos)
+  }
+}
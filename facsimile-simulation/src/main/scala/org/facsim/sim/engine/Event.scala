@@ -38,8 +38,6 @@ package org.facsim.sim.engine
 
 import org.facsim.sim.model.{Action, ModelState}
 import org.facsim.util.CompareEqualTo
-import scala.reflect.runtime.universe.TypeTag
-import squants.Time
 
 /** Event scheduling the dispatch of specified actions at a specified simulation time.
  *
@@ -55,14 +53,15 @@ import squants.Time
  *  event creation order, such that when comparing two events, that with the lower `id` value was the first of the two
  *  be scheduled.
  *
- *  @param dueAt Absolute simulation time at which the event's `action` is scheduled to occur.
+ *  @param dueAt Absolute simulation time at which the event's `action` is scheduled to occur, measured in simulation
+ *  clock ''ticks'' (multiples of the simulation's time resolution) from the start of the simulation run.
  *
  *  @param priority Relative priority of this event. The lower this value, the higher the priority of the associated
  *  event. Co-incidental events will be dispatched in order of their priority.
  *
  *  @param action Action to be performed by this event when it is dispatched.
  */
-private[engine] final case class Event[M <: ModelState[M]: TypeTag](id: Long, dueAt: Time, priority: Int = 0,
+private[engine] final case class Event[M <: ModelState[M]](id: Long, dueAt: Long, priority: Int = 0,
 action: Action[M])
 extends Ordered[Event[M]] {
 
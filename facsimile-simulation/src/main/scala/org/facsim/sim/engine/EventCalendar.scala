@@ -0,0 +1,97 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.sim.model.ModelState
+
+/** Event calendar, used to store the events scheduled to occur at a future simulation time.
+ *
+ *  Event calendars are priority queues, ordered by the events' due time, priority and identifier, so that the event
+ *  that compares as ''less than'' all other events is at the head of the calendar.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @note Implementations may be either persistent (such that updated calendars leave previous versions unchanged) or
+ *  mutable (such that updated calendars are the same instance as the original calendar). Callers must therefore
+ *  always use the calendar returned by an operation, and must not retain references to earlier versions.
+ */
+private[engine] trait EventCalendar[M <: ModelState[M]] {
+
+  /** Determine whether this calendar is empty.
+   *
+   *  @return `true` if this calendar has no scheduled events; `false` otherwise.
+   */
+  def isEmpty: Boolean
+
+  /** Report the number of events in this calendar.
+   *
+   *  @return Number of scheduled events.
+   */
+  def size: Int
+
+  /** Schedule an event.
+   *
+   *  @param e Event to be added to this calendar.
+   *
+   *  @return Calendar with the event added.
+   */
+  def +(e: Event[M]): EventCalendar[M]
+
+  /** Schedule a number of events.
+   *
+   *  By default, events are added one at a time; implementations should override this where a more efficient bulk
+   *  insertion is available.
+   *
+   *  @param es Events to be added to this calendar.
+   *
+   *  @return Calendar with the events added.
+   */
+  def ++(es: Seq[Event[M]]): EventCalendar[M] = es.foldLeft(this)(_ + _)
+
+  /** Remove the next event to be dispatched.
+   *
+   *  @return Tuple whose first member is the next event to be dispatched, wrapped in `[[scala.Some Some]]`, or
+   *  `[[scala.None None]]` if this calendar is empty; the second member is the calendar with that event removed.
+   */
+  def minimumRemove: (Option[Event[M]], EventCalendar[M])
+
+  /** Report all of the events in this calendar, without modifying it.
+   *
+   *  @return Events in this calendar, in no particular order.
+   */
+  def toVector: Vector[Event[M]]
+}
@@ -0,0 +1,152 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.sim.LibResource
+import org.facsim.sim.model.ModelState
+
+/** Base trait for all simulation event calendar types.
+ *
+ *  The event calendar type determines the data structure used by a simulation to store its scheduled events.
+ *
+ *  @since 0.3
+ */
+sealed trait EventCalendarType {
+
+  /** Name of this event calendar type.
+   *
+   *  @since 0.3
+   */
+  val name: String
+
+  /** Value identifying this event calendar type in the `facsimile.simulation.event-queue` configuration setting. */
+  private[sim] val configValue: String
+
+  /** Create a new, empty, event calendar of this type.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @return Empty event calendar.
+   */
+  private[engine] def create[M <: ModelState[M]]: EventCalendar[M]
+}
+
+/** Persistent, binomial heap-based event calendar.
+ *
+ *  Simulation states utilizing this calendar are immutable, and so may be retained and resumed at will. This is the
+ *  default event calendar type.
+ *
+ *  @since 0.3
+ */
+case object PersistentHeapCalendar
+extends EventCalendarType {
+
+  /** @inheritdoc */
+  override val name: String = LibResource("engine.EventCalendarType.PersistentHeap")
+
+  /** @inheritdoc */
+  private[sim] override val configValue: String = "persistent-heap"
+
+  /** @inheritdoc */
+  private[engine] override def create[M <: ModelState[M]]: EventCalendar[M] = HeapEventCalendar.empty[M]
+}
+
+/** Mutable, array-backed 4-ary heap event calendar.
+ *
+ *  This calendar offers significantly higher throughput than the persistent calendar, particularly for models with
+ *  large numbers of pending events, but is updated in place: simulation states utilizing it cannot be retained and
+ *  later resumed.
+ *
+ *  @since 0.3
+ */
+case object ArrayHeapCalendar
+extends EventCalendarType {
+
+  /** @inheritdoc */
+  override val name: String = LibResource("engine.EventCalendarType.ArrayHeap")
+
+  /** @inheritdoc */
+  private[sim] override val configValue: String = "array-heap"
+
+  /** @inheritdoc */
+  private[engine] override def create[M <: ModelState[M]]: EventCalendar[M] = new ArrayEventCalendar[M]
+}
+
+/** Mutable calendar queue event calendar.
+ *
+ *  This calendar schedules and removes events in expected constant time, regardless of the number of pending events,
+ *  and is intended for models with very large numbers of pending events. Like the array heap, it is updated in place:
+ *  simulation states utilizing it cannot be retained and later resumed.
+ *
+ *  @since 0.3
+ */
+case object CalendarQueueCalendar
+extends EventCalendarType {
+
+  /** @inheritdoc */
+  override val name: String = LibResource("engine.EventCalendarType.CalendarQueue")
+
+  /** @inheritdoc */
+  private[sim] override val configValue: String = "calendar-queue"
+
+  /** @inheritdoc */
+  private[engine] override def create[M <: ModelState[M]]: EventCalendar[M] = {
+    new CalendarQueueEventCalendar[M]
+  }
+}
+
+/** Event calendar type companion.
+ *
+ *  @since 0.3
+ */
+object EventCalendarType {
+
+  /** All available event calendar types.
+   *
+   *  @since 0.3
+   */
+  val values: List[EventCalendarType] = List(PersistentHeapCalendar, ArrayHeapCalendar, CalendarQueueCalendar)
+
+  /** Identify the event calendar type corresponding to a configuration setting value.
+   *
+   *  @param value Value of the `facsimile.simulation.event-queue` configuration setting.
+   *
+   *  @return Corresponding event calendar type wrapped in `[[scala.Some Some]]`, or `[[scala.None None]]` if `value`
+   *  does not identify an event calendar type.
+   */
+  private[sim] def fromConfigValue(value: String): Option[EventCalendarType] = values.find(_.configValue == value)
+}
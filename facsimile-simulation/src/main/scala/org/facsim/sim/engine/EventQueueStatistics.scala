@@ -0,0 +1,61 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+/** Simulation event queue statistics.
+ *
+ *  Cancelled events are not removed from the event calendar immediately; instead, they are discarded when they reach
+ *  the head of the calendar. Until then, they continue to occupy the calendar, and are reported separately.
+ *
+ *  @constructor Create new event queue statistics.
+ *
+ *  @param pending Number of scheduled events that have yet to be dispatched, excluding cancelled events.
+ *
+ *  @param cancelled Number of cancelled events that have yet to be purged from the event calendar.
+ *
+ *  @since 0.3
+ */
+final case class EventQueueStatistics(pending: Int, cancelled: Int) {
+
+  /** Total number of entries in the event calendar, including cancelled events.
+   *
+   *  @return Sum of the pending and cancelled event counts.
+   *
+   *  @since 0.3
+   */
+  def entries: Int = pending + cancelled
+}
@@ -0,0 +1,100 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.collection.immutable.BinomialHeap
+import org.facsim.sim.model.ModelState
+
+/** Persistent event calendar, implemented as a binomial heap.
+ *
+ *  Updating this calendar leaves the original calendar unchanged, so that simulation states utilizing it can safely be
+ *  retained, compared and re-used.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @constructor Create a new persistent event calendar.
+ *
+ *  @param heap Binomial heap storing the scheduled events.
+ *
+ *  @param size Number of events stored in `heap`.
+ */
+private[engine] final class HeapEventCalendar[M <: ModelState[M]] private(heap: BinomialHeap[Event[M]],
+override val size: Int)
+extends EventCalendar[M] {
+
+  /** @inheritdoc */
+  override def isEmpty: Boolean = heap.isEmpty
+
+  /** @inheritdoc */
+  override def +(e: Event[M]): HeapEventCalendar[M] = new HeapEventCalendar(heap + e, size + 1)
+
+  /** @inheritdoc
+   *
+   *  @note The events are inserted directly into the underlying heap, creating a single new calendar.
+   */
+  override def ++(es: Seq[Event[M]]): HeapEventCalendar[M] = {
+    if(es.isEmpty) this
+    else new HeapEventCalendar(heap ++ es, size + es.size)
+  }
+
+  /** @inheritdoc */
+  override def minimumRemove: (Option[Event[M]], HeapEventCalendar[M]) = heap.minimumRemove match {
+    case (None, _) => (None, this)
+    case (me, rh) => (me, new HeapEventCalendar(rh, size - 1))
+  }
+
+  /** @inheritdoc
+   *
+   *  @note Since the heap is persistent, its events are retrieved by removing them, in order, from successive versions
+   *  of the heap.
+   */
+  override def toVector: Vector[Event[M]] = Iterator.unfold(heap)(h => h.minimumRemove match {
+    case (me, rh) => me.map(e => (e, rh))
+  }).toVector
+}
+
+/** Persistent event calendar companion. */
+private[engine] object HeapEventCalendar {
+
+  /** Create an empty persistent event calendar.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @return Event calendar containing no events.
+   */
+  def empty[M <: ModelState[M]]: HeapEventCalendar[M] = new HeapEventCalendar(BinomialHeap.empty[Event[M]], 0)
+}
@@ -0,0 +1,138 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import scala.collection.mutable
+import squants.Time
+import squants.time.Hours
+
+/** Records the performance of the simulation engine during a run.
+ *
+ *  Supplying an instrumentation instance to `[[Simulation.run]]`, `[[Simulation.runFast]]` or `[[Simulation.resume]]`
+ *  causes the engine to record, for each type of action (identified by its name), the number of events dispatched,
+ *  their wall-clock dispatch times and the number of events that each dispatch scheduled. The size of the event
+ *  calendar is also sampled at regular intervals of simulation time. If instrumentation is not requested, then these
+ *  measurements are not taken, and the cost to the engine is a single test per event dispatched.
+ *
+ *  @note Instances are mutable, and must not be shared by runs that execute concurrently. Runs executing one after
+ *  another may share an instance, in which case their measurements are accumulated.
+ *
+ *  @constructor Create a new, empty, instrumentation recorder.
+ *
+ *  @param sampleInterval Simulation time between successive samples of the event calendar size. If omitted, the
+ *  calendar is sampled once per simulated hour.
+ *
+ *  @since 0.3
+ */
+final class Instrumentation(val sampleInterval: Time = Hours(1.0)) {
+
+  /** Mutable dispatch profile accumulator for one type of action. */
+  private final class Accumulator {
+
+    /** Number of events dispatched. */
+    var dispatches: Long = 0L //scalastyle:ignore var.field
+
+    /** Number of events scheduled by those dispatches. */
+    var scheduled: Long = 0L //scalastyle:ignore var.field
+
+    /** Total dispatch time, in nanoseconds. */
+    var totalNanos: Long = 0L //scalastyle:ignore var.field
+
+    /** Dispatch time histogram. */
+    val histogram = new Array[Long](DispatchProfile.Bins)
+
+    /** Snapshot the accumulated measurements.
+     *
+     *  @return Dispatch profile holding the current measurements.
+     */
+    def profile: DispatchProfile = DispatchProfile(dispatches, scheduled, totalNanos, histogram.toVector)
+  }
+
+  /** Accumulators, keyed by action name. */
+  private val accumulators = mutable.HashMap.empty[String, Accumulator]
+
+  /** Event calendar size samples taken so far. */
+  private val samples = mutable.ArrayBuffer.empty[QueueSample]
+
+  /** Wall-clock time spent running the simulation so far, in nanoseconds. */
+  private var wallNanos = 0L //scalastyle:ignore var.field
+
+  /** Record the dispatch of an event.
+   *
+   *  @param name Name of the event's action.
+   *
+   *  @param nanos Wall-clock time, in nanoseconds, taken to dispatch the event.
+   *
+   *  @param scheduled Number of events scheduled by the dispatch.
+   */
+  private[engine] def dispatched(name: String, nanos: Long, scheduled: Long): Unit = {
+    val a = accumulators.getOrElseUpdate(name, new Accumulator)
+    a.dispatches += 1L
+    a.scheduled += scheduled
+    a.totalNanos += nanos
+    a.histogram(DispatchProfile.bin(nanos)) += 1L
+  }
+
+  /** Record a sample of the event calendar size.
+   *
+   *  @param time Simulation time at which the sample was taken.
+   *
+   *  @param size Event calendar size.
+   */
+  private[engine] def sampled(time: Time, size: Int): Unit = {
+    samples += QueueSample(time, size)
+    ()
+  }
+
+  /** Record wall-clock time spent running the simulation.
+   *
+   *  @param nanos Elapsed wall-clock time, in nanoseconds.
+   */
+  private[engine] def elapsed(nanos: Long): Unit = {
+    wallNanos += nanos
+  }
+
+  /** Report the measurements recorded so far.
+   *
+   *  @return Report of the measurements taken by this instance.
+   *
+   *  @since 0.3
+   */
+  def report: InstrumentationReport = {
+    InstrumentationReport(accumulators.view.mapValues(_.profile).toMap, samples.toVector, wallNanos)
+  }
+}
@@ -0,0 +1,180 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import akka.stream.QueueOfferResult
+import org.facsim.sim.LibResource
+import org.facsim.util.NonPure
+import org.facsim.util.log.{InformationSeverity, LogMessage, LogStream, Scope}
+import scala.concurrent.Future
+
+/** Summary of the engine's performance during one or more simulation runs.
+ *
+ *  @constructor Create a new instrumentation report.
+ *
+ *  @param profiles Dispatch profile of each type of action dispatched, keyed by action name.
+ *
+ *  @param queueSamples Samples of the size of the event calendar, taken at regular intervals of simulation time, in
+ *  the order in which they were taken.
+ *
+ *  @param wallNanos Total wall-clock time, in nanoseconds, spent running the simulation.
+ *
+ *  @since 0.3
+ */
+final case class InstrumentationReport(profiles: Map[String, DispatchProfile], queueSamples: Vector[QueueSample],
+wallNanos: Long) {
+
+  /** Total number of events dispatched.
+   *
+   *  @return Number of events dispatched, of all types.
+   *
+   *  @since 0.3
+   */
+  def dispatches: Long = profiles.valuesIterator.map(_.dispatches).sum
+
+  /** Rate at which events were dispatched.
+   *
+   *  @return Number of events dispatched per second of wall-clock time, or 0 if no time elapsed.
+   *
+   *  @since 0.3
+   */
+  def eventsPerSecond: Double = {
+    if(wallNanos <= 0L) 0.0 else dispatches * InstrumentationReport.NanosPerSecond / wallNanos
+  }
+
+  /** Largest event calendar size sampled.
+   *
+   *  @return Maximum sampled event calendar size, or 0 if no samples were taken.
+   *
+   *  @since 0.3
+   */
+  def maxQueueSize: Int = queueSamples.foldLeft(0)((m, qs) => Math.max(m, qs.size))
+
+  /** Mean event calendar size sampled.
+   *
+   *  @return Mean sampled event calendar size, or 0 if no samples were taken.
+   *
+   *  @since 0.3
+   */
+  def meanQueueSize: Double = {
+    if(queueSamples.isEmpty) 0.0 else queueSamples.foldLeft(0.0)(_ + _.size) / queueSamples.size
+  }
+
+  /** Combine this report with another, such as the report of a different replication.
+   *
+   *  @param that Report to be combined with this report.
+   *
+   *  @return Report covering the runs of both reports. The queue samples of `that` follow those of this report.
+   *
+   *  @since 0.3
+   */
+  def merge(that: InstrumentationReport): InstrumentationReport = {
+    val merged = that.profiles.foldLeft(profiles) {
+      case (ps, (name, p)) => ps.updated(name, ps.get(name).fold(p)(_.merge(p)))
+    }
+    InstrumentationReport(merged, queueSamples ++ that.queueSamples, wallNanos + that.wallNanos)
+  }
+
+  /** Summarize this report.
+   *
+   *  @return Lines summarizing the overall event dispatch rate and event calendar size, followed by the dispatch
+   *  profile of each type of action, in decreasing order of total dispatch time.
+   *
+   *  @since 0.3
+   */
+  def summary: Seq[String] = {
+    val overall = LibResource("engine.InstrumentationReport.Summary", dispatches,
+      wallNanos / InstrumentationReport.NanosPerSecond, eventsPerSecond, meanQueueSize, maxQueueSize)
+    overall +: profiles.toSeq.sortBy(-_._2.totalNanos).map {
+      case (name, p) => {
+        LibResource("engine.InstrumentationReport.Action", name, p.dispatches, p.meanNanos,
+          p.percentileNanos(InstrumentationReport.ReportedPercentile), p.scheduledPerDispatch)
+      }
+    }
+  }
+
+  /** Publish this report's summary to a log stream.
+   *
+   *  Each line of the summary is sent as a separate message, with information severity, in a single batch.
+   *
+   *  @tparam A Type of message prefix used by the log stream.
+   *
+   *  @param log Log stream to which the summary is to be sent.
+   *
+   *  @param prefix Prefix of each message sent, such as a timestamp.
+   *
+   *  @param scope Scope of each message sent.
+   *
+   *  @return Future containing the result of sending the summary, as for
+   *  `[[org.facsim.util.log.LogStream.logAll LogStream.logAll]]`.
+   *
+   *  @since 0.3
+   */
+  @NonPure
+  def publish[A](log: LogStream[A], prefix: A, scope: Scope = InstrumentationReport.LogScope):
+  Future[QueueOfferResult] = log.logAll(summary.map(line => LogMessage(prefix, line, scope, InformationSeverity)))
+}
+
+/** Instrumentation report companion.
+ *
+ *  @since 0.3
+ */
+object InstrumentationReport {
+
+  /** Number of nanoseconds in a second. */
+  private val NanosPerSecond = 1.0e9
+
+  /** Percentile of dispatch times reported by the summary. */
+  private val ReportedPercentile = 0.99
+
+  /** Log scope of published instrumentation summaries.
+   *
+   *  @since 0.3
+   */
+  object LogScope
+  extends Scope {
+
+    /** @inheritdoc */
+    override val name: String = LibResource("engine.InstrumentationReport.LogScope")
+  }
+
+  /** Report of no runs.
+   *
+   *  @since 0.3
+   */
+  val Empty: InstrumentationReport = InstrumentationReport(Map.empty, Vector.empty, 0L)
+}
@@ -0,0 +1,88 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import org.facsim.stat.ConfidenceInterval
+
+/** Summary of the results of a set of independent simulation replications.
+ *
+ *  @constructor Create a new replication summary.
+ *
+ *  @param outputs Statistics reported by each replication, indexed by replication number. Each replication reports a
+ *  map of named statistic values.
+ *
+ *  @param intervals Confidence interval for the mean of each named statistic, determined from the values reported by
+ *  all of the replications that reported that statistic.
+ *
+ *  @since 0.3
+ */
+final case class ReplicationSummary(outputs: IndexedSeq[Map[String, Double]],
+intervals: Map[String, ConfidenceInterval]) {
+
+  /** Number of replications summarized.
+   *
+   *  @return Number of replications that were performed.
+   *
+   *  @since 0.3
+   */
+  def replications: Int = outputs.size
+}
+
+/** Replication summary companion.
+ *
+ *  @since 0.3
+ */
+object ReplicationSummary {
+
+  /** Merge the statistics reported by a set of replications.
+   *
+   *  @param outputs Statistics reported by each replication, indexed by replication number.
+   *
+   *  @param level Confidence level of the resulting confidence intervals, in the range (0, 1).
+   *
+   *  @return Summary of `outputs`, with a confidence interval for each named statistic.
+   *
+   *  @throws IllegalArgumentException if `level` is outside of the range (0, 1).
+   *
+   *  @since 0.3
+   */
+  def apply(outputs: IndexedSeq[Map[String, Double]], level: Double): ReplicationSummary = {
+    val names = outputs.flatMap(_.keys).distinct
+    val intervals = names.map(n => n -> ConfidenceInterval(outputs.flatMap(_.get(n)), level)).toMap
+    ReplicationSummary(outputs, intervals)
+  }
+}
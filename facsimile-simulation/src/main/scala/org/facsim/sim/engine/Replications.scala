@@ -0,0 +1,233 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import java.util.concurrent.ForkJoinPool
+import org.facsim.stat.prng.{SimplePRNG, StreamRegistry}
+import org.facsim.util.requireValid
+import scala.concurrent.duration.Duration
+import scala.concurrent.{Await, ExecutionContext, Future}
+import scala.util.Try
+
+/** Runs independent replications of a simulation in parallel.
+ *
+ *  Each replication is a function of its replication number and a generator positioned at the start of its own,
+ *  non-overlapping, ''pseudo-random number'' stream. A replication will typically create its own [[Simulation]]
+ *  instance, run it, and report the values of the statistics of interest. Since simulations are purely functional,
+ *  replications share no state, and may be run concurrently on a work-stealing thread pool. Given the same seed,
+ *  results are identical regardless of the number of threads employed.
+ *
+ *  Replications run using `[[runStreams]]` and `[[compare]]` obtain their streams from a `[[StreamRegistry]]`, which
+ *  provides a dedicated stream for each named model component. This supports two variance reduction techniques:
+ *   - ''common random numbers'', which `[[compare]]` uses to run alternative scenarios with the same streams, so that
+ *     differences between them can be identified with fewer replications;
+ *   - ''antithetic variates'', in which each replication is run a second time with mirrored streams, and the mean of
+ *     each pair of runs is reported as that replication's result.
+ *
+ *  @since 0.3
+ */
+object Replications {
+
+  /** Default confidence level used when merging replication results.
+   *
+   *  @since 0.3
+   */
+  val DefaultConfidenceLevel: Double = 0.95
+
+  /** Run a number of independent replications, and merge their results.
+   *
+   *  @param count Number of replications to run. This value must be positive, and cannot exceed the number of streams
+   *  that are available, `[[org.facsim.stat.prng.SimplePRNG.StreamCount SimplePRNG.StreamCount]]`.
+   *
+   *  @param threads Maximum number of threads to use to run replications. This value must be positive.
+   *
+   *  @param seed Seed from which each replication's random number stream is derived.
+   *
+   *  @param level Confidence level of confidence intervals for each reported statistic, in the range (0, 1).
+   *
+   *  @param replication Function that runs the replication with the indicated number, using the supplied random number
+   *  generator, and which reports the resulting named statistic values.
+   *
+   *  @return Summary of the results of all of the replications, wrapped in `[[scala.util.Success Success]]`, or the
+   *  first exception thrown by a replication, wrapped in `[[scala.util.Failure Failure]]`.
+   *
+   *  @throws IllegalArgumentException if `count`, `threads` or `level` are invalid.
+   *
+   *  @since 0.3
+   */
+  def run(count: Int, threads: Int, seed: Long, level: Double = DefaultConfidenceLevel)
+  (replication: (Int, SimplePRNG) => Map[String, Double]): Try[ReplicationSummary] = {
+    requireValid(count, count > 0 && count <= SimplePRNG.StreamCount)
+    execute(count, threads, level)(r => replication(r, SimplePRNG.stream(seed, r)))
+  }
+
+  /** Run a number of independent replications, using named streams, and merge their results.
+   *
+   *  @param count Number of replications to run. This value must be positive.
+   *
+   *  @param threads Maximum number of threads to use to run replications. This value must be positive.
+   *
+   *  @param seed Seed from which each replication's random number streams are derived.
+   *
+   *  @param level Confidence level of confidence intervals for each reported statistic, in the range (0, 1).
+   *
+   *  @param antithetic If `true`, each replication is run twice, the second time with mirrored streams, and the mean of
+   *  each statistic reported by both runs is reported as the replication's result; statistics reported by only one of
+   *  the two runs are discarded. If `false`, each replication is run once.
+   *
+   *  @param replication Function that runs the replication with the indicated number, using streams from the supplied
+   *  registry, and which reports the resulting named statistic values.
+   *
+   *  @return Summary of the results of all of the replications, wrapped in `[[scala.util.Success Success]]`, or the
+   *  first exception thrown by a replication, wrapped in `[[scala.util.Failure Failure]]`.
+   *
+   *  @throws IllegalArgumentException if `count`, `threads` or `level` are invalid.
+   *
+   *  @since 0.3
+   */
+  def runStreams(count: Int, threads: Int, seed: Long, level: Double = DefaultConfidenceLevel,
+  antithetic: Boolean = false)(replication: (Int, StreamRegistry) => Map[String, Double]): Try[ReplicationSummary] = {
+    requireValid(count, count > 0)
+    execute(count, threads, level)(r => observe(StreamRegistry(seed, r), antithetic)(replication(r, _)))
+  }
+
+  /** Compare two scenarios, using common random numbers, and summarize the differences in their results.
+   *
+   *  Each replication of both scenarios is run using the same stream registry, so that each model component that is
+   *  present in both scenarios samples the same random values in each. The result reported for each replication is the
+   *  difference between the two scenarios' values of each statistic that both report, so that the resulting
+   *  confidence intervals are those of the mean difference between the scenarios. A statistic whose interval
+   *  excludes zero differs significantly between the two scenarios.
+   *
+   *  @param count Number of replications of each scenario to run. This value must be positive.
+   *
+   *  @param threads Maximum number of threads to use to run replications. This value must be positive.
+   *
+   *  @param seed Seed from which each replication's random number streams are derived.
+   *
+   *  @param level Confidence level of confidence intervals for each reported difference, in the range (0, 1).
+   *
+   *  @param antithetic If `true`, each replication of each scenario is also run with mirrored streams, as for
+   *  `[[runStreams]]`, before the difference is taken.
+   *
+   *  @param baseline Function that runs a replication of the baseline scenario.
+   *
+   *  @param alternative Function that runs a replication of the alternative scenario.
+   *
+   *  @return Summary of the differences between the alternative and baseline scenarios' results (the alternative's
+   *  value less the baseline's value), wrapped in `[[scala.util.Success Success]]`, or the first exception thrown by a
+   *  replication, wrapped in `[[scala.util.Failure Failure]]`.
+   *
+   *  @throws IllegalArgumentException if `count`, `threads` or `level` are invalid.
+   *
+   *  @since 0.3
+   */
+  def compare(count: Int, threads: Int, seed: Long, level: Double = DefaultConfidenceLevel,
+  antithetic: Boolean = false)(baseline: (Int, StreamRegistry) => Map[String, Double],
+  alternative: (Int, StreamRegistry) => Map[String, Double]): Try[ReplicationSummary] = {
+    requireValid(count, count > 0)
+    execute(count, threads, level) {r =>
+      val streams = StreamRegistry(seed, r)
+      val b = observe(streams, antithetic)(baseline(r, _))
+      val a = observe(streams, antithetic)(alternative(r, _))
+      combine(a, b)(_ - _)
+    }
+  }
+
+  /** Run replications in parallel, and merge their results.
+   *
+   *  @param count Number of replications to run, which must have been validated by the caller.
+   *
+   *  @param threads Maximum number of threads to use to run replications. This value must be positive.
+   *
+   *  @param level Confidence level of confidence intervals for each reported statistic, in the range (0, 1).
+   *
+   *  @param replication Function that runs the replication with the indicated number.
+   *
+   *  @return Summary of the results of all of the replications, or the first exception thrown by a replication.
+   *
+   *  @throws IllegalArgumentException if `threads` or `level` are invalid.
+   */
+  private def execute(count: Int, threads: Int, level: Double)
+  (replication: Int => Map[String, Double]): Try[ReplicationSummary] = {
+    requireValid(threads, threads > 0)
+    requireValid(level, level > 0.0 && level < 1.0)
+
+    // There's no benefit in having more threads than replications.
+    val pool = new ForkJoinPool(Math.min(threads, count))
+    try {
+      implicit val ec: ExecutionContext = ExecutionContext.fromExecutorService(pool)
+      val results = Future.traverse((0 until count).toVector)(r => Future(replication(r)))
+      Try(Await.result(results, Duration.Inf)).map(ReplicationSummary(_, level))
+    }
+    finally {
+      pool.shutdown()
+    }
+  }
+
+  /** Observe the results of a replication, optionally averaging them with those of its antithetic partner.
+   *
+   *  @param streams Stream registry to be used by the replication.
+   *
+   *  @param antithetic Indicates whether the replication is also to be run with mirrored streams.
+   *
+   *  @param replication Function running the replication with the supplied stream registry.
+   *
+   *  @return Statistics reported by the replication, or the mean of the statistics reported by both runs.
+   */
+  private def observe(streams: StreamRegistry, antithetic: Boolean)
+  (replication: StreamRegistry => Map[String, Double]): Map[String, Double] = {
+    val result = replication(streams)
+    if(antithetic) combine(result, replication(streams.antithetic))((x, y) => (x + y) / 2.0)
+    else result
+  }
+
+  /** Combine the statistics reported by two runs.
+   *
+   *  @param x Statistics reported by the first run.
+   *
+   *  @param y Statistics reported by the second run.
+   *
+   *  @param f Function combining a statistic's value in each run.
+   *
+   *  @return Combined values of each statistic reported by both runs.
+   */
+  private def combine(x: Map[String, Double], y: Map[String, Double])(f: (Double, Double) => Double):
+  Map[String, Double] = x.collect {
+    case (name, value) if y.contains(name) => name -> f(value, y(name))
+  }
+}
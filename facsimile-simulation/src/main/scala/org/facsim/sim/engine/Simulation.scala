@@ -37,26 +37,66 @@
 package org.facsim.sim.engine
 
 import cats.data.State
-import org.facsim.collection.immutable.BinomialHeap
 import org.facsim.sim.{Priority, SimulationAction, SimulationTransition}
 import org.facsim.sim.model.{Action, AnonymousAction, EndWarmUpAction, ModelState}
+import scala.annotation.tailrec
 import scala.language.implicitConversions
-import scala.reflect.runtime.universe.TypeTag
 import scala.util.{Failure, Success, Try}
 import squants.Time
-import squants.time.Days
+import squants.time.{Days, Microseconds, Seconds}
 
 /** Simulation model class.
  *
  *  @tparam M Final type of the simulation's model state.
  *
+ *  @constructor Create a new simulation.
+ *
+ *  @param eventCalendar Type of event calendar used to store scheduled events. If omitted, a persistent heap is used,
+ *  so that simulation states may be retained and resumed.
+ *
+ *  @param timeResolution Resolution of the simulation clock. Internally, the simulation clock counts ''ticks'' of this
+ *  duration, so that all scheduled times and delays are rounded to the nearest multiple of this value. Smaller values
+ *  allow finer scheduling, at the expense of a shorter maximum simulation run length (the clock can count up to
+ *  `Long.MaxValue` ticks). If omitted, this defaults to 1 microsecond, allowing runs of over 290,000 years. This value
+ *  must be greater than zero.
+ *
+ *  @note Simulations are serializable, so that actions referencing them can be saved as part of a
+ *  `[[SimulationSnapshot]]`. However, a simulation is serialized only as a placeholder, which is replaced by the
+ *  simulation loading the snapshot.
+ *
+ *  @throws IllegalArgumentException if `timeResolution` is not greater than zero.
+ *
  *  @since 0.0
  */
-final class Simulation[M <: ModelState[M]: TypeTag] {
+final class Simulation[M <: ModelState[M]](val eventCalendar: EventCalendarType = PersistentHeapCalendar,
+val timeResolution: Time = Microseconds(1.0))
+extends Serializable {
+
+  // Sanity check.
+  require(timeResolution > Seconds(0.0), s"Simulation time resolution must be greater than zero: $timeResolution")
 
   /** Implicit reference to the simulation. */
   implicit val SimulationRef: Simulation[M] = this
 
+  /** Duration of each simulation clock tick, in seconds. */
+  private val secondsPerTick: Double = timeResolution.to(Seconds)
+
+  /** Convert a time to simulation clock ticks.
+   *
+   *  @param t Time to be converted.
+   *
+   *  @return `t` measured in ticks, rounded to the nearest tick.
+   */
+  private[engine] def toTicks(t: Time): Long = Math.round(t.to(Seconds) / secondsPerTick)
+
+  /** Convert simulation clock ticks to a time.
+   *
+   *  @param ticks Number of ticks to be converted.
+   *
+   *  @return Time corresponding to `ticks`.
+   */
+  private[engine] def toTime(ticks: Long): Time = Seconds(ticks.toDouble * secondsPerTick)
+
   /** Report the current simulation time.
    *
    *  @return Simulation state transition combining the current simulation state and the current simulation time.
@@ -92,6 +132,144 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *  @since 0.0
    */
   def at(delay: Time, priority: Priority = 0)(actions: Action[M]): SimulationAction[M] = State {s =>
+    schedule(s, delay, priority, actions, handled = false)
+  }
+
+  /** Schedule a number of sets of actions for later execution.
+   *
+   *  This is equivalent to scheduling each set of actions, in turn, with `[[at]]`, but is considerably more efficient
+   *  when many events are to be scheduled at once (such as during model initialization): all of the new events are
+   *  created in a single pass, are added to the event calendar in bulk, and the identifier of the next event is updated
+   *  just once.
+   *
+   *  @param schedule Sequence of delays, priorities and actions to be scheduled. Each delay is the time to elapse from
+   *  the current simulation time to the time at which the associated actions are to be executed. Simultaneous events
+   *  having the same priority will be dispatched in the order that they appear in this sequence.
+   *
+   *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
+   *  success of the actions: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an exception
+   *  instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   *
+   *  @since 0.3
+   */
+  def atAll(schedule: Seq[(Time, Priority, Action[M])]): SimulationAction[M] = State {s =>
+
+    // If the simulation's run state does not support scheduling of events, then report the current state with a failure
+    // describing why.
+    if(!s.runState.canSchedule) (s, Failure(EventScheduleStateException(s.runState)))
+
+    // Otherwise, create and schedule the events, allocating consecutive identifiers.
+    else {
+      val now = s.simTicks
+      val firstId = s.nextEventId
+      val newNextEventId = Math.addExact(firstId, schedule.size.toLong)
+      val events = schedule.iterator.zipWithIndex.map {
+        case ((delay, priority, actions), i) =>
+          Event(firstId + i, Math.addExact(now, toTicks(delay)), priority, actions)
+      }.toVector
+      (s.update(newNextEventId = newNextEventId, newEvents = s.events ++ events), Success(()))
+    }
+  }
+
+  /** Schedule actions for later execution, retaining a handle to the resulting event.
+   *
+   *  The handle can subsequently be used to cancel or reschedule the event, provided that it has yet to be dispatched.
+   *  Events that will never be cancelled or rescheduled should be scheduled with `[[at]]` instead, since tracking
+   *  handled events incurs a small overhead.
+   *
+   *  @param delay Time to elapse from the current simulation time to the time at which the actions are to be executed.
+   *
+   *  @param priority Relative priority of the actions to be executed. Refer to `[[at]]` for further information.
+   *
+   *  @param actions Actions to be executed after the specified `delay`.
+   *
+   *  @return Simulation state transition containing the updated simulation state, together with the handle of the
+   *  scheduled event, wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying
+   *  the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   *
+   *  @since 0.3
+   */
+  def atWithHandle(delay: Time, priority: Priority = 0)(actions: Action[M]):
+  SimulationTransition[M, Try[EventHandle]] = State {s =>
+    val (ns, r) = schedule(s, delay, priority, actions, handled = true)
+    (ns, r.map(_ => new EventHandle(s.nextEventId)))
+  }
+
+  /** Cancel a scheduled event.
+   *
+   *  Cancelled events are not removed from the event calendar immediately, but are discarded, without being
+   *  dispatched, when they reach the head of the calendar.
+   *
+   *  @param handle Handle of the event to be cancelled.
+   *
+   *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
+   *  success of the cancellation: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an exception
+   *  instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise. In
+   *  particular, if the event has already been dispatched or cancelled, the failure will be an
+   *  `[[EventNotPendingException]]`.
+   *
+   *  @since 0.3
+   */
+  def cancel(handle: EventHandle): SimulationAction[M] = State {s =>
+    val (ns, r) = remove(s, handle)
+    (ns, r.map(_ => ()))
+  }
+
+  /** Reschedule a scheduled event, so that its actions are executed after a new delay.
+   *
+   *  The event is cancelled, and its actions are scheduled afresh, with the same priority, after `newDelay` has elapsed
+   *  from the current simulation time.
+   *
+   *  @param handle Handle of the event to be rescheduled.
+   *
+   *  @param newDelay Time to elapse from the current simulation time to the time at which the event's actions are to be
+   *  executed.
+   *
+   *  @return Simulation state transition containing the updated simulation state, together with the handle of the
+   *  rescheduled event, wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying
+   *  the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise. In particular, if the event has
+   *  already been dispatched or cancelled, the failure will be an `[[EventNotPendingException]]`.
+   *
+   *  @since 0.3
+   */
+  def reschedule(handle: EventHandle, newDelay: Time): SimulationTransition[M, Try[EventHandle]] = State {s =>
+    remove(s, handle) match {
+      case (rs, Success(e)) =>
+        val (ns, r) = schedule(rs, newDelay, e.priority, e.action, handled = true)
+        (ns, r.map(_ => new EventHandle(rs.nextEventId)))
+      case (rs, Failure(ex)) => (rs, Failure(ex))
+    }
+  }
+
+  /** Report event queue statistics.
+   *
+   *  @return Simulation state transition combining the current simulation state and its event queue statistics.
+   *
+   *  @since 0.3
+   */
+  def queueStatistics: SimulationTransition[M, EventQueueStatistics] = State.inspect {s =>
+    EventQueueStatistics(s.events.size - s.cancelled.size, s.cancelled.size)
+  }
+
+  /** Create and schedule a new event.
+   *
+   *  @param s Current simulation state.
+   *
+   *  @param delay Time to elapse from the current simulation time to the time at which the actions are to be executed.
+   *
+   *  @param priority Relative priority of the actions to be executed.
+   *
+   *  @param actions Actions to be executed after the specified `delay`.
+   *
+   *  @param handled If `true`, the event will be tracked so that it can subsequently be cancelled or rescheduled.
+   *
+   *  @return Updated simulation state, together with a value indicating the success of the operation: `Unit`, wrapped
+   *  in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the failure,
+   *  wrapped in a `[[scala.util.Failure Failure]]` otherwise. If successful, the new event's identifier is the
+   *  original state's `nextEventId`.
+   */
+  private def schedule(s: SimulationState[M], delay: Time, priority: Priority, actions: Action[M], handled: Boolean):
+  (SimulationState[M], Try[Unit]) = {
 
     // If the simulation's run state does not support scheduling of events, then report the current state with a failure
     // describing why.
@@ -100,8 +278,9 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
     // Otherwise, create and schedule the event.
     else {
 
-      // Firstly, create the new event.
-      val event = Event(s.nextEventId, s.simTime + delay, priority, actions)
+      // Firstly, create the new event. The delay is converted to clock ticks here, so that all subsequent event
+      // comparisons operate upon primitive values.
+      val event = Event(s.nextEventId, Math.addExact(s.simTicks, toTicks(delay)), priority, actions)
 
       // Add it to the event queue.
       val newEvents = s.events + event
@@ -109,8 +288,35 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
       // Update the identifier of the next event.
       val newNextEventId = Math.incrementExact(s.nextEventId)
 
+      // If required, track the event so that it can be cancelled or rescheduled.
+      val newHandled = if(handled) s.handled + (event.id -> event) else s.handled
+
       // Return the updated simulation state, together with a success.
-      (s.update(newNextEventId = newNextEventId, newEvents = newEvents), Success(()))
+      (s.update(newNextEventId = newNextEventId, newEvents = newEvents, newHandled = newHandled), Success(()))
+    }
+  }
+
+  /** Cancel a handled event.
+   *
+   *  @param s Current simulation state.
+   *
+   *  @param handle Handle of the event to be cancelled.
+   *
+   *  @return Updated simulation state, together with the cancelled event, wrapped in a
+   *  `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the failure,
+   *  wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   */
+  private def remove(s: SimulationState[M], handle: EventHandle): (SimulationState[M], Try[Event[M]]) = {
+
+    // Cancellation is only meaningful if events can still be scheduled.
+    if(!s.runState.canSchedule) (s, Failure(EventScheduleStateException(s.runState)))
+    else s.handled.get(handle.id) match {
+
+      // If the event is pending, mark it as cancelled. It remains in the event calendar until it is purged.
+      case Some(e) => (s.update(newHandled = s.handled - e.id, newCancelled = s.cancelled + e.id), Success(e))
+
+      // Otherwise, the event has already been dispatched or cancelled.
+      case None => (s, Failure(EventNotPendingException(handle)))
     }
   }
 
@@ -133,7 +339,7 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *
    *  @since 0.0
    */
-  def takeUntil[A: TypeTag](ts: Seq[SimulationTransition[M, A]], terminationValue: A)
+  def takeUntil[A](ts: Seq[SimulationTransition[M, A]], terminationValue: A)
   (p: ((SimulationState[M], A)) => Boolean): SimulationTransition[M, A] = {
 
     // Transition type.
@@ -216,7 +422,7 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *  @return Initial simulation state, for use at the start of the simulation.
    */
   private def initialState(initialModelState: M): SimulationState[M] = {
-    new SimulationState(initialModelState, 0L, None, BinomialHeap.empty[Event[M]], Initializing)
+    new SimulationState(initialModelState, 0L, None, eventCalendar.create[M], Initializing)
   }
 
   /** Initialize the simulation.
@@ -275,11 +481,56 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *  @note The new simulation time (the time at which the new current event is scheduled to occur) '''must''' be
    *  greater than or equal to the due time of the initial current event.
    *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
    *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
    *  success of the update operation: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an
    *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
    */
-  private def updateCurrentEvent: SimulationAction[M] = State {s =>
+  private def updateCurrentEvent(instrumentation: Option[Instrumentation]): SimulationAction[M] = State {s =>
+    advance(s, instrumentation)
+  }
+
+  /** Make the event at the head of the event queue the current event, sampling the event calendar if required.
+   *
+   *  If the run is instrumented, then the size of the event calendar is sampled whenever the simulation clock enters a
+   *  new sampling interval.
+   *
+   *  @param s Simulation state prior to the update.
+   *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
+   *  @return Updated simulation state, together with a value indicating the success of the update operation: `Unit`,
+   *  wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the
+   *  failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   */
+  private def advance(s: SimulationState[M], instrumentation: Option[Instrumentation]):
+  (SimulationState[M], Try[Unit]) = {
+    val result = nextEvent(s)
+    instrumentation match {
+      case Some(i) if result._2.isSuccess => {
+        val us = result._1
+        val interval = Math.max(1L, toTicks(i.sampleInterval))
+        if(s.current.isEmpty || us.simTicks / interval != s.simTicks / interval) i.sampled(us.simTime, us.events.size)
+      }
+      case _ =>
+    }
+    result
+  }
+
+  /** Make the event at the head of the event queue the current event.
+   *
+   *  This is the transition function underlying `[[updateCurrentEvent]]`, and is shared by both the state monad-based
+   *  and imperative event loops, so that the two cannot diverge.
+   *
+   *  @param s Simulation state prior to the update.
+   *
+   *  @return Updated simulation state, together with a value indicating the success of the update operation: `Unit`,
+   *  wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the
+   *  failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   */
+  @tailrec
+  private def nextEvent(s: SimulationState[M]): (SimulationState[M], Try[Unit]) = {
 
     // If the simulation's current state does not support event iteration, then report a failure as the result, together
     // with the current state.
@@ -288,11 +539,17 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
     // Otherwise, if the event queue is empty, them we've run out of events.
     else if(s.events.isEmpty) (s.update(newRunState = Terminated), Failure(OutOfEventsException))
 
-    // Otherwise, update the system state accordingly and return a success.
+    // Otherwise, retrieve the event at the head of the event queue.
     else {
       val (newCurrent, newEvents) = s.events.minimumRemove
       assert(newCurrent.nonEmpty)
-      (s.update(newCurrent = newCurrent, newEvents = newEvents), Success(()))
+      val id = newCurrent.get.id
+
+      // If this event has been cancelled, purge it and try again with the next event.
+      if(s.cancelled.contains(id)) nextEvent(s.update(newEvents = newEvents, newCancelled = s.cancelled - id))
+
+      // Otherwise, update the system state accordingly and return a success.
+      else (s.update(newCurrent = newCurrent, newEvents = newEvents, newHandled = s.handled - id), Success(()))
     }
   }
 
@@ -300,17 +557,66 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *
    *  Execute the actions associated with the current event, updating the simulation state accordingly.
    *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
    *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
    *  success of the dispatch operation: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an
    *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
    */
-  private def dispatchCurrentEvent: SimulationAction[M] = State {s =>
+  private def dispatchCurrentEvent(instrumentation: Option[Instrumentation]): SimulationAction[M] = State {s =>
 
     // Updating of events can only happen during iterations. Verify that our run-state allows this.
     assert(s.runState.canIterate)
 
     // Execute the actions associated with the event, returning the result.
-    s.current.get.action.dispatch.run(s).value
+    dispatch(s, instrumentation)
+  }
+
+  /** Dispatch the current event, measuring the dispatch if required.
+   *
+   *  This is the transition function underlying `[[dispatchCurrentEvent]]`, and is shared by both the state
+   *  monad-based and imperative event loops. If the run is not instrumented, the only overhead is a single test.
+   *
+   *  @param s Simulation state prior to the dispatch.
+   *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
+   *  @return Updated simulation state, together with a value indicating the success of the dispatch operation: `Unit`,
+   *  wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the
+   *  failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   */
+  private def dispatch(s: SimulationState[M], instrumentation: Option[Instrumentation]):
+  (SimulationState[M], Try[Unit]) = {
+    val action = s.current.get.action
+    instrumentation match {
+      case None => action.dispatch.run(s).value
+      case Some(i) => {
+        val start = System.nanoTime()
+        val result = action.dispatch.run(s).value
+        i.dispatched(action.name, System.nanoTime() - start, result._1.nextEventId - s.nextEventId)
+        result
+      }
+    }
+  }
+
+  /** Evaluate a simulation run, measuring its wall-clock duration if required.
+   *
+   *  @tparam A Type of the run's result.
+   *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
+   *  @param run Simulation run to be evaluated.
+   *
+   *  @return Result of the run.
+   */
+  private def timed[A](instrumentation: Option[Instrumentation])(run: => A): A = instrumentation match {
+    case None => run
+    case Some(i) => {
+      val start = System.nanoTime()
+      val result = run
+      i.elapsed(System.nanoTime() - start)
+      result
+    }
   }
 
   /** Perform an ''event iteration''.
@@ -321,19 +627,21 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *   1. Dispatching the new current event, so that its associated actions take place.
    *   1. Report the resulting simulation update.
    *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
    *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
    *  success of the iteration operation: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an
    *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
    */
-  private def iterate: SimulationAction[M] = for {
+  private def iterate(instrumentation: Option[Instrumentation]): SimulationAction[M] = for {
     r <- takeUntilFailure {
       List(
 
         // Update the current event.
-        updateCurrentEvent,
+        updateCurrentEvent(instrumentation),
 
         // Dispatch the current event.
-        dispatchCurrentEvent
+        dispatchCurrentEvent(instrumentation)
       )
     }
   } yield r
@@ -346,14 +654,16 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *   1. Dispatching the new current event, so that its associated actions take place.
    *   1. Report the resulting simulation update.
    *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
    *  @return Simulation state transition containing the updated simulation state, together with a value indicating the
    *  success of the iteration operation: `Unit`, wrapped in a `[[scala.util.Success Success]]`, if successful; an
    *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
    */
-  private def remainingEvents: SimulationAction[M] = State {s =>
+  private def remainingEvents(instrumentation: Option[Instrumentation]): SimulationAction[M] = State {s =>
 
     // Perform an event iteration and consider the result.
-    val result = iterate.run(s).value
+    val result = iterate(instrumentation).run(s).value
 
     // If the iteration resulted in an error, or if the simulation completed, return the result.
     if (result._2.isFailure || !result._1.runState.canIterate) result
@@ -363,7 +673,7 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
     // Note: It might appear that this code will result in a stack overflow, for any long simulation with large numbers
     // of events, but it does not: the Cats library state monad utilizes Eval trampolining to overcome this. (If that
     // make little sense, Google it ;-)
-    else remainingEvents.run(result._1).value
+    else remainingEvents(instrumentation).run(result._1).value
   }
 
   /** Run the simulation, until it completes.
@@ -385,6 +695,10 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *  @param numSnaps Number of simulation snaps to be undertaken. The simulation will terminate when the last snap has
    *  completed. This value must be greater than 0, or an error will occur. This value defaults to 1.
    *
+   *  @param instrumentation Recorder of engine performance measurements for this run, wrapped in
+   *  `[[scala.Some Some]]`, or `[[scala.None None]]` if the engine is not to be instrumented. If omitted, the engine is
+   *  not instrumented.
+   *
    *  @param initialization Actions necessary to initialize the simulation, such as scheduling initial events.
    *
    *  @return Final simulation state as the first element of a tuple that also includes the result of the last
@@ -392,15 +706,15 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
    *
    *  @since 0.0
    */
-  def run(initialModelState: M, warmUpPeriod: Time = Days(7.0), snapLength: Time = Days(7.0), numSnaps: Int = 1)
-  (initialization: Action[M]): (SimulationState[M], Try[Unit]) = {
+  def run(initialModelState: M, warmUpPeriod: Time = Days(7.0), snapLength: Time = Days(7.0), numSnaps: Int = 1,
+  instrumentation: Option[Instrumentation] = None)(initialization: Action[M]): (SimulationState[M], Try[Unit]) = {
 
     // Execute the initialization and all subsequent events.
     val runToCompletion: SimulationAction[M] = for {
       r <- takeUntilFailure {
         List[SimulationAction[M]](
           initialize(warmUpPeriod, snapLength, numSnaps, initialization),
-          remainingEvents
+          remainingEvents(instrumentation)
         )
       }
     } yield r
@@ -409,7 +723,198 @@ final class Simulation[M <: ModelState[M]: TypeTag] {
     val initState = initialState(initialModelState)
 
     // Now initialize the simulation using the initial state and run it to completion.
-    runToCompletion.run(initState).value
+    timed(instrumentation)(runToCompletion.run(initState).value)
+  }
+
+  /** Run the simulation, until it completes, using an imperative event loop.
+   *
+   *  The model's actions are executed exactly as they are by `[[run]]`, and the two functions produce identical
+   *  results for the same arguments. However, rather than composing each event iteration from simulation state
+   *  transitions, this function advances the simulation in a single loop, holding the current simulation state in a
+   *  local variable for the duration of the run. This avoids the transition, closure and list allocations that `run`
+   *  incurs for each event dispatched, which can dominate execution time for models whose actions are simple.
+   *
+   *  @note A model terminates either when an error is encountered, or when the the last simulation snap is completed,
+   *  whichever comes first.
+   *
+   *  @param initialModelState Initial state of the simulation model at the start of the run.
+   *
+   *  @param warmUpPeriod Duration, measured in simulation time from the start of the simulation run, allowing the
+   *  simulation to ''warm-up'' (that is, fully populating the simulation model and removing the effects of
+   *  ''initialization bias''), after which simulation statistics will be reset. If omitted, this value defaults to 1
+   *  week.
+   *
+   *  @param snapLength Duration, measured in simulation time, of each simulation ''snap'' (simulation reporting
+   *  period), with the first such snap starting after the warm-up period has completed. At the end of each snap, the
+   *  statistics are reset and a report generated. If omitted, this defaults to one week.
+   *
+   *  @param numSnaps Number of simulation snaps to be undertaken. The simulation will terminate when the last snap has
+   *  completed. This value must be greater than 0, or an error will occur. This value defaults to 1.
+   *
+   *  @param instrumentation Recorder of engine performance measurements for this run, wrapped in
+   *  `[[scala.Some Some]]`, or `[[scala.None None]]` if the engine is not to be instrumented. If omitted, the engine is
+   *  not instrumented.
+   *
+   *  @param initialization Actions necessary to initialize the simulation, such as scheduling initial events.
+   *
+   *  @return Final simulation state as the first element of a tuple that also includes the result of the last
+   *  transition, wrapped in a `[[scala.util.Try Try]]`.
+   *
+   *  @since 0.3
+   */
+  def runFast(initialModelState: M, warmUpPeriod: Time = Days(7.0), snapLength: Time = Days(7.0), numSnaps: Int = 1,
+  instrumentation: Option[Instrumentation] = None)(initialization: Action[M]): (SimulationState[M], Try[Unit]) = {
+    timed(instrumentation) {
+
+      // Initialization is performed just once, so there is nothing to be gained from avoiding the state monad here.
+      val initState = initialState(initialModelState)
+      val (s, r) = initialize(warmUpPeriod, snapLength, numSnaps, initialization).run(initState).value
+
+      // If initialization failed, report the failure; otherwise, execute the remaining events.
+      if(r.isFailure) (s, r)
+      else executeRemainingEvents(s, untilWarmedUp = false, instrumentation)
+    }
+  }
+
+  /** Run the simulation until the end of its warm-up period, capturing the resulting simulation state.
+   *
+   *  The simulation is initialized and run exactly as it is by `[[runFast]]`, except that execution stops immediately
+   *  after the end of the warm-up period has been processed. Any number of independent runs can then be resumed from
+   *  the resulting snapshot by `[[resume]]`, without each having to simulate the warm-up period again. The snapshot
+   *  can also be saved, so that later runs can skip the warm-up period altogether.
+   *
+   *  @param initialModelState Initial state of the simulation model at the start of the run.
+   *
+   *  @param warmUpPeriod Duration, measured in simulation time from the start of the simulation run, allowing the
+   *  simulation to ''warm-up''. If omitted, this value defaults to 1 week.
+   *
+   *  @param snapLength Duration, measured in simulation time, of each simulation ''snap'' that follows the warm-up
+   *  period. If omitted, this defaults to one week.
+   *
+   *  @param numSnaps Number of simulation snaps to be undertaken once the simulation is resumed. This value must be
+   *  greater than 0, or an error will occur. This value defaults to 1.
+   *
+   *  @param initialization Actions necessary to initialize the simulation, such as scheduling initial events.
+   *
+   *  @return Snapshot of the simulation state at the end of the warm-up period, wrapped in a
+   *  `[[scala.util.Success Success]]`, if successful; an exception instance identifying the cause of the failure,
+   *  wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   *
+   *  @since 0.3
+   */
+  def warmUp(initialModelState: M, warmUpPeriod: Time = Days(7.0), snapLength: Time = Days(7.0), numSnaps: Int = 1)
+  (initialization: Action[M]): Try[SimulationSnapshot[M]] = {
+
+    // Initialize the simulation, and then execute events until the warm-up period has ended.
+    val initState = initialState(initialModelState)
+    val (is, ir) = initialize(warmUpPeriod, snapLength, numSnaps, initialization).run(initState).value
+    val (s, r) = if(ir.isFailure) (is, ir) else executeRemainingEvents(is, untilWarmedUp = true, None)
+
+    // If the warm-up period did not end, then the simulation must have stopped for some other reason.
+    r.flatMap {_ =>
+      if(s.current.exists(isEndOfWarmUp)) Success(SimulationSnapshot(s, secondsPerTick))
+      else Failure(EventIterationStateException(s.runState))
+    }
+  }
+
+  /** Resume a simulation from a snapshot, and run it until it completes.
+   *
+   *  The snapshot is not modified, so that it may be resumed any number of times. Resuming a snapshot captured by
+   *  `[[warmUp]]`, without modifying the model state, produces identical results to running the simulation from the
+   *  start.
+   *
+   *  @param snapshot Snapshot from which the simulation is to be resumed.
+   *
+   *  @param instrumentation Recorder of engine performance measurements for this run, wrapped in
+   *  `[[scala.Some Some]]`, or `[[scala.None None]]` if the engine is not to be instrumented. If omitted, the engine is
+   *  not instrumented.
+   *
+   *  @param update Function applied to the snapshot's model state before the simulation is resumed. This allows each
+   *  resumed run to employ, say, a different random number stream, or different model parameters. If omitted, the
+   *  model state is left unchanged.
+   *
+   *  @return Final simulation state as the first element of a tuple that also includes the result of the last
+   *  transition, wrapped in a `[[scala.util.Try Try]]`.
+   *
+   *  @throws IllegalArgumentException if the snapshot was captured by a simulation with a different time resolution.
+   *
+   *  @since 0.3
+   */
+  def resume(snapshot: SimulationSnapshot[M], instrumentation: Option[Instrumentation] = None)
+  (update: M => M = identity[M]): (SimulationState[M], Try[Unit]) = {
+
+    // Clock ticks are only meaningful if both simulations use the same time resolution.
+    require(snapshot.secondsPerTick == secondsPerTick,
+      s"Snapshot time resolution differs from simulation time resolution: $timeResolution")
+
+    // Rebuild the simulation state, using a new event calendar containing the snapshot's events.
+    val s = new SimulationState(update(snapshot.modelState), snapshot.nextEventId, snapshot.current,
+      eventCalendar.create[M] ++ snapshot.events, snapshot.runState, snapshot.handled, snapshot.cancelled)
+    timed(instrumentation)(executeRemainingEvents(s, untilWarmedUp = false, instrumentation))
+  }
+
+  /** Determine whether an event marks the end of the simulation's warm-up period.
+   *
+   *  @param e Event to be checked.
+   *
+   *  @return `true` if `e` is the event that ends the warm-up period; `false` otherwise.
+   */
+  private def isEndOfWarmUp(e: Event[M]): Boolean = e.action match {
+    case _: EndWarmUpAction[M] => true
+    case _ => false
+  }
+
+  /** Replace this simulation with a placeholder when serialized.
+   *
+   *  @return Placeholder to be serialized in place of this simulation.
+   */
+  private[engine] def writeReplace(): AnyRef = new SimulationSnapshot.SimulationProxy
+
+  /** Execute all remaining events, in an imperative loop, until either an error occurs or the simulation completes.
+   *
+   *  This is the imperative equivalent of `[[remainingEvents]]`.
+   *
+   *  @param initState Simulation state at the start of event execution.
+   *
+   *  @param untilWarmedUp If `true`, execution stops immediately after the event ending the warm-up period has been
+   *  dispatched.
+   *
+   *  @param instrumentation Engine instrumentation recorder, if the run is instrumented.
+   *
+   *  @return Final simulation state as the first element of a tuple that also includes the result of the last
+   *  transition, wrapped in a `[[scala.util.Try Try]]`.
+   */
+  private def executeRemainingEvents(initState: SimulationState[M], untilWarmedUp: Boolean,
+  instrumentation: Option[Instrumentation]): (SimulationState[M], Try[Unit]) = {
+
+    // The mutable state of this run. Neither value escapes this function, so the run remains referentially transparent
+    // to the caller.
+    var state = initState //scalastyle:ignore var.local
+    var result: Try[Unit] = Success(()) //scalastyle:ignore var.local
+    var executing = true //scalastyle:ignore var.local
+
+    // Keep performing event iterations until an iteration fails, or the simulation is no longer able to continue.
+    while(executing) { //scalastyle:ignore while
+
+      // Make the next event the current event. If this fails, then we're done.
+      val (us, ur) = advance(state, instrumentation)
+      if(ur.isFailure) {
+        state = us
+        result = ur
+        executing = false
+      }
+
+      // Otherwise, dispatch the new current event, and determine whether we can continue.
+      else {
+        val (ds, dr) = dispatch(us, instrumentation)
+        state = ds
+        result = dr
+        executing = dr.isSuccess && ds.runState.canIterate && !(untilWarmedUp && isEndOfWarmUp(us.current.get))
+      }
+    }
+
+    // Report the final state and result.
+    (state, result)
   }
 }
 
@@ -426,7 +931,7 @@ object Simulation {
    *
    *  @return `actions` wrapped as an action suitable for dispatching by an event.
    */
-  implicit def createAnonymousAction[M <: ModelState[M]: TypeTag](actions: SimulationAction[M]): AnonymousAction[M] = {
+  implicit def createAnonymousAction[M <: ModelState[M]](actions: SimulationAction[M]): AnonymousAction[M] = {
     new AnonymousAction[M](actions)
   }
 }
\ No newline at end of file
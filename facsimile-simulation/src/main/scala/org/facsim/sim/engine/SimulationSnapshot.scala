@@ -0,0 +1,180 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine package.
+//======================================================================================================================
+package org.facsim.sim.engine
+
+import java.io.{BufferedInputStream, BufferedOutputStream, File, FileInputStream, FileOutputStream,
+InvalidObjectException, ObjectInputStream, ObjectOutputStream, StreamCorruptedException}
+import org.facsim.sim.LibResource
+import org.facsim.sim.model.ModelState
+import scala.util.{DynamicVariable, Try}
+
+/** Captured state of a simulation, from which any number of independent runs may be resumed.
+ *
+ *  Snapshots are typically captured at the end of a simulation's warm-up period, by `[[Simulation.warmUp]]`, so that
+ *  many runs—each with, say, a different random number seed or parameter override—can be started from the
+ *  same warmed-up state by `[[Simulation.resume]]`, without each paying for the warm-up again.
+ *
+ *  Since a snapshot holds its scheduled events independently of any event calendar, a snapshot can be resumed any
+ *  number of times, regardless of the type of event calendar employed by the simulation.
+ *
+ *  Snapshots can also be saved to, and loaded from, files using ''Java'' serialization. For this to succeed, the
+ *  model state and all of the actions of scheduled events must be serializable. References to the simulation itself
+ *  are not saved; instead, they are resolved to the simulation that loads the snapshot.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @constructor Create a new simulation snapshot.
+ *
+ *  @param modelState Simulation model state at the time of the snapshot.
+ *
+ *  @param nextEventId Identifier of the next simulation event to be created.
+ *
+ *  @param current Event that was being dispatched when the snapshot was captured.
+ *
+ *  @param events Events that were scheduled, but which had yet to be dispatched, when the snapshot was captured.
+ *
+ *  @param runState State of the simulation run when the snapshot was captured.
+ *
+ *  @param handled Events, keyed by identifier, that were scheduled with a handle and which had yet to be dispatched or
+ *  cancelled.
+ *
+ *  @param cancelled Identifiers of cancelled events that had yet to be purged from `events`.
+ *
+ *  @param secondsPerTick Duration of each clock tick, in seconds, of the simulation that captured the snapshot.
+ *
+ *  @since 0.3
+ */
+final class SimulationSnapshot[M <: ModelState[M]] private[engine](private[engine] val modelState: M,
+private[engine] val nextEventId: Long, private[engine] val current: Option[Event[M]],
+private[engine] val events: Vector[Event[M]], private[engine] val runState: RunState,
+private[engine] val handled: Map[Long, Event[M]], private[engine] val cancelled: Set[Long],
+private[engine] val secondsPerTick: Double)
+extends Serializable {
+
+  /** Save this snapshot to a file.
+   *
+   *  @param file File into which the snapshot is to be written. If the file exists, it is overwritten.
+   *
+   *  @return `Unit`, wrapped in a `[[scala.util.Success Success]]`, if the snapshot was saved successfully; an
+   *  exception instance identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   *  In particular, if the model state or an event's actions are not serializable, then the failure will be a
+   *  `[[java.io.NotSerializableException NotSerializableException]]`.
+   *
+   *  @since 0.3
+   */
+  def save(file: File): Try[Unit] = Try {
+    val out = new ObjectOutputStream(new BufferedOutputStream(new FileOutputStream(file)))
+    try {
+      out.writeObject(this)
+    }
+    finally {
+      out.close()
+    }
+  }
+}
+
+/** Simulation snapshot companion.
+ *
+ *  @since 0.3
+ */
+object SimulationSnapshot {
+
+  /** Simulation to which simulation references are resolved while a snapshot is being loaded. */
+  private val loadingSimulation = new DynamicVariable[Option[AnyRef]](None)
+
+  /** Capture a snapshot of a simulation state.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @param s Simulation state to be captured.
+   *
+   *  @param secondsPerTick Duration of each of the simulation's clock ticks, in seconds.
+   *
+   *  @return Snapshot of `s`.
+   */
+  private[engine] def apply[M <: ModelState[M]](s: SimulationState[M], secondsPerTick: Double):
+  SimulationSnapshot[M] = {
+    new SimulationSnapshot(s.modelState, s.nextEventId, s.current, s.events.toVector, s.runState, s.handled,
+      s.cancelled, secondsPerTick)
+  }
+
+  /** Load a snapshot from a file.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @param file File from which the snapshot is to be read.
+   *
+   *  @param simulation Simulation that will resume the snapshot, to which all references to a simulation within the
+   *  snapshot will be resolved.
+   *
+   *  @return Loaded snapshot, wrapped in a `[[scala.util.Success Success]]`, if successful; an exception instance
+   *  identifying the cause of the failure, wrapped in a `[[scala.util.Failure Failure]]` otherwise.
+   *
+   *  @since 0.3
+   */
+  def load[M <: ModelState[M]](file: File)(implicit simulation: Simulation[M]): Try[SimulationSnapshot[M]] = Try {
+    val in = new ObjectInputStream(new BufferedInputStream(new FileInputStream(file)))
+    try {
+      loadingSimulation.withValue(Some(simulation))(in.readObject()) match {
+        case s: SimulationSnapshot[M @unchecked] => s
+        case _ => throw new StreamCorruptedException(LibResource("engine.SimulationSnapshot.NotSnapshot", file))
+      }
+    }
+    finally {
+      in.close()
+    }
+  }
+
+  /** Serialized placeholder for a simulation.
+   *
+   *  Simulations are not themselves serialized as part of a snapshot; instead, this placeholder is written in their
+   *  place, and is replaced by the loading simulation when read.
+   */
+  private[engine] final class SimulationProxy
+  extends Serializable {
+
+    /** Replace this placeholder with the loading simulation.
+     *
+     *  @return Simulation that is loading the snapshot.
+     *
+     *  @throws java.io.InvalidObjectException if no snapshot is being loaded.
+     */
+    private[engine] def readResolve(): AnyRef = loadingSimulation.value.getOrElse {
+      throw new InvalidObjectException(LibResource("engine.SimulationSnapshot.NoSimulation"))
+    }
+  }
+}
@@ -36,11 +36,8 @@
 //======================================================================================================================
 package org.facsim.sim.engine
 
-import org.facsim.sim.PriorityQueue
 import org.facsim.sim.model.ModelState
-import scala.reflect.runtime.universe.TypeTag
 import squants.Time
-import squants.time.Seconds
 
 /** Encapsulates the state of a simulation model at in instant in (simulation) time.
  *
@@ -56,18 +53,24 @@ import squants.time.Seconds
  *  @param current Event currently being dispatched, wrapped in `[[scala.Some Some]]`; if `[[scala.None None]]`, then
  *  the simulation has typically not yet started running.
  *
- *  @param events Set of simulation events scheduled to occur at a future simulation time.
+ *  @param events Calendar of simulation events scheduled to occur at a future simulation time.
  *
  *  @param runState Current state of the simulation run.
  *
+ *  @param handled Events, keyed by identifier, that were scheduled with a handle and which have yet to be dispatched
+ *  or cancelled.
+ *
+ *  @param cancelled Identifiers of cancelled events that have yet to be purged from `events`.
+ *
  *  @param sim Simulation to which this simulation state applies, typically passed implicitly.
  *
  *  @since 0.0
  */
-final class SimulationState[M <: ModelState[M]: TypeTag] private[engine](private[engine] val modelState: M,
+final class SimulationState[M <: ModelState[M]] private[engine](private[engine] val modelState: M,
 private[engine] val nextEventId: Long, private[engine] val current: Option[Event[M]],
-private[engine] val events: PriorityQueue[Event[M]], private[engine] val runState: RunState)
-(implicit sim: Simulation[M]) {
+private[engine] val events: EventCalendar[M], private[engine] val runState: RunState,
+private[engine] val handled: Map[Long, Event[M]] = Map.empty[Long, Event[M]],
+private[engine] val cancelled: Set[Long] = Set.empty[Long])(implicit sim: Simulation[M]) {
 
   /** Copy the existing state to a new state with the indicated new values.
    *
@@ -83,19 +86,29 @@ private[engine] val events: PriorityQueue[Event[M]], private[engine] val runStat
    *
    *  @param newRunState New run state of the simulation run.
    *
+   *  @param newHandled New handled events, keyed by identifier.
+   *
+   *  @param newCancelled New identifiers of cancelled events yet to be purged.
+   *
    *  @return Updated simulation state.
    */
   private[engine] def update(newModelState: M = modelState, newNextEventId: Long = nextEventId,
-  newCurrent: Option[Event[M]] = current, newEvents: PriorityQueue[Event[M]] = events,
-  newRunState: RunState = runState): SimulationState[M] = {
-    new SimulationState(newModelState, newNextEventId, newCurrent, newEvents, newRunState)
+  newCurrent: Option[Event[M]] = current, newEvents: EventCalendar[M] = events, newRunState: RunState = runState,
+  newHandled: Map[Long, Event[M]] = handled, newCancelled: Set[Long] = cancelled): SimulationState[M] = {
+    new SimulationState(newModelState, newNextEventId, newCurrent, newEvents, newRunState, newHandled, newCancelled)
   }
 
+  /** Report the current simulation time, in simulation clock ticks.
+   *
+   *  @return Current simulation time, measured in ticks from the start of the simulation run.
+   */
+  private[engine] def simTicks: Long = current.fold(0L)(_.dueAt)
+
   /** Report the current simulation time.
    *
    *  @return Current simulation time.
    */
-  private[engine] def simTime: Time = current.fold(Seconds(0.0))(_.dueAt)
+  private[engine] def simTime: Time = sim.toTime(simTicks)
 
   /** Report the model's current state.
    *
@@ -37,7 +37,6 @@
 package org.facsim.sim.model
 
 import org.facsim.sim.SimulationAction
-import scala.reflect.runtime.universe.TypeTag
 
 /** An ''action'' is a ''state transition'' that takes the state of the simulation and results in a new simulation
  *  state.
@@ -48,13 +47,18 @@ import scala.reflect.runtime.universe.TypeTag
  *   - Moving a simulation model entity from one element to another.
  *   - etc.
  *
+ *  Actions are serializable, so that scheduled events can be saved as part of a
+ *  `[[org.facsim.sim.engine.SimulationSnapshot SimulationSnapshot]]`; to support this, all of an action's members must
+ *  also be serializable.
+ *
  *  @tparam M Final model state type.
  *
  *  @constructor Create a new simulation action.
  *
  *  @since 0.0
  */
-abstract class Action[M <: ModelState[M]: TypeTag] {
+abstract class Action[M <: ModelState[M]]
+extends Serializable {
 
   /** Actions to be performed by this instance.
    *
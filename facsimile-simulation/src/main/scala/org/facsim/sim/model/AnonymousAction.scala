@@ -37,7 +37,6 @@
 package org.facsim.sim.model
 
 import org.facsim.sim.{LibResource, SimulationAction}
-import scala.reflect.runtime.universe.TypeTag
 
 /** Anonymous action for wrapping bare actions as `[[org.facsim.Action Action]]` instances.
  *
@@ -49,7 +48,7 @@ import scala.reflect.runtime.universe.TypeTag
  *
  *  @since 0.0
  */
-final class AnonymousAction[M <: ModelState[M]: TypeTag] private[sim]
+final class AnonymousAction[M <: ModelState[M]] private[sim]
 (override protected val actions: SimulationAction[M])
 extends Action[M] {
 
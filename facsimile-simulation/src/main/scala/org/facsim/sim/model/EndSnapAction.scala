@@ -38,7 +38,6 @@ package org.facsim.sim.model
 
 import org.facsim.sim.{LibResource, SimulationAction}
 import org.facsim.sim.engine.{Completed, Simulation}
-import scala.reflect.runtime.universe.TypeTag
 import squants.Time
 
 /** Standard simulation actions to perform a reset of the simulation's statistics.
@@ -53,7 +52,7 @@ import squants.Time
  *
  *  @param simulation Reference to the executing simulation.
  */
-private[sim] final class EndSnapAction[M <: ModelState[M]: TypeTag](snapLength: Time, snapsRemaining: Int)
+private[sim] final class EndSnapAction[M <: ModelState[M]](snapLength: Time, snapsRemaining: Int)
 (implicit simulation: Simulation[M])
 extends Action[M] {
 
@@ -63,19 +62,17 @@ extends Action[M] {
     // Sanity check.
     assert(snapsRemaining >= 0)
 
-    // Report to all subscribers that the simulation snap has completed. Statistics should be reset and a report
-    // generated accordingly.
-    // TODO
+    // Notify the model state that the simulation snap has completed, so that its statistics can be reset.
+    val notification = SnapObserver.snapEnded[M]
 
     // If this is the last snap, then change the simulation state to completed.
-    if(snapsRemaining == 0) for {
-      r <- simulation.updateRunState(Completed)
-    } yield r
+    val next = if(snapsRemaining == 0) simulation.updateRunState(Completed)
 
     // Otherwise, schedule the end of the next snap.
-    else for {
-      r <- simulation.at(snapLength, Int.MaxValue)(new EndSnapAction[M](snapLength, snapsRemaining - 1))
-    } yield r
+    else simulation.at(snapLength, Int.MaxValue)(new EndSnapAction[M](snapLength, snapsRemaining - 1))
+
+    // Perform both actions, stopping if either fails.
+    simulation.takeUntilFailure(List(notification, next))
   }
 
   /** @inheritdoc */
@@ -38,7 +38,6 @@ package org.facsim.sim.model
 
 import org.facsim.sim.{LibResource, SimulationAction}
 import org.facsim.sim.engine.Simulation
-import scala.reflect.runtime.universe.TypeTag
 import squants.Time
 
 /** Standard simulation actions to perform a reset of the simulation's statistics.
@@ -53,20 +52,21 @@ import squants.Time
  *
  *  @param simulation Reference to the executing simulation.
  */
-private[sim] final class EndWarmUpAction[M <: ModelState[M]: TypeTag](snapLength: Time, numSnaps: Int)
+private[sim] final class EndWarmUpAction[M <: ModelState[M]](snapLength: Time, numSnaps: Int)
 (implicit simulation: Simulation[M])
 extends Action[M] {
 
   /** @inheritdoc */
   override protected val actions: SimulationAction[M] = {
 
-    // Report to all subscribers that the simulation has warmed up. Statistics should be reset accordingly.
-    // TODO
-
-    // Schedule the first end snap event.
-    for {
-      r <- simulation.at(snapLength, Int.MaxValue)(new EndSnapAction[M](snapLength, numSnaps - 1))
-    } yield r
+    // Notify the model state that the simulation has warmed up, so that its statistics can be reset, then schedule
+    // the first end snap event.
+    simulation.takeUntilFailure {
+      List[SimulationAction[M]](
+        SnapObserver.warmedUp[M],
+        simulation.at(snapLength, Int.MaxValue)(new EndSnapAction[M](snapLength, numSnaps - 1))
+      )
+    }
   }
 
   /** @inheritdoc */
@@ -36,15 +36,18 @@
 //======================================================================================================================
 package org.facsim.sim.model
 
-import scala.reflect.runtime.universe.TypeTag
-
 /** Base class for model states.
  *
  *  Model state encapsulates the state of a simulation model. It may contain any necessary state information, but each
  *  instance must be ''immutable''.
  *
+ *  Model states are serializable, so that they can be saved as part of a
+ *  `[[org.facsim.sim.engine.SimulationSnapshot SimulationSnapshot]]`; to support this, all of a model state's members
+ *  must also be serializable.
+ *
  *  @tparam M Final model state class, which must be derived from this class.
  *
  *  @since 0.0
  */
-abstract class ModelState[M <: ModelState[M]: TypeTag]
\ No newline at end of file
+abstract class ModelState[M <: ModelState[M]]
+extends Serializable
@@ -0,0 +1,270 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.model package.
+//======================================================================================================================
+package org.facsim.sim.model
+
+import org.facsim.util.requireValid
+import squants.{Length, Time}
+import squants.motion.{MetersPerSecond, MetersPerSecondSquared, RadiansPerSecond, RadiansPerSecondSquared}
+import squants.space.{Angle, Meters, Radians}
+import squants.time.Seconds
+
+/** Structure-of-arrays table of motion states, for evaluating the positions of many elements at once.
+ *
+ *  Each row of the table holds the motion state of a single element, such as a vehicle, as the start time, initial
+ *  velocity and acceleration of its current state, expressed as primitive ''SI'' unit values in separate columns. The
+ *  kind of each state is encoded by these values alone: a stationary state has zero velocity and acceleration, and a
+ *  cruising state has zero acceleration. Consequently, the positions of all elements are evaluated by a single,
+ *  branch-free loop over primitive arrays, which the ''JIT'' compiler can vectorize, without allocating any squants
+ *  quantities.
+ *
+ *  A table may hold either translational states (with positions in meters) or rotational states (with positions in
+ *  radians). Tables holding both kinds of state are permitted, but the units of each row are then those of the state
+ *  stored in it.
+ *
+ *  @note Motion tables are mutable, and are not thread-safe. Initially, every row holds a stationary state that
+ *  started at time zero.
+ *
+ *  @constructor Create a new motion table.
+ *
+ *  @param size Number of elements whose motion states are recorded in the table. This value cannot be negative.
+ *
+ *  @throws IllegalArgumentException if `size` is negative.
+ *
+ *  @since 0.3
+ */
+final class MotionTable(val size: Int) {
+
+  // Sanity check.
+  requireValid(size, size >= 0)
+
+  /** Simulation time, in seconds, at which each element entered its current motion state. */
+  private val startTimes = new Array[Double](size)
+
+  /** Initial velocity of each element's current motion state, in meters or radians per second. */
+  private val velocities = new Array[Double](size)
+
+  /** Constant acceleration of each element's current motion state, in meters or radians per second squared. */
+  private val accelerations = new Array[Double](size)
+
+  /** Record the translational motion state of an element.
+   *
+   *  @param i Index of the element.
+   *
+   *  @param state New translational motion state of the element.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def update(i: Int, state: TranslationalMotionState): Unit = state match {
+    case TranslationalStationaryState(t) => set(i, t, 0.0, 0.0)
+    case TranslationalCruiseState(t, v) => set(i, t, v.to(MetersPerSecond), 0.0)
+    case TranslationalAccelerationState(t, v, a) => set(i, t, v.to(MetersPerSecond), a.to(MetersPerSecondSquared))
+  }
+
+  /** Record the rotational motion state of an element.
+   *
+   *  @param i Index of the element.
+   *
+   *  @param state New rotational motion state of the element.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def update(i: Int, state: RotationalMotionState): Unit = state match {
+    case RotationalStationaryState(t) => set(i, t, 0.0, 0.0)
+    case RotationalCruiseState(t, v) => set(i, t, v.to(RadiansPerSecond), 0.0)
+    case RotationalAccelerationState(t, v, a) => set(i, t, v.to(RadiansPerSecond), a.to(RadiansPerSecondSquared))
+  }
+
+  /** Evaluate the positions of all elements at the specified time.
+   *
+   *  Each position is the distance (in meters) or the angle (in radians) traveled by the element since it entered its
+   *  current motion state, and is identical to that reported by the state's `distance` or `theta` function.
+   *
+   *  @param currentTime Current simulation time. For meaningful results, this must not precede the start time of any
+   *  element's state; this is not checked, so that the evaluation loop remains branch-free.
+   *
+   *  @param values Array to be filled with the position of each element. Its existing contents are overwritten. It must
+   *  have at least `size` elements.
+   *
+   *  @throws IllegalArgumentException if `values` has fewer than `size` elements.
+   *
+   *  @since 0.3
+   */
+  def positions(currentTime: Time, values: Array[Double]): Unit = {
+    requireValid(values, values.length >= size)
+    val now = currentTime.to(Seconds)
+    var i = 0 //scalastyle:ignore var.local
+    while(i < size) { //scalastyle:ignore while
+      val t = now - startTimes(i)
+      values(i) = t * (velocities(i) + 0.5 * accelerations(i) * t)
+      i += 1
+    }
+  }
+
+  /** Evaluate the translational distance traveled by an element at the specified time.
+   *
+   *  @param i Index of the element, which must hold a translational motion state.
+   *
+   *  @param currentTime Current simulation time, which must not precede the start time of the element's state.
+   *
+   *  @return Distance traveled by the element since it entered its current motion state.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def distance(i: Int, currentTime: Time): Length = Meters(position(i, currentTime.to(Seconds)))
+
+  /** Evaluate the rotational angle traveled by an element at the specified time.
+   *
+   *  @param i Index of the element, which must hold a rotational motion state.
+   *
+   *  @param currentTime Current simulation time, which must not precede the start time of the element's state.
+   *
+   *  @return Angle traveled by the element since it entered its current motion state.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def theta(i: Int, currentTime: Time): Angle = Radians(position(i, currentTime.to(Seconds)))
+
+  /** Determine when an element will have traveled a specified distance.
+   *
+   *  The arrival time is determined analytically, so that arrival events can be scheduled directly, rather than by
+   *  repeatedly polling the element's position.
+   *
+   *  @param i Index of the element, which must hold a translational motion state.
+   *
+   *  @param d Distance, measured from the element's position when it entered its current state.
+   *
+   *  @return Earliest simulation time, not preceding the start time of the element's state, at which the element will
+   *  have traveled distance `d`, wrapped in `[[scala.Some Some]]`; or `[[scala.None None]]` if it will never do so in
+   *  its current state.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def timeUntil(i: Int, d: Length): Option[Time] = arrival(i, d.to(Meters))
+
+  /** Determine when an element will have rotated through a specified angle.
+   *
+   *  The arrival time is determined analytically, so that arrival events can be scheduled directly, rather than by
+   *  repeatedly polling the element's position.
+   *
+   *  @param i Index of the element, which must hold a rotational motion state.
+   *
+   *  @param theta Angle, measured from the element's orientation when it entered its current state.
+   *
+   *  @return Earliest simulation time, not preceding the start time of the element's state, at which the element will
+   *  have rotated through angle `theta`, wrapped in `[[scala.Some Some]]`; or `[[scala.None None]]` if it will never do
+   *  so in its current state.
+   *
+   *  @throws ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def timeUntil(i: Int, theta: Angle): Option[Time] = arrival(i, theta.to(Radians))
+
+  /** Store the motion state of an element.
+   *
+   *  @param i Index of the element.
+   *
+   *  @param startTime Time at which the element entered the state.
+   *
+   *  @param v Initial velocity, in ''SI'' units.
+   *
+   *  @param a Constant acceleration, in ''SI'' units.
+   */
+  private def set(i: Int, startTime: Time, v: Double, a: Double): Unit = {
+    startTimes(i) = startTime.to(Seconds)
+    velocities(i) = v
+    accelerations(i) = a
+  }
+
+  /** Evaluate the position of an element.
+   *
+   *  @param i Index of the element.
+   *
+   *  @param now Current simulation time, in seconds.
+   *
+   *  @return Position of the element relative to the start of its state, in ''SI'' units.
+   */
+  private def position(i: Int, now: Double): Double = {
+    val t = now - startTimes(i)
+    t * (velocities(i) + 0.5 * accelerations(i) * t)
+  }
+
+  /** Solve for the earliest time at which an element reaches a position.
+   *
+   *  The position, `d`, satisfies `a t² / 2 + v t - d = 0`, which is solved using the numerically stable form of the
+   *  quadratic formula, so that small accelerations do not suffer from cancellation errors.
+   *
+   *  @param i Index of the element.
+   *
+   *  @param d Position to be reached, relative to the start of the element's state, in ''SI'' units.
+   *
+   *  @return Earliest simulation time at which the element reaches the position, if it does so.
+   */
+  private def arrival(i: Int, d: Double): Option[Time] = {
+    val v = velocities(i)
+    val a = accelerations(i)
+    val t = {
+      if(d == 0.0) 0.0
+      else if(a == 0.0) {
+        if(v == 0.0) Double.NaN
+        else d / v
+      }
+      else {
+        val discriminant = v * v + 2.0 * a * d
+        if(discriminant < 0.0) Double.NaN
+        else {
+          val q = -0.5 * (v + Math.copySign(Math.sqrt(discriminant), v))
+          val r1 = q / (0.5 * a)
+          val r2 = if(q == 0.0) Double.NaN else -d / q
+          if(r1 >= 0.0 && !(r2 >= 0.0 && r2 < r1)) r1
+          else r2
+        }
+      }
+    }
+    Option.when(t >= 0.0)(Seconds(startTimes(i) + t))
+  }
+}
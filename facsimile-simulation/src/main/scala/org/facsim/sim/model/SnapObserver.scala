@@ -0,0 +1,128 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.model package.
+//======================================================================================================================
+package org.facsim.sim.model
+
+import cats.data.State
+import org.facsim.sim.SimulationAction
+import org.facsim.sim.engine.{Simulation, SimulationState}
+import scala.util.{Success, Try}
+import squants.Time
+
+/** Trait for model states that maintain statistics which are to be reset at the end of the warm-up period, and at the
+ *  end of each simulation snap.
+ *
+ *  If a simulation's model state implements this trait, then the simulation notifies it when the warm-up period ends,
+ *  and when each snap ends, so that time-persistent statistics—such as `[[WIPStatistic]]`—can be reset and their
+ *  batch means recorded. Both notifications are made after all other events occurring at the same simulation time.
+ *
+ *  @tparam M Final type of the simulation's model state.
+ *
+ *  @since 0.3
+ */
+trait SnapObserver[M <: ModelState[M]] {
+  self: M =>
+
+  /** Update the model state at the end of the warm-up period.
+   *
+   *  Statistics gathered during the warm-up period are subject to ''initialization bias'', and should be discarded.
+   *
+   *  @param time Simulation time at which the warm-up period ended.
+   *
+   *  @return Updated model state.
+   *
+   *  @since 0.3
+   */
+  def warmedUp(time: Time): M
+
+  /** Update the model state at the end of a simulation snap.
+   *
+   *  @param time Simulation time at which the snap ended.
+   *
+   *  @return Updated model state.
+   *
+   *  @since 0.3
+   */
+  def snapEnded(time: Time): M
+}
+
+/** Snap observer companion. */
+private[model] object SnapObserver {
+
+  /** Notify the model state that the warm-up period has ended.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @param simulation Simulation whose warm-up period has ended.
+   *
+   *  @return Actions notifying the model state, if it is a snap observer.
+   */
+  def warmedUp[M <: ModelState[M]](implicit simulation: Simulation[M]): SimulationAction[M] = {
+    observe[M](_.warmedUp(_))
+  }
+
+  /** Notify the model state that a snap has ended.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @param simulation Simulation whose snap has ended.
+   *
+   *  @return Actions notifying the model state, if it is a snap observer.
+   */
+  def snapEnded[M <: ModelState[M]](implicit simulation: Simulation[M]): SimulationAction[M] = {
+    observe[M](_.snapEnded(_))
+  }
+
+  /** Notify the model state of a snap event, if it is a snap observer.
+   *
+   *  @tparam M Final type of the simulation's model state.
+   *
+   *  @param f Notification to be applied to the model state at the current simulation time.
+   *
+   *  @param simulation Simulation in which the event occurred.
+   *
+   *  @return Actions notifying the model state. If the model state is not a snap observer, it is left unchanged.
+   */
+  private def observe[M <: ModelState[M]](f: (SnapObserver[M], Time) => M)(implicit simulation: Simulation[M]):
+  SimulationAction[M] = for {
+    t <- simulation.time
+    ms <- simulation.modelState
+    r <- ms match {
+      case o: SnapObserver[M @unchecked] => simulation.updateModelState(f(o, t))
+      case _ => State.pure[SimulationState[M], Try[Unit]](Success(()))
+    }
+  } yield r
+}
@@ -0,0 +1,234 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.model package.
+//======================================================================================================================
+package org.facsim.sim.model
+
+import org.facsim.stat.{ConfidenceInterval, SummaryStatistics}
+import org.facsim.util.requireValid
+import squants.Time
+import squants.time.Seconds
+
+/** Time-weighted ''work-in-progress'' (''WIP'') statistic.
+ *
+ *  Tracks a non-negative level—such as the number of items in a queue, or in a process—that changes at discrete
+ *  instants of simulation time, together with the time-weighted mean level of each simulation snap. Each change is
+ *  recorded in constant time and space.
+ *
+ *  The mean level of each completed snap is retained as a ''batch mean''. Provided that snaps are long enough for
+ *  their means to be approximately independent, a confidence interval for the steady-state mean level can then be
+ *  obtained from a single long run, rather than from many replications, each of which requires its own warm-up.
+ *
+ *  Instances are immutable, and belong in a simulation's model state. To have snap boundaries recorded automatically,
+ *  the model state should implement `[[SnapObserver]]`, calling `[[reset]]` from its `warmedUp` implementation and
+ *  `[[endSnap]]` from its `snapEnded` implementation. The current simulation time, required by each operation, is
+ *  available from `[[org.facsim.sim.engine.Simulation.time Simulation.time]]`.
+ *
+ *  @constructor Create a new statistic. Statistics should typically be created from [[WIPStatistic.Empty]].
+ *
+ *  @param current Current level.
+ *
+ *  @param minimum Smallest level since the statistic was last reset.
+ *
+ *  @param maximum Largest level since the statistic was last reset.
+ *
+ *  @param snapStart Simulation time, in seconds, at which the current snap started.
+ *
+ *  @param lastChange Simulation time, in seconds, at which the level last changed, or at which the current snap
+ *  started, whichever is later.
+ *
+ *  @param area Integral of the level, with respect to simulation time in seconds, from `snapStart` to `lastChange`.
+ *
+ *  @param snapMeans Time-weighted mean level of each snap completed since the statistic was last reset, in order of
+ *  completion.
+ *
+ *  @since 0.3
+ */
+final case class WIPStatistic(current: Int, minimum: Int, maximum: Int, snapStart: Double, lastChange: Double,
+area: Double, snapMeans: Vector[Double]) {
+
+  /** Change the level.
+   *
+   *  @param delta Change in the level. The resulting level must not be negative.
+   *
+   *  @param time Current simulation time, which must not precede the time of the previous change.
+   *
+   *  @return Updated statistic.
+   *
+   *  @throws IllegalArgumentException if the resulting level is negative, or if `time` precedes the previous change.
+   *
+   *  @since 0.3
+   */
+  def update(delta: Int, time: Time): WIPStatistic = {
+    val now = seconds(time)
+    val level = current + delta
+    requireValid(delta, level >= 0)
+    copy(current = level, minimum = Math.min(minimum, level), maximum = Math.max(maximum, level), lastChange = now,
+    area = areaTo(now))
+  }
+
+  /** Time-weighted mean level of the current snap.
+   *
+   *  @param time Current simulation time, which must not precede the time of the previous change.
+   *
+   *  @return Time-weighted mean level from the start of the current snap until `time`, wrapped in
+   *  `[[scala.Some Some]]`, or `[[scala.None None]]` if no simulation time has elapsed since the snap started.
+   *
+   *  @throws IllegalArgumentException if `time` precedes the previous change.
+   *
+   *  @since 0.3
+   */
+  def snapMean(time: Time): Option[Double] = {
+    val now = seconds(time)
+    val length = now - snapStart
+    Option.when(length > 0.0)(areaTo(now) / length)
+  }
+
+  /** End the current snap, recording its mean level as a batch mean, and start a new snap.
+   *
+   *  If no simulation time has elapsed since the current snap started, no batch mean is recorded.
+   *
+   *  @param time Current simulation time, which must not precede the time of the previous change.
+   *
+   *  @return Updated statistic.
+   *
+   *  @throws IllegalArgumentException if `time` precedes the previous change.
+   *
+   *  @since 0.3
+   */
+  def endSnap(time: Time): WIPStatistic = {
+    val now = seconds(time)
+    WIPStatistic(current, minimum, maximum, now, now, 0.0, snapMeans ++ snapMean(time))
+  }
+
+  /** Discard all statistics, and start a new snap.
+   *
+   *  This is typically performed at the end of the warm-up period. The current level is retained.
+   *
+   *  @param time Current simulation time, which must not precede the time of the previous change.
+   *
+   *  @return Statistic retaining only the current level.
+   *
+   *  @throws IllegalArgumentException if `time` precedes the previous change.
+   *
+   *  @since 0.3
+   */
+  def reset(time: Time): WIPStatistic = {
+    val now = seconds(time)
+    WIPStatistic(current, current, current, now, now, 0.0, Vector.empty)
+  }
+
+  /** Summary of the batch means.
+   *
+   *  @return Summary statistics of the mean levels of the snaps completed since the last reset.
+   *
+   *  @since 0.3
+   */
+  def batchMeans: SummaryStatistics = SummaryStatistics(snapMeans)
+
+  /** Batch means confidence interval for the steady-state mean level.
+   *
+   *  Each completed snap is treated as a single batch. The interval is only valid if the batch means are approximately
+   *  independent, which requires that each snap be long relative to the time over which the level is correlated.
+   *
+   *  @param level Required confidence level, in the range (0, 1).
+   *
+   *  @return Confidence interval for the mean level, wrapped in `[[scala.Some Some]]`, or `[[scala.None None]]` if no
+   *  snaps have completed since the last reset.
+   *
+   *  @throws IllegalArgumentException if `level` is outside of the range (0, 1).
+   *
+   *  @since 0.3
+   */
+  def batchMeansInterval(level: Double): Option[ConfidenceInterval] = {
+    requireValid(level, level > 0.0 && level < 1.0)
+    Option.when(snapMeans.nonEmpty)(ConfidenceInterval(batchMeans, level))
+  }
+
+  /** Convert a simulation time to seconds, verifying that it does not precede the previous change.
+   *
+   *  @param time Simulation time to be converted.
+   *
+   *  @return `time`, measured in seconds.
+   */
+  private def seconds(time: Time): Double = {
+    val now = time.to(Seconds)
+    requireValid(time, now >= lastChange)
+    now
+  }
+
+  /** Integral of the level from the start of the current snap until the specified time.
+   *
+   *  @param now Simulation time, in seconds, which must not precede the time of the previous change.
+   *
+   *  @return Integral of the level, with respect to simulation time in seconds, from `snapStart` to `now`.
+   */
+  private def areaTo(now: Double): Double = area + current.toDouble * (now - lastChange)
+}
+
+/** Work-in-progress statistic companion.
+ *
+ *  @since 0.3
+ */
+object WIPStatistic {
+
+  /** Statistic with a zero level at the start of a simulation run.
+   *
+   *  @since 0.3
+   */
+  val Empty: WIPStatistic = WIPStatistic(0, 0, 0, 0.0, 0.0, 0.0, Vector.empty)
+
+  /** Snap-level confidence intervals, across independent replications.
+   *
+   *  For each snap, the mean levels reported for that snap by each replication are treated as independent
+   *  observations.
+   *
+   *  @param replications Statistics reported at the end of each independent replication. Replications that completed
+   *  fewer snaps than others contribute only to the snaps that they completed.
+   *
+   *  @param level Required confidence level, in the range (0, 1).
+   *
+   *  @return Confidence interval for the mean level of each snap, in snap order.
+   *
+   *  @throws IllegalArgumentException if `level` is outside of the range (0, 1).
+   *
+   *  @since 0.3
+   */
+  def snapIntervals(replications: Iterable[WIPStatistic], level: Double): Vector[ConfidenceInterval] = {
+    requireValid(level, level > 0.0 && level < 1.0)
+    val snaps = if(replications.isEmpty) 0 else replications.map(_.snapMeans.length).max
+    Vector.tabulate(snaps)(i => ConfidenceInterval(replications.flatMap(_.snapMeans.lift(i)), level))
+  }
+}
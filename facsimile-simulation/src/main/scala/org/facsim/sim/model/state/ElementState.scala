@@ -38,7 +38,6 @@ package org.facsim.sim.model.state
 
 import org.facsim.sim.model.structure.Element
 import org.facsim.sim.model.{Point, Rotation}
-import scala.reflect.runtime.universe.TypeTag
 
 // TEMPORARY NOTE:
 //
@@ -56,7 +55,7 @@ import scala.reflect.runtime.universe.TypeTag
 
  *  @since 0.0
  */
-abstract class ElementState[E <: Element[E, S]: TypeTag, S <: ElementState[E, S]: TypeTag] {
+abstract class ElementState[E <: Element[E, S], S <: ElementState[E, S]] {
 
   /** Child elements, mapped by name.
    *
@@ -37,7 +37,6 @@
 package org.facsim.sim.model.structure
 
 import org.facsim.sim.model.state.ElementState
-import scala.reflect.runtime.universe.TypeTag
 
 /** Base class for all simulation model elements.
  *
@@ -47,7 +46,7 @@ import scala.reflect.runtime.universe.TypeTag
  *
  *  @since 0.2
  */
-abstract class Element[E <: Element[E, S]: TypeTag, S <: ElementState[E, S]: TypeTag] {
+abstract class Element[E <: Element[E, S], S <: ElementState[E, S]] {
 
   /** Name of this element.
    *
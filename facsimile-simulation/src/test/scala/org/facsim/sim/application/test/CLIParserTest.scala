@@ -39,6 +39,7 @@ package org.facsim.sim.application.test
 import java.io.File
 import java.util.Locale
 import org.facsim.sim.application.{CLIParser, FacsimileConfig}
+import org.facsim.stat.prng.SimplePRNG
 import org.facsim.util.LS
 import org.facsim.util.log._
 import org.facsim.util.test.withLocale
@@ -106,6 +107,12 @@ with ScalaCheckPropertyChecks {
     /** Configuration file long option. */
     lazy val configFileLongOpt: String = "--config-file"
 
+    /** Fork warm-up short option. */
+    lazy val forkWarmUpShortOpt: String = "-f"
+
+    /** Fork warm-up long option. */
+    lazy val forkWarmUpLongOpt: String = "--fork-warm-up"
+
     /** Help short option. */
     lazy val helpShortOpt: String = "-h"
 
@@ -118,6 +125,18 @@ with ScalaCheckPropertyChecks {
     /** Headless long option */
     lazy val headlessLongOpt = "--headless"
 
+    /** Instrument short option. */
+    lazy val instrumentShortOpt: String = "-i"
+
+    /** Instrument long option. */
+    lazy val instrumentLongOpt: String = "--instrument"
+
+    /** Load warm-up short option. */
+    lazy val loadWarmUpShortOpt: String = "-w"
+
+    /** Load warm-up long option. */
+    lazy val loadWarmUpLongOpt: String = "--load-warm-up"
+
     /** Log file short option. */
     lazy val logFileShortOpt: String = "-l"
 
@@ -143,12 +162,65 @@ with ScalaCheckPropertyChecks {
     /** Invalid log level. */
     lazy val invalidLogLevel: String = "invalid"
 
+    /** Replications short option. */
+    lazy val replicationsShortOpt: String = "-n"
+
+    /** Replications long option. */
+    lazy val replicationsLongOpt: String = "--replications"
+
     /** Report file short option. */
     lazy val reportFileShortOpt: String = "-r"
 
     /** Report file long option. */
     lazy val reportFileLongOpt: String = "--report-file"
 
+    /** Save warm-up short option. */
+    lazy val saveWarmUpShortOpt: String = "-s"
+
+    /** Save warm-up long option. */
+    lazy val saveWarmUpLongOpt: String = "--save-warm-up"
+
+    /** Threads short option. */
+    lazy val threadsShortOpt: String = "-t"
+
+    /** Threads long option. */
+    lazy val threadsLongOpt: String = "--threads"
+
+    /** Test a particular count option.
+     *
+     * @param name Name of the counted quantity.
+     *
+     * @param short Short count option.
+     *
+     * @param long Long count option.
+     *
+     * @param invalid Invalid count values.
+     *
+     * @param expected Function taking a valid count and reporting the expected resulting configuration.
+     */
+    protected[test] def testCountOption(name: String, short: String, long: String, invalid: Seq[Int],
+    expected: Int => FacsimileConfig): Unit = {
+      it(s"must reject invalid $name options") {
+        new TestData {
+          assert(parser.parse(Seq(short)) === None)
+          assert(parser.parse(Seq(long)) === None)
+          assert(parser.parse(Seq(short, invalidArg)) === None)
+          invalid.foreach {n =>
+            assert(parser.parse(Seq(short, n.toString)) === None)
+            assert(parser.parse(Seq(long, n.toString)) === None)
+          }
+        }
+      }
+      it(s"must accept valid $name options") {
+        new TestData {
+          Seq(1, 2, 30, 100).foreach {n =>
+            assert(parser.parse(Seq(short, n.toString)) === Some(expected(n)))
+            assert(parser.parse(Seq(long, n.toString)) === Some(expected(n)))
+          }
+        }
+      }
+    }
+
     /** Version header information. */
     lazy val versionHeader = s"$appName$LS${appCopyright.mkString(LS)}${LS}Version: $appVersion"
 
@@ -210,12 +282,18 @@ with ScalaCheckPropertyChecks {
           // Verify the default configuration
           result.foreach {c =>
             assert(c.configFile === None)
+            assert(c.forkWarmUp === false)
+            assert(c.instrument === false)
+            assert(c.loadWarmUp === None)
             assert(c.logFile === None)
             assert(c.logLevel === WarningSeverity)
+            assert(c.replications === 1)
             assert(c.reportFile === None)
             assert(c.runModel === true)
+            assert(c.saveWarmUp === None)
             assert(c.showUsage === false)
             assert(c.showVersion === false)
+            assert(c.threads === Runtime.getRuntime.availableProcessors)
             assert(c.useGUI === true)
           }
         }
@@ -241,6 +319,15 @@ with ScalaCheckPropertyChecks {
         testOption("config", configFileShortOpt, configFileLongOpt, FacsimileConfig(configFile = Some(file)))
       }
 
+      // Verify that it accepts fork warm-up options.
+      it("must accept fork warm-up options") {
+        new TestData {
+          val expectedCfg = FacsimileConfig(forkWarmUp = true)
+          assert(parser.parse(Seq(forkWarmUpShortOpt)) === Some(expectedCfg))
+          assert(parser.parse(Seq(forkWarmUpLongOpt)) === Some(expectedCfg))
+        }
+      }
+
       // Verify that it accepts headless mode option.
       it("must accept headless mode options") {
         new TestData {
@@ -259,6 +346,21 @@ with ScalaCheckPropertyChecks {
         }
       }
 
+      // Verify that it accepts instrument options.
+      it("must accept instrument options") {
+        new TestData {
+          val expectedCfg = FacsimileConfig(instrument = true)
+          assert(parser.parse(Seq(instrumentShortOpt)) === Some(expectedCfg))
+          assert(parser.parse(Seq(instrumentLongOpt)) === Some(expectedCfg))
+        }
+      }
+
+      // Verify that it accepts load warm-up options, which imply forking the warm-up.
+      new TestData {
+        testOption("load warm-up", loadWarmUpShortOpt, loadWarmUpLongOpt,
+          FacsimileConfig(forkWarmUp = true, loadWarmUp = Some(file)))
+      }
+
       // Verify that it accepts log file options.
       new TestData {
         testOption("log", logFileShortOpt, logFileLongOpt, FacsimileConfig(logFile = Some(file)))
@@ -284,11 +386,28 @@ with ScalaCheckPropertyChecks {
         }
       }
 
+      // Verify that it accepts replications options.
+      new TestData {
+        testCountOption("replications", replicationsShortOpt, replicationsLongOpt,
+          Seq(-1, 0, SimplePRNG.StreamCount + 1), n => FacsimileConfig(replications = n))
+      }
+
       // Verify that it accepts report file options.
       new TestData {
         testOption("report", reportFileShortOpt, reportFileLongOpt, FacsimileConfig(reportFile = Some(file)))
       }
 
+      // Verify that it accepts save warm-up options, which imply forking the warm-up.
+      new TestData {
+        testOption("save warm-up", saveWarmUpShortOpt, saveWarmUpLongOpt,
+          FacsimileConfig(forkWarmUp = true, saveWarmUp = Some(file)))
+      }
+
+      // Verify that it accepts threads options.
+      new TestData {
+        testCountOption("threads", threadsShortOpt, threadsLongOpt, Seq(-1, 0), n => FacsimileConfig(threads = n))
+      }
+
       // Verify that it accepts the version option correctly.
       it("must accept version options and exit immediately") {
         new TestData {
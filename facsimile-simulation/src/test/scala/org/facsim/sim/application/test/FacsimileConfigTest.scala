@@ -0,0 +1,135 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.application.test package.
+//======================================================================================================================
+package org.facsim.sim.application.test
+
+import com.typesafe.config.ConfigException
+import java.io.File
+import java.nio.charset.StandardCharsets
+import java.nio.file.Files
+import org.facsim.sim.application.FacsimileConfig
+import org.facsim.sim.engine.{EventCalendarType, PersistentHeapCalendar}
+import org.scalatest.funspec.AnyFunSpec
+import squants.time.Microseconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[FacsimileConfig]] class. */
+final class FacsimileConfigTest
+extends AnyFunSpec {
+
+  /** Create a configuration from the contents of a temporary configuration file.
+   *
+   *  @param contents HOCON contents of the configuration file.
+   *
+   *  @return Configuration utilizing a temporary file with the indicated `contents`.
+   */
+  def withConfigFile(contents: String): FacsimileConfig = {
+    val file = File.createTempFile("FacsimileConfigTest", ".conf")
+    file.deleteOnExit()
+    Files.write(file.toPath, contents.getBytes(StandardCharsets.UTF_8))
+    FacsimileConfig(configFile = Some(file))
+  }
+
+  // Test the class.
+  describe(classOf[FacsimileConfig].getCanonicalName) {
+
+    // Test the seed setting.
+    describe(".seed") {
+
+      // Verify the default seed.
+      it("must default to 0") {
+        assert(FacsimileConfig().seed === 0L)
+      }
+
+      // Verify that the seed can be configured.
+      it("must report the configured seed") {
+        val cfg = withConfigFile("facsimile.simulation.seed = 8682522807148012")
+        assert(cfg.seed === 8682522807148012L)
+      }
+    }
+
+    // Test the time resolution setting.
+    describe(".timeResolution") {
+
+      // Verify the default time resolution.
+      it("must default to 1 microsecond") {
+        assert(Math.abs(FacsimileConfig().timeResolution.to(Microseconds) - 1.0) < 1.0e-9)
+      }
+
+      // Verify that the time resolution can be configured.
+      it("must report the configured time resolution") {
+        val cfg = withConfigFile("facsimile.simulation.time-resolution = 1 s")
+        assert(cfg.timeResolution.to(Microseconds) === 1.0e6)
+      }
+    }
+
+    // Test the event calendar setting.
+    describe(".eventCalendar") {
+
+      // Verify the default event calendar type.
+      it("must default to a persistent heap") {
+        assert(FacsimileConfig().eventCalendar === PersistentHeapCalendar)
+      }
+
+      // Verify that each event calendar type can be configured.
+      it("must report the configured event calendar type") {
+        EventCalendarType.values.foreach {ct =>
+          val cfg = withConfigFile(s"facsimile.simulation.event-queue = ${ct.configValue}")
+          assert(cfg.eventCalendar === ct)
+        }
+      }
+
+      // Verify that invalid values are rejected.
+      it("must throw a ConfigException if the configured event calendar type is invalid") {
+        val cfg = withConfigFile("facsimile.simulation.event-queue = splay-tree")
+        assertThrows[ConfigException] {
+          cfg.eventCalendar
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,118 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.engine.{Event, EventCalendar, EventCalendarType, Simulation}
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Hold benchmark comparing the available event calendars.
+ *
+ *  Each calendar is first filled with the indicated number of pending events, each due after an exponentially
+ *  distributed delay. Each measurement then performs `HoldsPerRun` ''hold'' operations, each removing the next event
+ *  and replacing it with an event due after a further exponentially-distributed delay, keeping the number of pending
+ *  events constant. Hold operations per second is given by dividing `HoldsPerRun` by the reported time.
+ *
+ *  @note Benchmarking with 10^7^ pending events requires a large heap.
+ */
+object EventCalendarBenchmark
+extends RegressionBenchmark {
+
+  /** Number of hold operations performed by each measurement. */
+  val HoldsPerRun = 100000
+
+  /** Numbers of pending events to be benchmarked. */
+  val pending: Gen[Int] = Gen.exponential("pending")(1000, 10000000, 10)
+
+  /** Simulation to which benchmark events belong. */
+  implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+
+  /** Action shared by all benchmark events. */
+  val action = new HoldAction
+
+  /** Create a calendar filled with pending events.
+   *
+   *  @param ct Type of calendar to be created.
+   *
+   *  @param n Number of pending events.
+   *
+   *  @return Calendar containing `n` events, together with the model state used to sample subsequent delays.
+   */
+  def fill(ct: EventCalendarType, n: Int): (EventCalendar[HoldModelState], HoldModelState) = {
+    (0 until n).foldLeft((ct.create[HoldModelState], HoldModel.initialState(n.toLong))) {
+      case ((c, m), i) =>
+        val (d, nm) = m.nextHold
+        (c + Event(i.toLong, simulation.toTicks(d), 0, action), nm)
+    }
+  }
+
+  /** Perform hold operations on a calendar.
+   *
+   *  @param init Calendar, and model state used to sample delays.
+   *
+   *  @param nextId Identifier of the first event to be created.
+   */
+  def hold(init: (EventCalendar[HoldModelState], HoldModelState), nextId: Long): Unit = {
+    val (c, _) = (0 until HoldsPerRun).foldLeft(init) {
+      case ((ec, m), i) =>
+        val (me, rc) = ec.minimumRemove
+        val (d, nm) = m.nextHold
+        (rc + Event(nextId + i, me.get.dueAt + simulation.toTicks(d), 0, action), nm)
+    }
+    assert(c.size == init._1.size)
+  }
+
+  performance of "EventCalendar" in {
+    EventCalendarType.values.foreach {ct =>
+      measure method s"hold (${ct.name})" in {
+        using(pending.map(n => (n, fill(ct, n)))) in {
+          case (n, init) => hold(init, n.toLong)
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
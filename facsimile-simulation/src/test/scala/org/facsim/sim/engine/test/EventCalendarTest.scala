@@ -0,0 +1,241 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.engine.{CalendarQueueEventCalendar, Event, EventCalendar, EventCalendarType, Simulation}
+import org.scalacheck.Gen
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import org.scalatest.funspec.AnyFunSpec
+import scala.annotation.tailrec
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the `[[org.facsim.sim.engine.EventCalendar EventCalendar]]` implementations. */
+final class EventCalendarTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Test data. */
+  trait TestData {
+
+    /** Simulation to which test events belong. */
+    implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+
+    /** Action shared by all test events. */
+    val action = new HoldAction
+
+    /** Generator for event due times, in clock ticks, and priorities. Few distinct values are used, so that ties are
+     *  common.
+     */
+    val keysGen: Gen[List[(Int, Int)]] = Gen.listOf(Gen.zip(Gen.choose(0, 20), Gen.choose(-2, 2)))
+
+    /** Create events from a list of keys.
+     *
+     *  @param keys Due times, in clock ticks, and priorities of the events to be created.
+     *
+     *  @return Events, with identifiers in creation order.
+     */
+    def events(keys: List[(Int, Int)]): List[Event[HoldModelState]] = keys.zipWithIndex.map {
+      case ((t, p), i) => Event(i.toLong, t.toLong, p, action)
+    }
+
+    /** Generator for widely-distributed event due times, in clock ticks, including clusters of very close times. */
+    val timesGen: Gen[List[Long]] = Gen.choose(0, 2000).flatMap {n =>
+      Gen.listOfN(n, Gen.oneOf(Gen.choose(0L, 1000000000000L), Gen.choose(0L, 10L), Gen.const(42L)))
+    }
+
+    /** Remove all events from a calendar.
+     *
+     *  @param c Calendar to be drained.
+     *
+     *  @return Events in the order in which they were removed.
+     */
+    def drain(c: EventCalendar[HoldModelState]): List[Event[HoldModelState]] = {
+      @tailrec
+      def next(ec: EventCalendar[HoldModelState], acc: List[Event[HoldModelState]]): List[Event[HoldModelState]] = {
+        ec.minimumRemove match {
+          case (Some(e), rc) => next(rc, e :: acc)
+          case (None, _) => acc.reverse
+        }
+      }
+      next(c, Nil)
+    }
+  }
+
+  // Test each calendar type in turn.
+  EventCalendarType.values.foreach {ct =>
+    describe(s"${ct.name} event calendar") {
+
+      // Verify that new calendars are empty.
+      it("must be empty when created") {
+        new TestData {
+          val c = ct.create[HoldModelState]
+          assert(c.isEmpty)
+          assert(c.size === 0)
+          assert(c.minimumRemove._1 === None)
+        }
+      }
+
+      // Verify that the number of events is tracked.
+      it("must report the number of events scheduled") {
+        new TestData {
+          forAll(keysGen) {keys =>
+            val c = events(keys).foldLeft(ct.create[HoldModelState])(_ + _)
+            assert(c.size === keys.size)
+            assert(c.isEmpty === keys.isEmpty)
+          }
+        }
+      }
+
+      // Verify that events are removed in dispatch order.
+      it("must remove events in order of due time, priority and identifier") {
+        new TestData {
+          forAll(keysGen) {keys =>
+            val es = events(keys)
+            val c = es.foldLeft(ct.create[HoldModelState])(_ + _)
+            assert(drain(c) === es.sorted)
+          }
+        }
+      }
+
+      // Verify that events with widely-distributed due times are removed in dispatch order.
+      it("must remove events in order when due times are widely distributed") {
+        new TestData {
+          forAll(timesGen, minSuccessful(20)) {times =>
+            val es = times.zipWithIndex.map {
+              case (t, i) => Event(i.toLong, t, 0, action)
+            }
+            val c = es.foldLeft(ct.create[HoldModelState])(_ + _)
+            assert(drain(c) === es.sorted)
+          }
+        }
+      }
+
+      // Verify that a calendar can sustain hold operations, in which each removed event is replaced by a later event.
+      it("must remove events in order during hold operations") {
+        new TestData {
+          forAll(Gen.choose(1, 500), Gen.choose(Long.MinValue, Long.MaxValue), minSuccessful(20)) {(pending, seed) =>
+            val init = HoldModel.initialState(seed)
+            val (es, ms) = (0 until pending).foldLeft((List.empty[Event[HoldModelState]], init)) {
+              case ((acc, m), i) =>
+                val (d, nm) = m.nextHold
+                (Event(i.toLong, simulation.toTicks(d), 0, action) :: acc, nm)
+            }
+            val c = es.foldLeft(ct.create[HoldModelState])(_ + _)
+            val (_, _, removed, rc) = (0 until pending * 4).foldLeft((ms, pending.toLong,
+            List.empty[Event[HoldModelState]], c)) {
+              case ((m, id, acc, ec), _) =>
+                val (me, ec2) = ec.minimumRemove
+                val e = me.get
+                val (d, nm) = m.nextHold
+                (nm, id + 1, e :: acc, ec2 + Event(id, e.dueAt + simulation.toTicks(d), 0, action))
+            }
+            val dispatched = removed.reverse ++ drain(rc)
+            assert(dispatched === dispatched.sorted)
+            assert(dispatched.size === pending * 5)
+          }
+        }
+      }
+
+      // Verify that bulk insertion is equivalent to inserting events one at a time.
+      it("must add events in bulk") {
+        new TestData {
+          forAll(keysGen, keysGen) {(k1, k2) =>
+            val es = events(k1 ++ k2)
+            val (e1, e2) = es.splitAt(k1.size)
+            val c = e1.foldLeft(ct.create[HoldModelState])(_ + _) ++ e2
+            assert(c.size === es.size)
+            assert(drain(c) === es.sorted)
+          }
+        }
+      }
+
+      // Verify that removals and insertions can be interleaved.
+      it("must maintain order when insertions and removals are interleaved") {
+        new TestData {
+          forAll(keysGen, keysGen) {(k1, k2) =>
+            val es = events(k1 ++ k2)
+            val (e1, e2) = es.splitAt(k1.size)
+            val c1 = e1.foldLeft(ct.create[HoldModelState])(_ + _)
+            val (m, c2) = c1.minimumRemove
+            val c3 = e2.foldLeft(c2)(_ + _)
+            assert(m === e1.sorted.headOption)
+            assert(drain(c3) === (e1.sorted.drop(1) ++ e2).sorted)
+          }
+        }
+      }
+    }
+  }
+
+  // Test calendar queue performance.
+  describe("Calendar queue event calendar") {
+
+    // Verify that the day width adapts to events that are far apart, relative to the clock resolution, even when the
+    // number of pending events never changes.
+    it("must examine a constant number of buckets per operation during hold operations") {
+      new TestData {
+        val pending = 1000
+        val holds = 100000
+        val init = HoldModel.initialState(1L)
+        val (es, ms) = (0 until pending).foldLeft((List.empty[Event[HoldModelState]], init)) {
+          case ((acc, m), i) =>
+            val (d, nm) = m.nextHold
+            (Event(i.toLong, simulation.toTicks(d), 0, action) :: acc, nm)
+        }
+        val c = es.foldLeft(new CalendarQueueEventCalendar[HoldModelState])(_ + _)
+        val (_, _, rc) = (0 until holds).foldLeft((ms, pending.toLong, c)) {
+          case ((m, id, ec), _) =>
+            val (me, ec2) = ec.minimumRemove
+            val (d, nm) = m.nextHold
+            (nm, id + 1, ec2 + Event(id, me.get.dueAt + simulation.toTicks(d), 0, action))
+        }
+        assert(rc.size === pending)
+        assert(rc.bucketsExamined < 10L * (pending + holds).toLong)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,191 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import cats.data.State
+import org.facsim.sim.{Priority, SimulationAction}
+import org.facsim.sim.engine.{Simulation, SimulationState}
+import org.facsim.sim.model.{Action, ModelState}
+import scala.util.{Success, Try}
+import squants.Time
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Model state for the ''hold model'', a standard benchmark for discrete-event simulation engines.
+ *
+ *  A hold model keeps a constant number of pending events: each event dispatched schedules exactly one successor event,
+ *  following an exponentially-distributed ''hold'' time.
+ *
+ *  @param draws Number of hold times sampled so far.
+ *
+ *  @param seed Current seed of the model's linear congruential random number stream.
+ */
+final case class HoldModelState(draws: Long, seed: Long)
+extends ModelState[HoldModelState] {
+
+  /** Sample the next hold time.
+   *
+   *  @return Sampled hold time, together with the updated model state.
+   */
+  def nextHold: (Time, HoldModelState) = {
+    val nextSeed = seed * HoldModel.Multiplier + HoldModel.Increment
+    val u = (nextSeed >>> HoldModel.Shift) * HoldModel.Scale
+    (Seconds(-HoldModel.MeanHold * Math.log(1.0 - u)), HoldModelState(draws + 1, nextSeed))
+  }
+}
+
+/** Hold event action: record a dispatch and schedule a successor event.
+ *
+ *  @param simulation Simulation in which the hold model is executing.
+ */
+final class HoldAction(implicit simulation: Simulation[HoldModelState])
+extends Action[HoldModelState] {
+
+  /** @inheritdoc */
+  override protected val actions: SimulationAction[HoldModelState] = HoldModel.hold
+
+  /** @inheritdoc */
+  override val name: String = "Hold"
+
+  /** @inheritdoc */
+  override val description: String = "Hold model event, scheduling a single successor event."
+}
+
+/** Hold model helpers. */
+object HoldModel {
+
+  /** Mean hold time, in seconds. */
+  val MeanHold: Double = 1.0
+
+  /** Linear congruential generator multiplier (from Knuth's ''MMIX''). */
+  private[test] val Multiplier: Long = 6364136223846793005L
+
+  /** Linear congruential generator increment (from Knuth's ''MMIX''). */
+  private[test] val Increment: Long = 1442695040888963407L
+
+  /** Shift retaining the 53 most significant bits of the seed. */
+  private[test] val Shift: Int = 11
+
+  /** Scale converting a 53-bit integer to a value in [0, 1). */
+  private[test] val Scale: Double = 1.0 / (1L << 53)
+
+  /** Initial model state.
+   *
+   *  @param seed Initial seed of the model's random number stream.
+   *
+   *  @return Initial hold model state.
+   */
+  def initialState(seed: Long): HoldModelState = HoldModelState(0L, seed)
+
+  /** Sample a hold time and schedule a new hold event after it has elapsed.
+   *
+   *  @param simulation Simulation in which the hold model is executing.
+   *
+   *  @return Actions scheduling the next hold event.
+   */
+  def hold(implicit simulation: Simulation[HoldModelState]): SimulationAction[HoldModelState] = for {
+    ms <- simulation.modelState
+    (delay, nextMs) = ms.nextHold
+    _ <- simulation.updateModelState(nextMs)
+    r <- simulation.at(delay)(new HoldAction)
+  } yield r
+
+  /** Initialization actions, scheduling the initial set of pending hold events.
+   *
+   *  @param pending Number of hold events to be kept pending for the duration of the run.
+   *
+   *  @param simulation Simulation in which the hold model is executing.
+   *
+   *  @return Actions scheduling `pending` hold events.
+   */
+  def initialization(pending: Int)(implicit simulation: Simulation[HoldModelState]): Action[HoldModelState] = {
+
+    // Schedule the remaining events one at a time, stopping at the first failure.
+    def schedule(remaining: Int): SimulationAction[HoldModelState] = {
+      if(remaining <= 0) State.pure(Success(()))
+      else for {
+        r <- hold
+        rr <- if(r.isFailure) State.pure[SimulationState[HoldModelState], Try[Unit]](r) else schedule(remaining - 1)
+      } yield rr
+    }
+    Simulation.createAnonymousAction(schedule(pending))
+  }
+
+  /** Initialization actions, scheduling the initial set of pending hold events in bulk.
+   *
+   *  The resulting simulation state is identical to that produced by `[[initialization]]`.
+   *
+   *  @param pending Number of hold events to be kept pending for the duration of the run.
+   *
+   *  @param simulation Simulation in which the hold model is executing.
+   *
+   *  @return Actions scheduling `pending` hold events with a single call to `atAll`.
+   */
+  def bulkInitialization(pending: Int)(implicit simulation: Simulation[HoldModelState]): Action[HoldModelState] = {
+    Simulation.createAnonymousAction(for {
+      ms <- simulation.modelState
+      (holds, nextMs) = (0 until pending).foldLeft((Vector.empty[(Time, Priority, Action[HoldModelState])], ms)) {
+        case ((acc, m), _) =>
+          val (delay, nm) = m.nextHold
+          (acc :+ ((delay, 0, new HoldAction)), nm)
+      }
+      _ <- simulation.updateModelState(nextMs)
+      r <- simulation.atAll(holds)
+    } yield r)
+  }
+
+  /** Simulation time required for the specified number of pending events to dispatch a given number of events.
+   *
+   *  @param pending Number of pending hold events.
+   *
+   *  @param events Approximate number of events to be dispatched.
+   *
+   *  @return Simulation time over which approximately `events` events will be dispatched.
+   */
+  def runLength(pending: Int, events: Long): Time = Seconds(events * MeanHold / pending)
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
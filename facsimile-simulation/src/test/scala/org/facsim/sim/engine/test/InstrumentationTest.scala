@@ -0,0 +1,229 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import akka.stream.QueueOfferResult
+import akka.stream.scaladsl.Sink
+import org.facsim.sim.engine.{DispatchProfile, Instrumentation, InstrumentationReport, Simulation}
+import org.facsim.util.log.{InformationSeverity, LogStream}
+import org.facsim.util.test.AkkaStreamsTestHarness
+import org.scalacheck.Gen
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import scala.concurrent.Await
+import scala.concurrent.duration._
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for engine instrumentation. */
+final class InstrumentationTest
+extends AkkaStreamsTestHarness
+with ScalaCheckPropertyChecks {
+
+  /** Timeout for awaiting the result of a future. */
+  val futureTimeout: FiniteDuration = 5.seconds
+
+  /** Test data. */
+  trait TestData {
+
+    /** Simulation executing the hold model. */
+    implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+
+    /** Hold model warm-up period. */
+    val warmUp = Seconds(25.0)
+
+    /** Hold model snap length. */
+    val snapLength = Seconds(50.0)
+
+    /** Hold model snap count. */
+    val numSnaps = 2
+
+    /** Generator for the number of pending hold events. */
+    val pendingGen: Gen[Int] = Gen.choose(1, 100)
+
+    /** Generator for hold model seeds. */
+    val seedGen: Gen[Long] = Gen.choose(Long.MinValue, Long.MaxValue)
+
+    /** Name of the hold model's action. */
+    val holdName = "Hold"
+  }
+
+  // Tell the user which classes we're testing.
+  describe(classOf[Instrumentation].getCanonicalName) {
+
+    // Verify that instrumentation does not change the results of a run.
+    it("must not affect simulation results") {
+      new TestData {
+        forAll(pendingGen, seedGen) {(pending, seed) =>
+          val init = HoldModel.initialState(seed)
+          val (es, er) = simulation.runFast(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(pending))
+          val (as, ar) = simulation.runFast(init, warmUp, snapLength, numSnaps,
+            Some(new Instrumentation(Seconds(1.0))))(HoldModel.initialization(pending))
+          assert(as.modelState === es.modelState)
+          assert(as.simTicks === es.simTicks)
+          assert(ar === er)
+        }
+      }
+    }
+
+    // Verify the recorded dispatch counts.
+    it("must count dispatches, and the events they schedule, by action name") {
+      new TestData {
+        forAll(pendingGen, seedGen) {(pending, seed) =>
+          val instrumentation = new Instrumentation(Seconds(1.0))
+          val (s, _) = simulation.runFast(HoldModel.initialState(seed), warmUp, snapLength, numSnaps,
+            Some(instrumentation))(HoldModel.initialization(pending))
+          val report = instrumentation.report
+          val hold = report.profiles(holdName)
+
+          // Each hold event schedules exactly one successor, and every draw after initialization is due to a dispatch.
+          assert(hold.scheduled === hold.dispatches)
+          assert(hold.dispatches === s.modelState.draws - pending)
+          assert(hold.histogram.sum === hold.dispatches)
+          assert(report.dispatches > hold.dispatches)
+          assert(report.wallNanos > 0L)
+        }
+      }
+    }
+
+    // Verify that the event calendar is sampled.
+    it("must sample the event calendar size at regular intervals") {
+      new TestData {
+        forAll(pendingGen, seedGen) {(pending, seed) =>
+          val instrumentation = new Instrumentation(Seconds(1.0))
+          val _ = simulation.runFast(HoldModel.initialState(seed), warmUp, snapLength, numSnaps,
+            Some(instrumentation))(HoldModel.initialization(pending))
+          val samples = instrumentation.report.queueSamples
+          assert(samples.nonEmpty)
+          assert(samples.map(_.time) === samples.map(_.time).sorted)
+          assert(samples.map(_.time.to(Seconds).floor).distinct.size === samples.size)
+          assert(instrumentation.report.maxQueueSize <= pending + 1)
+        }
+      }
+    }
+
+    // Verify that both event loops record identical measurements, apart from timings.
+    it("must record the same measurements for .run and .runFast") {
+      new TestData {
+        forAll(pendingGen, seedGen) {(pending, seed) =>
+          val init = HoldModel.initialState(seed)
+          val expected = new Instrumentation(Seconds(1.0))
+          val actual = new Instrumentation(Seconds(1.0))
+          val _ = simulation.run(init, warmUp, snapLength, numSnaps, Some(expected))(HoldModel.initialization(pending))
+          val _ = simulation.runFast(init, warmUp, snapLength, numSnaps,
+            Some(actual))(HoldModel.initialization(pending))
+          assert(actual.report.profiles.view.mapValues(p => (p.dispatches, p.scheduled)).toMap ===
+            expected.report.profiles.view.mapValues(p => (p.dispatches, p.scheduled)).toMap)
+          assert(actual.report.queueSamples === expected.report.queueSamples)
+        }
+      }
+    }
+  }
+
+  describe(classOf[DispatchProfile].getCanonicalName) {
+
+    // Verify the dispatch time histogram bins.
+    it("must bin dispatch times by powers of two") {
+      assert(DispatchProfile.bin(0L) === 0)
+      assert(DispatchProfile.bin(1L) === 0)
+      assert(DispatchProfile.bin(2L) === 1)
+      assert(DispatchProfile.bin(3L) === 1)
+      assert(DispatchProfile.bin(1023L) === 9)
+      assert(DispatchProfile.bin(1024L) === 10)
+      assert(DispatchProfile.bin(Long.MaxValue) === DispatchProfile.Bins - 2)
+    }
+
+    // Verify percentiles.
+    it("must report upper bounds of dispatch time percentiles") {
+      val histogram = DispatchProfile.Empty.histogram.updated(3, 90L).updated(10, 10L)
+      val profile = DispatchProfile(100L, 100L, 5000L, histogram)
+      assert(profile.percentileNanos(0.5) === 16L)
+      assert(profile.percentileNanos(0.9) === 16L)
+      assert(profile.percentileNanos(0.91) === 2048L)
+      assert(profile.meanNanos === 50.0)
+      assert(DispatchProfile.Empty.percentileNanos(0.99) === 0L)
+      assertThrows[IllegalArgumentException](profile.percentileNanos(1.5))
+    }
+
+    // Verify that the percentiles of the longest dispatch times do not overflow.
+    it("must report the largest representable upper bound for the top bins") {
+      val histogram = DispatchProfile.Empty.histogram.updated(DispatchProfile.bin(Long.MaxValue), 1L)
+      val profile = DispatchProfile(1L, 0L, Long.MaxValue, histogram)
+      assert(profile.percentileNanos(1.0) === Long.MaxValue)
+    }
+  }
+
+  describe(classOf[InstrumentationReport].getCanonicalName) {
+
+    // Verify that reports are merged correctly.
+    it("must merge reports") {
+      val a = DispatchProfile(2L, 1L, 10L, DispatchProfile.Empty.histogram.updated(3, 2L))
+      val b = DispatchProfile(3L, 6L, 20L, DispatchProfile.Empty.histogram.updated(4, 3L))
+      val merged = InstrumentationReport(Map("a" -> a, "b" -> b), Vector.empty, 100L)
+      .merge(InstrumentationReport(Map("b" -> b), Vector.empty, 50L))
+      assert(merged.profiles("a") === a)
+      assert(merged.profiles("b") === b.merge(b))
+      assert(merged.dispatches === 8L)
+      assert(merged.wallNanos === 150L)
+      assert(merged.summary.size === 3)
+    }
+
+    // Verify that the summary is published to a log stream.
+    it("must publish its summary to a log stream") {
+      val a = DispatchProfile(2L, 1L, 10L, DispatchProfile.Empty.histogram.updated(3, 2L))
+      val report = InstrumentationReport(Map("a" -> a), Vector.empty, 100L)
+      val log = new LogStream[String]()
+      val published = log.source.runWith(Sink.seq)
+      assert(Await.result(report.publish(log, "test"), futureTimeout) === QueueOfferResult.Enqueued)
+      Await.ready(log.close(), futureTimeout)
+      val messages = Await.result(published, futureTimeout)
+      assert(messages.map(_.msg) === report.summary)
+      assert(messages.forall(m => m.prefix === "test" && m.scope === InstrumentationReport.LogScope))
+      assert(messages.forall(_.severity === InformationSeverity))
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
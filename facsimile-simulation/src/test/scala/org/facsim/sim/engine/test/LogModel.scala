@@ -0,0 +1,130 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.SimulationAction
+import org.facsim.sim.engine.{EventQueueStatistics, Simulation}
+import org.facsim.sim.model.{Action, ModelState}
+import scala.util.Try
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Model state for the ''log model'', which records the order in which its actions are dispatched.
+ *
+ *  @param log Tags of the actions dispatched so far, in dispatch order.
+ *
+ *  @param stats Event queue statistics noted so far.
+ *
+ *  @param failures Failures noted so far.
+ */
+final case class LogModelState(log: Vector[String] = Vector.empty, stats: Vector[EventQueueStatistics] = Vector.empty,
+failures: Vector[Throwable] = Vector.empty)
+extends ModelState[LogModelState]
+
+/** Log model action, recording its tag when dispatched.
+ *
+ *  @param tag Tag identifying this action.
+ *
+ *  @param simulation Simulation in which the log model is executing.
+ */
+final class LogAction(tag: String)(implicit simulation: Simulation[LogModelState])
+extends Action[LogModelState] {
+
+  /** @inheritdoc */
+  override protected val actions: SimulationAction[LogModelState] = LogModel.record(tag)
+
+  /** @inheritdoc */
+  override val name: String = tag
+
+  /** @inheritdoc */
+  override val description: String = s"Log model event, recording '$tag'."
+}
+
+/** Log model helpers. */
+object LogModel {
+
+  /** Record a tag in the model's log.
+   *
+   *  @param tag Tag to be recorded.
+   *
+   *  @param simulation Simulation in which the log model is executing.
+   *
+   *  @return Actions recording `tag`.
+   */
+  def record(tag: String)(implicit simulation: Simulation[LogModelState]): SimulationAction[LogModelState] = for {
+    ms <- simulation.modelState
+    r <- simulation.updateModelState(ms.copy(log = ms.log :+ tag))
+  } yield r
+
+  /** Note the current event queue statistics in the model state.
+   *
+   *  @param simulation Simulation in which the log model is executing.
+   *
+   *  @return Actions noting the event queue statistics.
+   */
+  def noteStats(implicit simulation: Simulation[LogModelState]): SimulationAction[LogModelState] = for {
+    st <- simulation.queueStatistics
+    ms <- simulation.modelState
+    r <- simulation.updateModelState(ms.copy(stats = ms.stats :+ st))
+  } yield r
+
+  /** Note a failure in the model state, converting it into a success.
+   *
+   *  @param result Result to be noted.
+   *
+   *  @param simulation Simulation in which the log model is executing.
+   *
+   *  @return Actions noting `result`, if it is a failure.
+   */
+  def noteFailure(result: Try[_])(implicit simulation: Simulation[LogModelState]): SimulationAction[LogModelState] = {
+    for {
+      ms <- simulation.modelState
+      r <- result.fold(e => simulation.updateModelState(ms.copy(failures = ms.failures :+ e)),
+      _ => simulation.updateModelState(ms))
+    } yield r
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,209 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.engine.{Replications, Simulation}
+import org.facsim.stat.dist.Uniform
+import org.facsim.stat.prng.{SimplePRNG, StreamRegistry}
+import org.scalatest.funspec.AnyFunSpec
+import scala.util.Failure
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[Replications]] object. */
+final class ReplicationsTest
+extends AnyFunSpec {
+
+  /** Run a single, short replication of the hold model.
+   *
+   *  @param replication Replication number.
+   *
+   *  @param prng Replication's random number generator.
+   *
+   *  @return Statistics reported by the replication.
+   */
+  def holdReplication(replication: Int, prng: SimplePRNG): Map[String, Double] = {
+    implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+    val (seed, _) = prng.nextInt
+    val (s, r) = simulation.run(HoldModel.initialState(seed.toLong), Seconds(10.0), Seconds(40.0), 5) {
+      HoldModel.initialization(16)
+    }
+    assert(r.isSuccess)
+    Map("draws" -> s.modelState.draws.toDouble, "replication" -> replication.toDouble)
+  }
+
+  /** Sample the mean of a number of uniformly-distributed service times, using a named stream.
+   *
+   *  @param streams Stream registry providing the replication's streams.
+   *
+   *  @param mean Mean service time.
+   *
+   *  @return Statistics reported by the replication.
+   */
+  def serviceReplication(streams: StreamRegistry, mean: Double): Map[String, Double] = {
+    val values = new Array[Double](100)
+    val _ = Uniform(0.0, 2.0 * mean).fill(values, streams.stream("Server"))
+    Map("service" -> values.sum / values.length.toDouble)
+  }
+
+  // Tell the user which object we're testing.
+  describe(Replications.getClass.getCanonicalName) {
+    describe(".run(Int, Int, Long, Double)((Int, SimplePRNG) => Map[String, Double])") {
+
+      // Verify that invalid arguments are rejected.
+      it("must reject invalid arguments") {
+        assertThrows[IllegalArgumentException](Replications.run(0, 1, 0L)(holdReplication))
+        assertThrows[IllegalArgumentException](Replications.run(SimplePRNG.StreamCount + 1, 1, 0L)(holdReplication))
+        assertThrows[IllegalArgumentException](Replications.run(1, 0, 0L)(holdReplication))
+        assertThrows[IllegalArgumentException](Replications.run(1, 1, 0L, 1.0)(holdReplication))
+      }
+
+      // Verify that each replication is run once, in order, with its own stream.
+      it("must run each replication with its own random number stream") {
+        val summary = Replications.run(10, 4, 42L) {(r, prng) =>
+          assert(prng === SimplePRNG.stream(42L, r))
+          Map("replication" -> r.toDouble)
+        }.get
+        assert(summary.replications === 10)
+        assert(summary.outputs.map(_("replication")) === (0 until 10).map(_.toDouble))
+      }
+
+      // Verify that results do not depend upon the number of threads used.
+      it("must report the same results regardless of the number of threads") {
+        val sequential = Replications.run(8, 1, 7L)(holdReplication).get
+        val parallel = Replications.run(8, 4, 7L)(holdReplication).get
+        assert(sequential === parallel)
+        assert(sequential.outputs.map(_("draws")).distinct.size > 1)
+      }
+
+      // Verify that results are merged into confidence intervals.
+      it("must merge the reported statistics into confidence intervals") {
+        val summary = Replications.run(5, 2, 0L, 0.9) {(r, _) =>
+          if(r % 2 == 0) Map("x" -> r.toDouble, "even" -> 1.0)
+          else Map("x" -> r.toDouble)
+        }.get
+        assert(summary.intervals.keySet === Set("x", "even"))
+        assert(summary.intervals("x").mean === 2.0)
+        assert(summary.intervals("x").size === 5)
+        assert(summary.intervals("x").level === 0.9)
+        assert(summary.intervals("even").size === 3)
+        assert(summary.intervals("even").halfWidth === 0.0)
+      }
+
+      // Verify that replication failures are reported.
+      it("must report a failure if any replication fails") {
+        val failure = new IllegalStateException("Replication failed")
+        val result = Replications.run(4, 2, 0L) {(r, _) =>
+          if(r == 2) throw failure
+          else Map("x" -> r.toDouble)
+        }
+        assert(result === Failure(failure))
+      }
+    }
+
+    describe(".runStreams(Int, Int, Long, Double, Boolean)((Int, StreamRegistry) => Map[String, Double])") {
+
+      // Verify that invalid arguments are rejected.
+      it("must reject invalid arguments") {
+        assertThrows[IllegalArgumentException](Replications.runStreams(0, 1, 0L)((_, s) => serviceReplication(s, 1.0)))
+        assertThrows[IllegalArgumentException](Replications.runStreams(1, 0, 0L)((_, s) => serviceReplication(s, 1.0)))
+        assertThrows[IllegalArgumentException](Replications.runStreams(1, 1, 0L, 0.0) {(_, s) =>
+          serviceReplication(s, 1.0)
+        })
+      }
+
+      // Verify that each replication is run with its own registry.
+      it("must run each replication with its own stream registry") {
+        val summary = Replications.runStreams(10, 4, 42L) {(r, streams) =>
+          assert(streams === StreamRegistry(42L, r))
+          Map("replication" -> r.toDouble)
+        }.get
+        assert(summary.outputs.map(_("replication")) === (0 until 10).map(_.toDouble))
+      }
+
+      // Verify that antithetic replications report the mean of both runs.
+      it("must report the mean of each antithetic pair of runs") {
+        val summary = Replications.runStreams(6, 3, 5L, antithetic = true) {(r, streams) =>
+          if(streams.mirrored) Map("x" -> 2.0 * r, "mirrored" -> 1.0)
+          else Map("x" -> 0.0, "original" -> 1.0)
+        }.get
+        assert(summary.outputs === (0 until 6).map(r => Map("x" -> r.toDouble)))
+      }
+
+      // Verify that antithetic variates reduce the variance of the results.
+      it("must reduce variance when antithetic variates are used") {
+        val independent = Replications.runStreams(50, 4, 9L)((_, s) => serviceReplication(s, 1.0)).get
+        val antithetic = Replications.runStreams(50, 4, 9L, antithetic = true) {(_, s) =>
+          serviceReplication(s, 1.0)
+        }.get
+        assert(antithetic.intervals("service").halfWidth < independent.intervals("service").halfWidth)
+      }
+    }
+
+    describe(".compare(Int, Int, Long, Double, Boolean)(...)") {
+
+      // Verify that differences between scenarios are reported.
+      it("must report the difference between the alternative and baseline scenarios") {
+        val summary = Replications.compare(4, 2, 0L)((r, _) => Map("x" -> r.toDouble, "base" -> 1.0),
+        (r, _) => Map("x" -> 3.0 * r)).get
+        assert(summary.outputs === (0 until 4).map(r => Map("x" -> 2.0 * r)))
+      }
+
+      // Verify that common random numbers are used by both scenarios.
+      it("must use common random numbers for both scenarios") {
+        val common = Replications.compare(20, 4, 3L)((_, s) => serviceReplication(s, 1.0),
+        (_, s) => serviceReplication(s, 1.1)).get
+        val independent = Replications.compare(20, 4, 3L)((_, s) => serviceReplication(s, 1.0),
+        (r, _) => serviceReplication(StreamRegistry(4L, r), 1.1)).get
+        assert(common.intervals("service").halfWidth < independent.intervals("service").halfWidth / 5.0)
+        assert(common.intervals("service").lower > 0.0)
+      }
+    }
+
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,135 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.engine.{ArrayHeapCalendar, Simulation}
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Benchmark comparing the state monad and imperative simulation event loops, and the available event calendars.
+ *
+ *  Each run of the ''hold model'' dispatches (approximately) the same number of events, regardless of the number of
+ *  pending events, so that the reported times are directly comparable: events per second is given by dividing
+ *  `EventsPerRun` by the reported time.
+ */
+object SimulationBenchmark
+extends RegressionBenchmark {
+
+  /** Approximate number of events dispatched by each run. */
+  val EventsPerRun = 100000
+
+  /** Numbers of pending events to be benchmarked. */
+  val pending: Gen[Int] = Gen.exponential("pending")(1, 10000, 10)
+
+  /** Simulation executing the hold model, using the default event calendar. */
+  val heapSimulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+
+  /** Simulation executing the hold model, using an array heap event calendar. */
+  val arraySimulation: Simulation[HoldModelState] = new Simulation[HoldModelState](ArrayHeapCalendar)
+
+  /** Run the hold model, with the indicated number of pending events, using the specified event loop.
+   *
+   *  @param n Number of pending events.
+   *
+   *  @param fast If `true`, use the imperative event loop; otherwise, use the state monad event loop.
+   *
+   *  @param simulation Simulation executing the hold model.
+   */
+  def runHold(n: Int, fast: Boolean)(implicit simulation: Simulation[HoldModelState]): Unit = {
+    val init = HoldModel.initialState(n.toLong)
+    val length = HoldModel.runLength(n, EventsPerRun)
+    val result = {
+      if(fast) simulation.runFast(init, Seconds(0.0), length)(HoldModel.initialization(n))
+      else simulation.run(init, Seconds(0.0), length)(HoldModel.initialization(n))
+    }
+    assert(result._2.isSuccess)
+  }
+
+  /** Initialize the hold model, with the indicated number of pending events, then run it briefly.
+   *
+   *  @param n Number of pending events.
+   *
+   *  @param bulk If `true`, schedule the initial events in bulk; otherwise, schedule them one at a time.
+   *
+   *  @param simulation Simulation executing the hold model.
+   */
+  def initializeHold(n: Int, bulk: Boolean)(implicit simulation: Simulation[HoldModelState]): Unit = {
+    val init = HoldModel.initialState(n.toLong)
+    val initialization = if(bulk) HoldModel.bulkInitialization(n) else HoldModel.initialization(n)
+    val result = simulation.runFast(init, Seconds(0.0), HoldModel.runLength(n, 1L))(initialization)
+    assert(result._2.isSuccess)
+  }
+
+  performance of "Simulation" in {
+    measure method "run" in {
+      using(pending) in {n =>
+        runHold(n, fast = false)(heapSimulation)
+      }
+    }
+    measure method "runFast" in {
+      using(pending) in {n =>
+        runHold(n, fast = true)(heapSimulation)
+      }
+    }
+    measure method "runFast (array heap)" in {
+      using(pending) in {n =>
+        runHold(n, fast = true)(arraySimulation)
+      }
+    }
+    measure method "initialize (at)" in {
+      using(pending) in {n =>
+        initializeHold(n, bulk = false)(heapSimulation)
+      }
+    }
+    measure method "initialize (atAll)" in {
+      using(pending) in {n =>
+        initializeHold(n, bulk = true)(heapSimulation)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
@@ -36,10 +36,14 @@
 //======================================================================================================================
 package org.facsim.sim.engine.test
 
-import org.facsim.sim.engine.Simulation
-import org.facsim.sim.model.ModelState
+import java.io.File
+import org.facsim.sim.engine.{EventCalendarType, EventHandle, EventNotPendingException, EventQueueStatistics,
+Simulation, SimulationSnapshot, SimulationState}
+import org.scalacheck.Gen
 import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
 import org.scalatest.funspec.AnyFunSpec
+import scala.util.{Success, Try}
+import squants.time.{Milliseconds, Seconds}
 
 // Disable test-problematic Scalastyle checkers.
 //scalastyle:off scaladoc
@@ -52,15 +56,267 @@ final class SimulationTest
 extends AnyFunSpec
 with ScalaCheckPropertyChecks {
 
-  /** Simulation model test state class. */
-  final class TestModelState
-  extends ModelState[TestModelState]
-
   /** Test data. */
-  trait TestData
+  trait TestData {
+
+    /** Simulation executing the hold model. */
+    implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+
+    /** Hold model warm-up period. */
+    val warmUp = Seconds(25.0)
+
+    /** Hold model snap length. */
+    val snapLength = Seconds(50.0)
+
+    /** Hold model snap count. */
+    val numSnaps = 2
+
+    /** Generator for the number of pending hold events. */
+    val pendingGen: Gen[Int] = Gen.choose(1, 100)
+
+    /** Generator for hold model seeds. */
+    val seedGen: Gen[Long] = Gen.choose(Long.MinValue, Long.MaxValue)
+
+    /** Verify that two simulation run results are identical.
+     *
+     *  @param expected Expected result.
+     *
+     *  @param actual Actual result.
+     */
+    def assertSameResult(expected: (SimulationState[HoldModelState], Try[Unit]),
+    actual: (SimulationState[HoldModelState], Try[Unit])): Unit = {
+      val (es, er) = expected
+      val (as, ar) = actual
+      assert(as.modelState === es.modelState)
+      assert(as.nextEventId === es.nextEventId)
+      assert(as.runState === es.runState)
+      assert(as.simTicks === es.simTicks)
+      assert(as.current.map(_.id) === es.current.map(_.id))
+      assert(ar === er)
+      ()
+    }
+  }
 
   // Start with the companion object.
   describe(classOf[Simulation[_]].getCanonicalName) {
+
+    // Test the constructor.
+    describe(".this(EventCalendarType, Time)") {
+
+      // Verify that the time resolution must be positive.
+      it("must throw an IllegalArgumentException if the time resolution is not positive") {
+        assertThrows[IllegalArgumentException] {
+          new Simulation[HoldModelState](timeResolution = Seconds(0.0))
+        }
+        assertThrows[IllegalArgumentException] {
+          new Simulation[HoldModelState](timeResolution = Seconds(-1.0))
+        }
+      }
+    }
+
+    // Test the conversion of times to and from clock ticks.
+    describe(".toTicks(Time)") {
+
+      // Verify that times are rounded to the nearest clock tick.
+      it("must round times to the nearest multiple of the time resolution") {
+        val sim = new Simulation[HoldModelState](timeResolution = Milliseconds(10.0))
+        assert(sim.toTicks(Seconds(0.0)) === 0L)
+        assert(sim.toTicks(Seconds(1.0)) === 100L)
+        assert(sim.toTicks(Milliseconds(14.0)) === 1L)
+        assert(sim.toTicks(Milliseconds(16.0)) === 2L)
+        assert(sim.toTime(100L).to(Seconds) === 1.0)
+      }
+
+      // Verify that whole numbers of ticks survive a round trip.
+      it("must convert whole numbers of ticks to times and back again exactly") {
+        new TestData {
+          forAll(Gen.choose(0L, 1000000000000L)) {ticks =>
+            assert(simulation.toTicks(simulation.toTime(ticks)) === ticks)
+          }
+        }
+      }
+    }
+
+    // Test the run method.
+    describe(".run(M, Time, Time, Int)(Action[M])") {
+
+      // Verify that a hold model runs to completion.
+      it("must run a hold model to completion") {
+        new TestData {
+          forAll(pendingGen, seedGen) {(pending, seed) =>
+            val (s, r) = simulation.run(HoldModel.initialState(seed), warmUp, snapLength, numSnaps) {
+              HoldModel.initialization(pending)
+            }
+            assert(r.isSuccess)
+            assert(s.runState.canIterate === false)
+            assert(s.simTicks === simulation.toTicks(warmUp + snapLength * numSnaps.toDouble))
+          }
+        }
+      }
+    }
+
+    // Test the fast run method.
+    describe(".runFast(M, Time, Time, Int)(Action[M])") {
+
+      // Verify that the imperative event loop produces exactly the same results as the state monad event loop.
+      it("must produce results identical to those of .run") {
+        new TestData {
+          forAll(pendingGen, seedGen) {(pending, seed) =>
+            val init = HoldModel.initialState(seed)
+            val expected = simulation.run(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(pending))
+            val actual = simulation.runFast(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(pending))
+            assertSameResult(expected, actual)
+          }
+        }
+      }
+
+      // Verify that each event calendar type produces exactly the same results as the default calendar.
+      EventCalendarType.values.foreach {ct =>
+        it(s"must produce results identical to those of .run when using a ${ct.name} event calendar") {
+          new TestData {
+            val ctSimulation = new Simulation[HoldModelState](ct)
+            forAll(pendingGen, seedGen) {(pending, seed) =>
+              val init = HoldModel.initialState(seed)
+              val expected = simulation.run(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(pending))
+              val actual = ctSimulation.runFast(init, warmUp, snapLength, numSnaps) {
+                HoldModel.initialization(pending)(ctSimulation)
+              }
+              assertSameResult(expected, actual)
+            }
+          }
+        }
+      }
+    }
+
+    // Test warming up a simulation once, and resuming it many times.
+    describe(".warmUp(M, Time, Time, Int)(Action[M]) and .resume(SimulationSnapshot[M])(M => M)") {
+
+      // Verify that resuming an unmodified snapshot is equivalent to running the simulation from the start.
+      EventCalendarType.values.foreach {ct =>
+        it(s"must produce results identical to those of .runFast when using a ${ct.name} event calendar") {
+          new TestData {
+            val ctSimulation = new Simulation[HoldModelState](ct)
+            forAll(pendingGen, seedGen) {(pending, seed) =>
+              val init = HoldModel.initialState(seed)
+              val expected = ctSimulation.runFast(init, warmUp, snapLength, numSnaps) {
+                HoldModel.initialization(pending)(ctSimulation)
+              }
+              val snapshot = ctSimulation.warmUp(init, warmUp, snapLength, numSnaps) {
+                HoldModel.initialization(pending)(ctSimulation)
+              }
+              assert(snapshot.isSuccess)
+              assertSameResult(expected, ctSimulation.resume(snapshot.get)())
+            }
+          }
+        }
+      }
+
+      // Verify that a snapshot is unaffected by being resumed, and that updates to the model state take effect.
+      it("must resume the same snapshot any number of times") {
+        new TestData {
+          forAll(pendingGen, seedGen) {(pending, seed) =>
+            val snapshot = simulation.warmUp(HoldModel.initialState(seed), warmUp, snapLength, numSnaps) {
+              HoldModel.initialization(pending)
+            }.get
+            val reseed = (ms: HoldModelState) => ms.copy(seed = ~ms.seed)
+            val expected = simulation.resume(snapshot)(reseed)
+            assertSameResult(expected, simulation.resume(snapshot)(reseed))
+            assert(simulation.resume(snapshot)()._1.modelState !== expected._1.modelState)
+          }
+        }
+      }
+
+      // Verify that a snapshot can be saved, and then resumed by a new simulation after it has been loaded.
+      it("must resume snapshots that have been saved and loaded") {
+        new TestData {
+          val file = File.createTempFile("SimulationTest", ".snapshot")
+          try {
+            val init = HoldModel.initialState(1234L)
+            val expected = simulation.runFast(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(10))
+            val snapshot = simulation.warmUp(init, warmUp, snapLength, numSnaps)(HoldModel.initialization(10))
+            assert(snapshot.flatMap(_.save(file)).isSuccess)
+            val loadingSimulation = new Simulation[HoldModelState](EventCalendarType.values.last)
+            val loaded = SimulationSnapshot.load(file)(loadingSimulation)
+            assert(loaded.isSuccess)
+            assertSameResult(expected, loadingSimulation.resume(loaded.get)())
+          }
+          finally {
+            file.delete()
+          }
+        }
+      }
+
+      // Verify that snapshots can only be resumed by simulations having the same clock resolution.
+      it("must throw an IllegalArgumentException if the time resolution differs") {
+        new TestData {
+          val snapshot = simulation.warmUp(HoldModel.initialState(0L), warmUp, snapLength, numSnaps) {
+            HoldModel.initialization(10)
+          }.get
+          val sim = new Simulation[HoldModelState](timeResolution = Milliseconds(1.0))
+          assertThrows[IllegalArgumentException] {
+            sim.resume(snapshot)()
+          }
+        }
+      }
+    }
+
+    // Test bulk scheduling.
+    describe(".atAll(Seq[(Time, Priority, Action[M])])") {
+
+      // Verify that bulk scheduling is equivalent to scheduling each event in turn.
+      EventCalendarType.values.foreach {ct =>
+        it(s"must produce results identical to scheduling with .at when using a ${ct.name} event calendar") {
+          new TestData {
+            val ctSimulation = new Simulation[HoldModelState](ct)
+            forAll(Gen.choose(0, 200), seedGen) {(pending, seed) =>
+              val init = HoldModel.initialState(seed)
+              val expected = ctSimulation.runFast(init, warmUp, snapLength, numSnaps) {
+                HoldModel.initialization(pending)(ctSimulation)
+              }
+              val actual = ctSimulation.runFast(init, warmUp, snapLength, numSnaps) {
+                HoldModel.bulkInitialization(pending)(ctSimulation)
+              }
+              assertSameResult(expected, actual)
+            }
+          }
+        }
+      }
+    }
+
+    // Test event cancellation and rescheduling.
+    describe(".cancel(EventHandle) and .reschedule(EventHandle, Time)") {
+
+      // Verify that cancelled events are not dispatched, that rescheduled events are dispatched at their new time, and
+      // that cancelled entries are reported until they are purged.
+      EventCalendarType.values.foreach {ct =>
+        it(s"must skip cancelled events and move rescheduled events when using a ${ct.name} event calendar") {
+          implicit val sim: Simulation[LogModelState] = new Simulation[LogModelState](ct)
+          val init = Simulation.createAnonymousAction(for {
+            ha <- sim.atWithHandle(Seconds(1.0))(new LogAction("a"))
+            hb <- sim.atWithHandle(Seconds(2.0))(new LogAction("b"))
+            _ <- sim.at(Seconds(3.0))(new LogAction("c"))
+            _ <- sim.at(Seconds(5.0))(Simulation.createAnonymousAction(LogModel.noteStats))
+            rc <- sim.cancel(ha.get)
+            hb2 <- sim.reschedule(hb.get, Seconds(4.0))
+            rc2 <- sim.cancel(ha.get)
+            rr <- sim.reschedule(hb.get, Seconds(6.0))
+            _ <- LogModel.noteStats
+            _ <- LogModel.noteFailure(rc)
+            _ <- LogModel.noteFailure(hb2)
+            _ <- LogModel.noteFailure(rc2)
+            r <- LogModel.noteFailure(rr)
+          } yield r)
+          // Event 0 ends the warm-up period, so events "a" and "b" have identifiers 1 and 2 respectively.
+          val (s, r) = sim.runFast(LogModelState(), Seconds(10.0), Seconds(10.0))(init)
+          assert(r === Success(()))
+          assert(s.modelState.log === Vector("c", "b"))
+          assert(s.modelState.stats === Vector(EventQueueStatistics(4, 2), EventQueueStatistics(1, 0)))
+          assert(s.modelState.failures.collect {
+            case e: EventNotPendingException => e.handle
+          } === Vector(new EventHandle(1L), new EventHandle(2L)))
+        }
+      }
+    }
   }
 }
 
@@ -68,4 +324,4 @@ with ScalaCheckPropertyChecks {
 //scalastyle:on magic.numbers
 //scalastyle:on multiple.string.literals
 //scalastyle:on public.methods.have.type
-//scalastyle:on scaladoc
\ No newline at end of file
+//scalastyle:on scaladoc
@@ -0,0 +1,95 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.engine.test package.
+//======================================================================================================================
+package org.facsim.sim.engine.test
+
+import org.facsim.sim.engine.Simulation
+import org.facsim.util.log.Severity
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Benchmark measuring the time taken, by a newly started ''JVM'', to dispatch its first simulation event.
+ *
+ *  Each sample is measured in its own ''JVM'', without any warm-up runs, so that the reported time includes the
+ *  loading and initialization of the simulation engine (and of the logging severities, whose names are looked up when
+ *  parsing command line arguments). This is the startup cost paid by every headless batch job and short replication.
+ *
+ *  @note All state is created within the measured snippet, rather than as fields of this object, so that none of it is
+ *  initialized before measurement starts.
+ */
+object StartupBenchmark
+extends RegressionBenchmark {
+
+  /** Number of independent ''JVM''s, each contributing a single sample. */
+  val Samples = 10
+
+  /** Single, unit benchmark configuration. */
+  val startup: Gen[Unit] = Gen.unit("startup")
+
+  /** Initialize a simulation of the hold model, and dispatch its first event. */
+  def firstEvent(): Unit = {
+    assert(Severity.severityList.nonEmpty)
+    implicit val simulation: Simulation[HoldModelState] = new Simulation[HoldModelState]
+    val result = simulation.runFast(HoldModel.initialState(1L), Seconds(0.0), HoldModel.runLength(1, 1L)) {
+      HoldModel.initialization(1)
+    }
+    assert(result._2.isSuccess)
+  }
+
+  performance of "Simulation" in {
+    measure method "time to first event" config(
+      exec.independentSamples -> Samples,
+      exec.benchRuns -> 1,
+      exec.minWarmupRuns -> 0,
+      exec.maxWarmupRuns -> 0
+    ) in {
+      using(startup) in {_ =>
+        firstEvent()
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
@@ -0,0 +1,140 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.model.test package.
+//======================================================================================================================
+package org.facsim.sim.model.test
+
+import org.facsim.sim.model._
+import org.scalatest.funspec.AnyFunSpec
+import squants.motion.{MetersPerSecond, MetersPerSecondSquared, RadiansPerSecond}
+import squants.space.{Meters, Radians}
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[MotionTable]] class. */
+final class MotionTableTest
+extends AnyFunSpec {
+
+  /** Tolerance for comparing positions and times. */
+  private val Tolerance = 1.0e-9
+
+  /** Translational motion states of a small fleet of vehicles. */
+  private val states = Vector[TranslationalMotionState](
+    TranslationalStationaryState(Seconds(1.0)),
+    TranslationalCruiseState(Seconds(2.0), MetersPerSecond(1.5)),
+    TranslationalAccelerationState(Seconds(0.5), MetersPerSecond(0.0), MetersPerSecondSquared(2.0)),
+    TranslationalAccelerationState(Seconds(3.0), MetersPerSecond(4.0), MetersPerSecondSquared(-1.0))
+  )
+
+  /** Create a table holding the test states.
+   *
+   *  @return Motion table holding `states`.
+   */
+  private def table(): MotionTable = {
+    val mt = new MotionTable(states.size)
+    states.zipWithIndex.foreach {
+      case (s, i) => mt(i) = s
+    }
+    mt
+  }
+
+  // Test the MotionTable class.
+  describe("org.facsim.sim.model.MotionTable") {
+
+    // Verify construction.
+    describe(".ctor(Int)") {
+      it("must throw an IllegalArgumentException if passed a negative size") {
+        assertThrows[IllegalArgumentException](new MotionTable(-1))
+      }
+    }
+
+    // Verify bulk evaluation.
+    describe(".positions(Time, Array[Double])") {
+      it("must agree with the distance reported by each motion state") {
+        val mt = table()
+        val values = new Array[Double](states.size)
+        mt.positions(Seconds(5.0), values)
+        states.zipWithIndex.foreach {
+          case (s, i) => {
+            assert(Math.abs(values(i) - s.distance(Seconds(5.0)).to(Meters)) < Tolerance)
+            assert(Math.abs(mt.distance(i, Seconds(5.0)).to(Meters) - values(i)) < Tolerance)
+          }
+        }
+      }
+      it("must throw an IllegalArgumentException if the array is too small") {
+        assertThrows[IllegalArgumentException](table().positions(Seconds(5.0), new Array[Double](1)))
+      }
+      it("must evaluate rotational motion states") {
+        val mt = new MotionTable(1)
+        mt(0) = RotationalCruiseState(Seconds(1.0), RadiansPerSecond(0.5))
+        assert(Math.abs(mt.theta(0, Seconds(3.0)).to(Radians) - 1.0) < Tolerance)
+      }
+    }
+
+    // Verify the arrival time solver.
+    describe(".timeUntil(Int, Length)") {
+      it("must report when each element reaches a distance, if it ever does") {
+        val mt = table()
+        assert(mt.timeUntil(0, Meters(1.0)) === None)
+        assert(mt.timeUntil(0, Meters(0.0)).map(_.to(Seconds)) === Some(1.0))
+        assert(Math.abs(mt.timeUntil(1, Meters(3.0)).get.to(Seconds) - 4.0) < Tolerance)
+        assert(mt.timeUntil(1, Meters(-3.0)) === None)
+        assert(Math.abs(mt.timeUntil(2, Meters(4.0)).get.to(Seconds) - 2.5) < Tolerance)
+
+        // The decelerating vehicle stops after 8m, and so can reach 6m (after 2s) but never 10m.
+        assert(Math.abs(mt.timeUntil(3, Meters(6.0)).get.to(Seconds) - 5.0) < Tolerance)
+        assert(mt.timeUntil(3, Meters(10.0)) === None)
+      }
+      it("must report arrival times consistent with evaluated positions") {
+        val mt = table()
+        (1 until states.size).foreach {i =>
+          val t = mt.timeUntil(i, Meters(2.0)).get
+          assert(Math.abs(mt.distance(i, t).to(Meters) - 2.0) < Tolerance)
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,159 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.sim.model.test package.
+//======================================================================================================================
+package org.facsim.sim.model.test
+
+import org.facsim.sim.SimulationAction
+import org.facsim.sim.engine.Simulation
+import org.facsim.sim.model.{ModelState, SnapObserver, WIPStatistic}
+import org.scalatest.funspec.AnyFunSpec
+import scala.util.Success
+import squants.Time
+import squants.time.Seconds
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Model state tracking a single work-in-progress statistic.
+ *
+ *  @param wip Work-in-progress statistic.
+ */
+final case class WIPModelState(wip: WIPStatistic = WIPStatistic.Empty)
+extends ModelState[WIPModelState]
+with SnapObserver[WIPModelState] {
+
+  /** @inheritdoc */
+  override def warmedUp(time: Time): WIPModelState = copy(wip = wip.reset(time))
+
+  /** @inheritdoc */
+  override def snapEnded(time: Time): WIPModelState = copy(wip = wip.endSnap(time))
+}
+
+/** Test harness for the [[WIPStatistic]] class. */
+final class WIPStatisticTest
+extends AnyFunSpec {
+
+  /** Tolerance for comparing time-weighted means. */
+  private val Tolerance = 1.0e-9
+
+  /** Change the level of the model's work-in-progress statistic.
+   *
+   *  @param delta Change in level.
+   *
+   *  @param simulation Simulation in which the model is executing.
+   *
+   *  @return Actions changing the level.
+   */
+  private def change(delta: Int)(implicit simulation: Simulation[WIPModelState]): SimulationAction[WIPModelState] = {
+    for {
+      t <- simulation.time
+      ms <- simulation.modelState
+      r <- simulation.updateModelState(ms.copy(wip = ms.wip.update(delta, t)))
+    } yield r
+  }
+
+  describe(classOf[WIPStatistic].getCanonicalName) {
+
+    // Verify that invalid changes are rejected.
+    it("must reject negative levels and times preceding the previous change") {
+      val s = WIPStatistic.Empty.update(1, Seconds(5.0))
+      assertThrows[IllegalArgumentException](s.update(-2, Seconds(6.0)))
+      assertThrows[IllegalArgumentException](s.update(1, Seconds(4.0)))
+      assertThrows[IllegalArgumentException](s.endSnap(Seconds(4.0)))
+      assertThrows[IllegalArgumentException](s.batchMeansInterval(1.0))
+    }
+
+    // Verify the time-weighted mean, and the extreme levels.
+    it("must report the time-weighted mean and extreme levels") {
+      val s = WIPStatistic.Empty.update(2, Seconds(1.0)).update(3, Seconds(2.0)).update(-4, Seconds(4.0))
+      assert(WIPStatistic.Empty.snapMean(Seconds(0.0)) === None)
+      assert(s.current === 1)
+      assert(s.minimum === 0)
+      assert(s.maximum === 5)
+      assert(s.snapMean(Seconds(4.0)).exists(m => Math.abs(m - 12.0 / 4.0) < Tolerance))
+      assert(s.snapMean(Seconds(8.0)).exists(m => Math.abs(m - 16.0 / 8.0) < Tolerance))
+    }
+
+    // Verify that snaps record batch means, and that resets discard them.
+    it("must record batch means at the end of each snap, and discard them on reset") {
+      val s = WIPStatistic.Empty.update(2, Seconds(0.0)).endSnap(Seconds(10.0)).update(2, Seconds(15.0))
+      .endSnap(Seconds(20.0))
+      assert(s.snapMeans === Vector(2.0, 3.0))
+      assert(s.batchMeans.size === 2L)
+      assert(s.batchMeansInterval(0.95).exists(ci => ci.mean === 2.5 && ci.size === 2))
+      val r = s.reset(Seconds(25.0))
+      assert(r.snapMeans.isEmpty)
+      assert(r.batchMeansInterval(0.95) === None)
+      assert((r.current, r.minimum, r.maximum) === ((4, 4, 4)))
+    }
+
+    // Verify snap-level intervals across replications.
+    it("must report snap-level confidence intervals across replications") {
+      val reps = Seq(Vector(1.0, 2.0), Vector(3.0, 4.0), Vector(5.0)).map(m => WIPStatistic.Empty.copy(snapMeans = m))
+      val cis = WIPStatistic.snapIntervals(reps, 0.95)
+      assert(cis.map(_.mean) === Vector(3.0, 3.0))
+      assert(cis.map(_.size) === Vector(3, 2))
+      assert(WIPStatistic.snapIntervals(Nil, 0.95).isEmpty)
+    }
+
+    // Verify that the statistic is reset automatically at the end of the warm-up period and of each snap.
+    it("must cut batch means at each simulation snap boundary") {
+      implicit val sim: Simulation[WIPModelState] = new Simulation[WIPModelState]
+      val init = Simulation.createAnonymousAction(for {
+        _ <- sim.at(Seconds(5.0))(Simulation.createAnonymousAction(change(3)))
+        _ <- sim.at(Seconds(12.0))(Simulation.createAnonymousAction(change(1)))
+        r <- sim.at(Seconds(25.0))(Simulation.createAnonymousAction(change(-2)))
+      } yield r)
+      val (s, r) = sim.runFast(WIPModelState(), Seconds(10.0), Seconds(10.0), 3)(init)
+      assert(r === Success(()))
+      val wip = sim.modelState.runA(s).value.wip
+      assert(wip.snapMeans.length === 3)
+      wip.snapMeans.zip(Seq(3.8, 3.0, 2.0)).foreach {
+        case (actual, expected) => assert(Math.abs(actual - expected) < Tolerance)
+      }
+      assert((wip.current, wip.minimum, wip.maximum) === ((2, 2, 4)))
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,95 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import java.util.concurrent.atomic.AtomicLongArray
+import org.facsim.util.requireValid
+
+/** Histogram that may be recorded to by many threads without contention.
+ *
+ *  Observations are counted in one of a number of ''stripes'', each having its own `Long` counter per bucket; the
+ *  stripe used is determined by the recording thread, so that threads recording concurrently typically update
+ *  different counters, and never wait on a lock. Stripes are merged when a [[snapshot]] is taken.
+ *
+ *  @constructor Create a new, empty, concurrent histogram.
+ *
+ *  @param layout Layout of the histogram's buckets.
+ *
+ *  @param stripes Minimum number of stripes, which is rounded up to a power of two. By default, this is the number of
+ *  available processors. Memory usage is proportional to the product of the number of stripes and the number of
+ *  buckets.
+ *
+ *  @throws IllegalArgumentException if `stripes` is not positive.
+ *
+ *  @since 0.3
+ */
+final class ConcurrentHistogram(val layout: HistogramLayout = HistogramLayout.Default,
+stripes: Int = Runtime.getRuntime.availableProcessors) {
+  requireValid(stripes, stripes > 0)
+
+  /** Mask used to select a stripe from a thread identifier. */
+  private val mask = Integer.highestOneBit(stripes * 2 - 1) - 1
+
+  /** Bucket counters for each stripe. */
+  private val counters = Array.fill(mask + 1)(new AtomicLongArray(layout.size))
+
+  /** Record an observation.
+   *
+   *  @param observation Observation to be recorded. This value must be non-negative and not `NaN`.
+   *
+   *  @throws IllegalArgumentException if `observation` is negative or `NaN`.
+   *
+   *  @since 0.3
+   */
+  def record(observation: Double): Unit = {
+    requireValid(observation, observation >= 0.0)
+    counters(Thread.currentThread.getId.toInt & mask).getAndIncrement(layout.bucket(observation))
+    ()
+  }
+
+  /** Take a snapshot of this histogram.
+   *
+   *  Observations recorded concurrently with the snapshot may or may not be included in it.
+   *
+   *  @return Immutable histogram of the observations recorded so far.
+   *
+   *  @since 0.3
+   */
+  def snapshot: Histogram = Histogram(layout, Vector.tabulate(layout.size) {i =>
+    counters.foldLeft(0L)((sum, c) => sum + c.get(i))
+  })
+}
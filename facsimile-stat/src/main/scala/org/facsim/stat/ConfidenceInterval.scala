@@ -0,0 +1,139 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.requireValid
+
+/** Confidence interval for the mean of a set of independent observations.
+ *
+ *  Typically, each observation is the value of some statistic reported by one independent replication of a
+ *  simulation, so that the observations are independent and identically distributed, and—by the central limit
+ *  theorem—their mean is approximately normally distributed.
+ *
+ *  @constructor Create a new confidence interval.
+ *
+ *  @param mean Sample mean of the observations, which is the center of the interval.
+ *
+ *  @param halfWidth Half of the width of the interval. If there is only a single observation, then the variance cannot
+ *  be estimated and the half-width is infinite.
+ *
+ *  @param level Confidence level of the interval, in the range (0, 1).
+ *
+ *  @param size Number of observations summarized by the interval.
+ *
+ *  @since 0.3
+ */
+final case class ConfidenceInterval(mean: Double, halfWidth: Double, level: Double, size: Int) {
+
+  /** Lower bound of the interval.
+   *
+   *  @return Lower bound of the interval.
+   *
+   *  @since 0.3
+   */
+  def lower: Double = mean - halfWidth
+
+  /** Upper bound of the interval.
+   *
+   *  @return Upper bound of the interval.
+   *
+   *  @since 0.3
+   */
+  def upper: Double = mean + halfWidth
+
+  /** Determine whether a value lies within this interval.
+   *
+   *  @param x Value to be tested.
+   *
+   *  @return `true` if `x` lies within the closed interval [[lower]] to [[upper]]; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def contains(x: Double): Boolean = x >= lower && x <= upper
+}
+
+/** Confidence interval companion.
+ *
+ *  @since 0.3
+ */
+object ConfidenceInterval {
+
+  /** Construct a confidence interval for the mean of a sample, using ''Student's t''-distribution.
+   *
+   *  The sample variance is determined using Welford's method, which is numerically stable.
+   *
+   *  @param observations Independent observations to be summarized. There must be at least one observation.
+   *
+   *  @param level Required confidence level, in the range (0, 1).
+   *
+   *  @return Confidence interval for the mean of `observations`.
+   *
+   *  @throws IllegalArgumentException if `observations` is empty, or if `level` is outside of the range (0, 1).
+   *
+   *  @since 0.3
+   */
+  def apply(observations: Iterable[Double], level: Double): ConfidenceInterval = {
+    requireValid(observations, observations.nonEmpty)
+    apply(SummaryStatistics(observations), level)
+  }
+
+  /** Construct a confidence interval for the mean of a summarized sample, using ''Student's t''-distribution.
+   *
+   *  @param statistics Summary of the independent observations. There must be at least one observation, and no more
+   *  than `Int.MaxValue` observations.
+   *
+   *  @param level Required confidence level, in the range (0, 1).
+   *
+   *  @return Confidence interval for the mean of the observations summarized by `statistics`.
+   *
+   *  @throws IllegalArgumentException if `statistics` is empty or too large, or if `level` is outside of the range
+   *  (0, 1).
+   *
+   *  @since 0.3
+   */
+  def apply(statistics: SummaryStatistics, level: Double): ConfidenceInterval = {
+    requireValid(statistics, statistics.size > 0L && statistics.size <= Int.MaxValue.toLong)
+    requireValid(level, level > 0.0 && level < 1.0)
+    val n = statistics.size.toInt
+
+    // With a single observation, there is no estimate of the variance, and the interval is unbounded.
+    val halfWidth = statistics.variance.fold(Double.PositiveInfinity) {v =>
+      StudentT.criticalValue(level, n - 1) * Math.sqrt(v / n.toDouble)
+    }
+    ConfidenceInterval(statistics.mean, halfWidth, level, n)
+  }
+}
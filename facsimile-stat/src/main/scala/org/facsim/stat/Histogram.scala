@@ -0,0 +1,135 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.requireValid
+
+/** Immutable histogram of non-negative observations.
+ *
+ *  @constructor Create a new histogram. Histograms are typically created by taking a snapshot of a
+ *  [[ConcurrentHistogram]], or from [[Histogram.empty]].
+ *
+ *  @param layout Layout of the histogram's buckets.
+ *
+ *  @param counts Number of observations in each bucket. There must be one count for each bucket in `layout`.
+ *
+ *  @throws IllegalArgumentException if the number of counts does not match the number of buckets.
+ *
+ *  @since 0.3
+ */
+final case class Histogram(layout: HistogramLayout, counts: Vector[Long])
+extends Statistic[Histogram] {
+  requireValid(counts, counts.length == layout.size)
+
+  /** @inheritdoc */
+  override def reset: Histogram = Histogram.empty(layout)
+
+  /** Total number of observations.
+   *
+   *  @return Number of observations recorded in all buckets.
+   *
+   *  @since 0.3
+   */
+  lazy val total: Long = counts.sum
+
+  /** Combine this histogram with another having the same layout.
+   *
+   *  The combination is associative and commutative, so that histograms from different replications or threads may
+   *  be combined in any order.
+   *
+   *  @param that Histogram to be combined with this histogram.
+   *
+   *  @return Histogram containing the observations in both this histogram and `that`.
+   *
+   *  @throws IllegalArgumentException if `that` has a different layout.
+   *
+   *  @since 0.3
+   */
+  def merge(that: Histogram): Histogram = {
+    requireValid(that, that.layout == layout)
+    Histogram(layout, counts.lazyZip(that.counts).map(_ + _))
+  }
+
+  /** Estimate a quantile of the observations.
+   *
+   *  @param p Probability of the required quantile, in the range (0, 1].
+   *
+   *  @return Upper bound of the bucket containing the `p` quantile, which is no smaller than the quantile itself, and
+   *  which exceeds it by at most the layout's relative bucket width (provided that it lies within the tracked range),
+   *  wrapped in `[[scala.Some Some]]`; or `[[scala.None None]]` if the histogram is empty.
+   *
+   *  @throws IllegalArgumentException if `p` is outside of the range (0, 1].
+   *
+   *  @since 0.3
+   */
+  def quantile(p: Double): Option[Double] = {
+    requireValid(p, p > 0.0 && p <= 1.0)
+    Option.when(total > 0L) {
+      val rank = Math.ceil(p * total.toDouble).toLong
+      val i = counts.iterator.scanLeft(0L)(_ + _).indexWhere(_ >= rank) - 1
+      layout.upperBound(i)
+    }
+  }
+
+  /** Buckets containing observations.
+   *
+   *  @return Sequence of the inclusive lower bound, exclusive upper bound and number of observations of each non-empty
+   *  bucket, in increasing order of value.
+   *
+   *  @since 0.3
+   */
+  def nonEmptyBuckets: Seq[(Double, Double, Long)] = counts.indices.collect {
+    case i if counts(i) > 0L => (layout.lowerBound(i), layout.upperBound(i), counts(i))
+  }
+}
+
+/** Histogram companion.
+ *
+ *  @since 0.3
+ */
+object Histogram {
+
+  /** Create an empty histogram.
+   *
+   *  @param layout Layout of the histogram's buckets.
+   *
+   *  @return Histogram with the specified layout and no observations.
+   *
+   *  @since 0.3
+   */
+  def empty(layout: HistogramLayout): Histogram = Histogram(layout, Vector.fill(layout.size)(0L))
+}
@@ -0,0 +1,165 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.{requireFinite, requireValid}
+
+/** Log-linear histogram bucket layout.
+ *
+ *  Each power-of-two range of values (or ''binade'') between `lowest` and `highest` is divided into `2^precision`
+ *  equal-width buckets, so that the width of each bucket is at most `2^-precision` of its lower bound. This bounds the
+ *  relative error of any value reported from a histogram, irrespective of the magnitude of the observations, so a
+ *  single layout serves metrics—such as queue waiting times—that span many orders of magnitude, without the need to
+ *  tune a bin width in advance.
+ *
+ *  Because the exponent and mantissa of an ''IEEE 754'' double value are contiguous, the bucket of a value is
+ *  determined by shifting its bit pattern, so that no logarithms or divisions are required.
+ *
+ *  Bucket 0 is an ''underflow'' bucket for non-negative values smaller than `lowest`, and the last bucket is an
+ *  ''overflow'' bucket for values at or beyond the upper bound of the bucket containing `highest`.
+ *
+ *  @constructor Create a new bucket layout.
+ *
+ *  @param lowest Smallest value to be distinguished from zero. This value is rounded down to a bucket boundary, and
+ *  must be finite and no smaller than `java.lang.Double.MIN_NORMAL`.
+ *
+ *  @param highest Largest value to be tracked with bounded relative error. This value must be finite and greater than
+ *  `lowest`.
+ *
+ *  @param precision Number of bits used to subdivide each binade, in the range [0, 16]. The number of buckets grows in
+ *  proportion to `2^precision`.
+ *
+ *  @throws IllegalArgumentException if any of the arguments are invalid.
+ *
+ *  @since 0.3
+ */
+final case class HistogramLayout(lowest: Double, highest: Double, precision: Int) {
+  requireFinite(lowest)
+  requireFinite(highest)
+  requireValid(lowest, lowest >= java.lang.Double.MIN_NORMAL)
+  requireValid(highest, highest > lowest)
+  requireValid(precision, precision >= 0 && precision <= HistogramLayout.MaxPrecision)
+
+  /** Number of low-order mantissa bits discarded when determining the bucket of a value. */
+  private val shift = HistogramLayout.MantissaBits - precision
+
+  /** Shifted bit pattern of the lower bound of the first tracked bucket. */
+  private val base = java.lang.Double.doubleToRawLongBits(lowest) >>> shift
+
+  /** Index of the overflow bucket. */
+  private val overflow = ((java.lang.Double.doubleToRawLongBits(highest) >>> shift) - base + 2L).toInt
+
+  /** Number of buckets, including the underflow and overflow buckets.
+   *
+   *  @return Number of buckets in this layout.
+   *
+   *  @since 0.3
+   */
+  def size: Int = overflow + 1
+
+  /** Determine the bucket to which a value belongs.
+   *
+   *  @param value Value whose bucket is required. This value must be non-negative and not `NaN`; this is not verified.
+   *
+   *  @return Index of the bucket containing `value`, in the range [0, [[size]]).
+   *
+   *  @since 0.3
+   */
+  def bucket(value: Double): Int = {
+    val i = (java.lang.Double.doubleToRawLongBits(value) >>> shift) - base + 1L
+    if(i <= 0L) 0
+    else if(i >= overflow.toLong) overflow
+    else i.toInt
+  }
+
+  /** Inclusive lower bound of a bucket.
+   *
+   *  @param i Index of the bucket, in the range [0, [[size]]).
+   *
+   *  @return Smallest value belonging to bucket `i`.
+   *
+   *  @since 0.3
+   */
+  def lowerBound(i: Int): Double = {
+    requireValid(i, i >= 0 && i < size)
+    if(i == 0) 0.0 else java.lang.Double.longBitsToDouble((base + i.toLong - 1L) << shift)
+  }
+
+  /** Exclusive upper bound of a bucket.
+   *
+   *  @param i Index of the bucket, in the range [0, [[size]]).
+   *
+   *  @return Smallest value greater than all those belonging to bucket `i`; this is positive infinity for the overflow
+   *  bucket.
+   *
+   *  @since 0.3
+   */
+  def upperBound(i: Int): Double = {
+    requireValid(i, i >= 0 && i < size)
+    if(i == overflow) Double.PositiveInfinity else java.lang.Double.longBitsToDouble((base + i.toLong) << shift)
+  }
+}
+
+/** Histogram layout companion.
+ *
+ *  @since 0.3
+ */
+object HistogramLayout {
+
+  /** Number of explicit mantissa bits in a double value. */
+  private val MantissaBits = 52
+
+  /** Maximum supported precision. */
+  private val MaxPrecision = 16
+
+  /** Smallest value tracked by the default layout. */
+  private val DefaultMinimum = 1.0e-3
+
+  /** Largest value tracked by the default layout. */
+  private val DefaultMaximum = 1.0e9
+
+  /** Precision of the default layout. */
+  private val DefaultPrecision = 7
+
+  /** Default layout.
+   *
+   *  Tracks values from 10^-3^ to 10^9^ with a relative bucket width of less than 1%.
+   *
+   *  @since 0.3
+   */
+  val Default: HistogramLayout = HistogramLayout(DefaultMinimum, DefaultMaximum, DefaultPrecision)
+}
@@ -0,0 +1,131 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.requireFinite
+
+/** Mutable, constant-memory accumulator of summary statistics.
+ *
+ *  This is the mutable counterpart of [[SummaryStatistics]], intended for hot loops that record very large numbers of
+ *  observations and for which allocating a new summary per observation is undesirable. It uses the same numerically
+ *  stable update.
+ *
+ *  @note Instances are not thread safe. To accumulate statistics concurrently, use one accumulator per thread, then
+ *  [[SummaryStatistics.merge merge]] their results.
+ *
+ *  @constructor Create a new accumulator, with no observations.
+ *
+ *  @since 0.3
+ */
+final class MutableSummaryStatistics {
+
+  /** Number of observations recorded. */
+  private var count: Long = 0L //scalastyle:ignore var.field
+
+  /** Running mean of the observations. */
+  private var mean: Double = 0.0 //scalastyle:ignore var.field
+
+  /** Running sum of squared deviations from the mean. */
+  private var m2: Double = 0.0 //scalastyle:ignore var.field
+
+  /** Smallest observation recorded. */
+  private var minimum: Double = Double.PositiveInfinity //scalastyle:ignore var.field
+
+  /** Largest observation recorded. */
+  private var maximum: Double = Double.NegativeInfinity //scalastyle:ignore var.field
+
+  /** Number of observations recorded.
+   *
+   *  @return Number of observations recorded so far.
+   *
+   *  @since 0.3
+   */
+  def size: Long = count
+
+  /** Record an observation.
+   *
+   *  @param observation Observation to be recorded. This value must be finite.
+   *
+   *  @throws IllegalArgumentException if `observation` is not finite.
+   *
+   *  @since 0.3
+   */
+  def add(observation: Double): Unit = {
+    requireFinite(observation)
+    count += 1L
+    val delta = observation - mean
+    mean += delta / count.toDouble
+    m2 += delta * (observation - mean)
+    if(observation < minimum) minimum = observation
+    if(observation > maximum) maximum = observation
+  }
+
+  /** Record the observations of a summary of a disjoint set of observations.
+   *
+   *  @param that Summary of other observations.
+   *
+   *  @since 0.3
+   */
+  def merge(that: SummaryStatistics): Unit = set(result.merge(that))
+
+  /** Discard all recorded observations.
+   *
+   *  @since 0.3
+   */
+  def clear(): Unit = set(SummaryStatistics.Empty)
+
+  /** Immutable summary of the observations recorded so far.
+   *
+   *  @return Summary of the observations recorded so far. Subsequent changes to this accumulator do not affect the
+   *  returned value.
+   *
+   *  @since 0.3
+   */
+  def result: SummaryStatistics = SummaryStatistics(count, mean, m2, minimum, maximum)
+
+  /** Replace the state of this accumulator.
+   *
+   *  @param s Summary to be adopted.
+   */
+  private def set(s: SummaryStatistics): Unit = {
+    count = s.size
+    mean = s.mean
+    m2 = s.m2
+    minimum = s.minimum
+    maximum = s.maximum
+  }
+}
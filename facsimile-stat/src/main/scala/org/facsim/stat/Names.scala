@@ -0,0 +1,81 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+/** Common statistic names.
+ *
+ *  @since 0.3
+ */
+object Names
+extends Nomenclature {
+
+  /** @inheritdoc */
+  override val PopulationMean: String = LibResource("Names.PopulationMean")
+
+  /** @inheritdoc */
+  override val PopulationMeanEstimate: String = LibResource("Names.PopulationMeanEstimate")
+
+  /** @inheritdoc */
+  override val PopulationStandardDeviation: String = LibResource("Names.PopulationStandardDeviation")
+
+  /** @inheritdoc */
+  override val PopulationStandardDeviationEstimate: String = LibResource("Names.PopulationStandardDeviationEstimate")
+
+  /** @inheritdoc */
+  override val PopulationVariance: String = LibResource("Names.PopulationVariance")
+
+  /** @inheritdoc */
+  override val PopulationVarianceEstimate: String = LibResource("Names.PopulationVarianceEstimate")
+
+  /** @inheritdoc */
+  override val SampleMaximum: String = LibResource("Names.SampleMaximum")
+
+  /** @inheritdoc */
+  override val SampleMean: String = LibResource("Names.SampleMean")
+
+  /** @inheritdoc */
+  override val SampleMinimum: String = LibResource("Names.SampleMinimum")
+
+  /** @inheritdoc */
+  override val SampleQuantile: String = LibResource("Names.SampleQuantile")
+
+  /** @inheritdoc */
+  override val SampleStandardDeviation: String = LibResource("Names.SampleStandardDeviation")
+
+  /** @inheritdoc */
+  override val SampleVariance: String = LibResource("Names.SampleVariance")
+}
@@ -0,0 +1,328 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.{requireFinite, requireValid}
+import scala.collection.mutable.ArrayBuffer
+
+/** Bounded-memory, mergeable sketch of the distribution of a stream of observations, supporting quantile queries.
+ *
+ *  This is a ''KLL'' sketch (after Karnin, Lang & Liberty, ''Optimal Quantile Approximation in Streams'', 2016). It
+ *  retains a sample of the observations in a hierarchy of ''compactors''. Each retained observation at level ''h''
+ *  represents 2^''h''^ original observations. When a compactor fills, its contents are sorted and every other item
+ *  is promoted to the next level, so that the number of observations retained is bounded by roughly three times the
+ *  sketch's `accuracy`, regardless of the number of observations recorded. The amortized cost of recording an
+ *  observation is constant.
+ *
+ *  Unlike the published algorithm, which chooses the items to be promoted at random, this implementation alternates
+ *  between the odd and even items at each level, so that simulation results remain reproducible.
+ *
+ *  The rank error of a quantile estimate is roughly inversely proportional to `accuracy`; for the default accuracy,
+ *  it is typically less than 1% of the number of observations.
+ *
+ *  Sketches of different replications, or of different threads, may be combined using [[merge]].
+ *
+ *  @note Instances are not thread safe. To sketch observations concurrently, use one sketch per thread, then merge
+ *  them.
+ *
+ *  @constructor Create a new, empty sketch.
+ *
+ *  @param accuracy Capacity of the largest compactor, which determines both the accuracy and the memory requirements
+ *  of the sketch. This value must be at least 8.
+ *
+ *  @throws IllegalArgumentException if `accuracy` is less than 8.
+ *
+ *  @since 0.3
+ */
+final class QuantileSketch(val accuracy: Int = QuantileSketch.DefaultAccuracy)
+extends Statistic[QuantileSketch] {
+  requireValid(accuracy, accuracy >= QuantileSketch.MinAccuracy)
+
+  /** Compactors, in level order. */
+  private val compactors = ArrayBuffer(new QuantileSketch.Compactor)
+
+  /** Number of observations recorded. */
+  private var count: Long = 0L //scalastyle:ignore var.field
+
+  /** Number of observations retained, across all compactors. */
+  private var held: Int = 0 //scalastyle:ignore var.field
+
+  /** Number of observations that may be retained before compaction is required. */
+  private var capacity: Int = levelCapacity(0) //scalastyle:ignore var.field
+
+  /** @inheritdoc */
+  override def reset: QuantileSketch = new QuantileSketch(accuracy)
+
+  /** Number of observations recorded.
+   *
+   *  @return Number of observations recorded by this sketch, including those merged into it.
+   *
+   *  @since 0.3
+   */
+  def size: Long = count
+
+  /** Number of observations retained.
+   *
+   *  @return Number of observations currently held by this sketch, which determines its memory usage.
+   *
+   *  @since 0.3
+   */
+  def retained: Int = held
+
+  /** Record an observation.
+   *
+   *  @param observation Observation to be recorded. This value must be finite.
+   *
+   *  @throws IllegalArgumentException if `observation` is not finite.
+   *
+   *  @since 0.3
+   */
+  def add(observation: Double): Unit = {
+    requireFinite(observation)
+    compactors(0) += observation
+    count += 1L
+    held += 1
+    if(held >= capacity) compress()
+  }
+
+  /** Record all of the observations in another sketch.
+   *
+   *  The other sketch is not modified.
+   *
+   *  @param that Sketch of a disjoint set of observations. This must have the same accuracy as this sketch.
+   *
+   *  @throws IllegalArgumentException if `that` is this sketch, or has a different accuracy.
+   *
+   *  @since 0.3
+   */
+  def merge(that: QuantileSketch): Unit = {
+    requireValid(that, (that ne this) && that.accuracy == accuracy)
+    while(compactors.length < that.compactors.length) grow() //scalastyle:ignore while
+    that.compactors.indices.foreach(h => compactors(h) ++= that.compactors(h))
+    count += that.count
+    held += that.held
+    while(held >= capacity) compress() //scalastyle:ignore while
+  }
+
+  /** Estimate a quantile of the observations.
+   *
+   *  @param p Probability of the required quantile, in the range (0, 1].
+   *
+   *  @return Estimated `p` quantile, which is always one of the recorded observations, wrapped in
+   *  `[[scala.Some Some]]`; or `[[scala.None None]]` if no observations have been recorded.
+   *
+   *  @throws IllegalArgumentException if `p` is outside of the range (0, 1].
+   *
+   *  @since 0.3
+   */
+  def quantile(p: Double): Option[Double] = {
+    requireValid(p, p > 0.0 && p <= 1.0)
+    Option.when(count > 0L) {
+      val sorted = weighted
+      val target = Math.ceil(p * count.toDouble).toLong
+      val i = sorted.iterator.map(_._2).scanLeft(0L)(_ + _).drop(1).indexWhere(_ >= target)
+      sorted(if(i < 0) sorted.length - 1 else i)._1
+    }
+  }
+
+  /** Report the name of a quantile estimated by this sketch, using the common statistic `[[Names]]`.
+   *
+   *  @param p Probability of the quantile, in the range (0, 1].
+   *
+   *  @return Name of the `p` quantile, suitable for labeling the value reported by `[[quantile]]`.
+   *
+   *  @throws IllegalArgumentException if `p` is outside of the range (0, 1].
+   *
+   *  @since 0.3
+   */
+  def quantileName(p: Double): String = {
+    requireValid(p, p > 0.0 && p <= 1.0)
+    LibResource("QuantileSketch.QuantileName", Names.SampleQuantile, p)
+  }
+
+  /** Report the symbol of a quantile estimated by this sketch, using the common statistical `[[Symbols]]`.
+   *
+   *  @param p Probability of the quantile, in the range (0, 1].
+   *
+   *  @return Symbol of the `p` quantile, suitable for labeling the value reported by `[[quantile]]`.
+   *
+   *  @throws IllegalArgumentException if `p` is outside of the range (0, 1].
+   *
+   *  @since 0.3
+   */
+  def quantileSymbol(p: Double): String = {
+    requireValid(p, p > 0.0 && p <= 1.0)
+    LibResource("QuantileSketch.QuantileSymbol", Symbols.SampleQuantile, p)
+  }
+
+  /** Estimate the normalized rank of a value.
+   *
+   *  @param value Value whose rank is required.
+   *
+   *  @return Estimated fraction of the observations that are less than or equal to `value`, wrapped in
+   *  `[[scala.Some Some]]`; or `[[scala.None None]]` if no observations have been recorded.
+   *
+   *  @since 0.3
+   */
+  def rank(value: Double): Option[Double] = Option.when(count > 0L) {
+    weighted.iterator.takeWhile(_._1 <= value).map(_._2).sum.toDouble / count.toDouble
+  }
+
+  /** Retained observations and their weights, sorted by observation value.
+   *
+   *  @return Sorted retained observations, each paired with the number of original observations that it represents.
+   */
+  private def weighted: Seq[(Double, Long)] = compactors.indices.flatMap {h =>
+    compactors(h).items.map(x => (x, 1L << h))
+  }.sortBy(_._1)
+
+  /** Capacity of a compactor.
+   *
+   *  Capacities decrease geometrically from the top level downwards, so that the total capacity is bounded.
+   *
+   *  @param h Level of the compactor.
+   *
+   *  @return Number of items that the compactor at level `h` may hold before it must be compacted.
+   */
+  private def levelCapacity(h: Int): Int = {
+    val depth = compactors.length - h - 1
+    Math.max(2, Math.ceil(accuracy.toDouble * Math.pow(QuantileSketch.Shrink, depth.toDouble)).toInt)
+  }
+
+  /** Add a new top-level compactor, and update the total capacity accordingly. */
+  private def grow(): Unit = {
+    compactors += new QuantileSketch.Compactor
+    capacity = compactors.indices.map(levelCapacity).sum
+  }
+
+  /** Compact full compactors, from the bottom level upwards, until the retained observations fit. */
+  private def compress(): Unit = {
+    var h = 0 //scalastyle:ignore var.local
+    while(h < compactors.length && held >= capacity) { //scalastyle:ignore while
+      if(compactors(h).size >= levelCapacity(h)) {
+        if(h + 1 == compactors.length) grow()
+        held -= compactors(h).compactInto(compactors(h + 1))
+      }
+      h += 1
+    }
+  }
+}
+
+/** Quantile sketch companion.
+ *
+ *  @since 0.3
+ */
+object QuantileSketch {
+
+  /** Default accuracy.
+   *
+   *  @since 0.3
+   */
+  val DefaultAccuracy: Int = 200
+
+  /** Minimum accuracy. */
+  private val MinAccuracy = 8
+
+  /** Ratio of the capacity of each compactor to that of the level above. */
+  private val Shrink = 2.0 / 3.0
+
+  /** Buffer of observations that each represent the same number of original observations. */
+  private final class Compactor {
+
+    /** Storage for the buffered observations. */
+    private var buffer = new Array[Double](QuantileSketch.MinAccuracy) //scalastyle:ignore var.field
+
+    /** Number of buffered observations. */
+    private var length = 0 //scalastyle:ignore var.field
+
+    /** Whether the next compaction promotes the odd, rather than the even, items. */
+    private var odd = false //scalastyle:ignore var.field
+
+    /** Number of buffered observations.
+     *
+     *  @return Number of observations currently buffered.
+     */
+    def size: Int = length
+
+    /** Buffered observations.
+     *
+     *  @return Copy of the buffered observations.
+     */
+    def items: Array[Double] = java.util.Arrays.copyOf(buffer, length)
+
+    /** Buffer an observation.
+     *
+     *  @param x Observation to be buffered.
+     */
+    def +=(x: Double): Unit = {
+      if(length == buffer.length) buffer = java.util.Arrays.copyOf(buffer, length * 2)
+      buffer(length) = x
+      length += 1
+    }
+
+    /** Buffer all of the observations of another compactor.
+     *
+     *  @param that Compactor whose observations are to be buffered.
+     */
+    def ++=(that: Compactor): Unit = {
+      if(length + that.length > buffer.length) {
+        buffer = java.util.Arrays.copyOf(buffer, Math.max(length + that.length, length * 2))
+      }
+      System.arraycopy(that.buffer, 0, buffer, length, that.length)
+      length += that.length
+    }
+
+    /** Promote every other buffered observation to the compactor at the next level.
+     *
+     *  If an odd number of observations is buffered, the smallest is retained; all others are removed.
+     *
+     *  @param next Compactor at the next level.
+     *
+     *  @return Reduction in the number of observations retained, across both compactors.
+     */
+    def compactInto(next: Compactor): Int = {
+      java.util.Arrays.sort(buffer, 0, length)
+      val first = length & 1
+      val pairs = length / 2
+      val offset = if(odd) 1 else 0
+      (0 until pairs).foreach(i => next += buffer(first + 2 * i + offset))
+      odd = !odd
+      length = first
+      pairs
+    }
+  }
+}
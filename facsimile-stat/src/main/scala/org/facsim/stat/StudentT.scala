@@ -0,0 +1,221 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.requireValid
+
+/** ''Student's t''-distribution critical values.
+ *
+ *  Critical values are used to construct confidence intervals from small samples, such as the results of a set of
+ *  independent simulation replications, whose variance must be estimated from the sample itself.
+ *
+ *  @see [[https://en.wikipedia.org/wiki/Student%27s_t-distribution Student's t-distribution]] on Wikipedia.
+ *
+ *  @since 0.3
+ */
+object StudentT {
+
+  /** Report the two-sided critical value for the indicated confidence level.
+   *
+   *  The critical value, ''t'', is such that a ''t''-distributed random variable falls in the interval [-''t'', ''t'']
+   *  with probability `level`. It is determined using Hill's algorithm (''Communications of the ACM'', 13(10), 1970,
+   *  Algorithm 396), which is accurate to at least 6 significant figures.
+   *
+   *  @param level Required confidence level, in the range (0, 1).
+   *
+   *  @param degreesOfFreedom Number of degrees of freedom (typically one less than the sample size). This value must be
+   *  positive.
+   *
+   *  @return Two-sided critical value for the confidence level.
+   *
+   *  @throws IllegalArgumentException if `level` is outside the range (0, 1), or if `degreesOfFreedom` is not
+   *  positive.
+   *
+   *  @since 0.3
+   */
+  def criticalValue(level: Double, degreesOfFreedom: Int): Double = {
+    requireValid(level, level > 0.0 && level < 1.0)
+    requireValid(degreesOfFreedom, degreesOfFreedom > 0)
+
+    // Two-tailed probability of exceeding the critical value.
+    val p = 1.0 - level
+    degreesOfFreedom match {
+      case 1 => {
+        val x = p * HalfPi
+        Math.cos(x) / Math.sin(x)
+      }
+      case 2 => Math.sqrt(2.0 / (p * (2.0 - p)) - 2.0)
+      case n => hill(p, n.toDouble)
+    }
+  }
+
+  /** Half of π. */
+  private val HalfPi = Math.PI / 2.0
+
+  /** Scale of the reciprocal squared ''a'' term of Hill's approximation. */
+  private val HillB = 48.0
+
+  /** Coefficient of the ''a''^3^/''b'' part of the ''c'' term of Hill's approximation. */
+  private val HillCLead = 20700.0
+
+  /** Coefficients, highest power of ''a'' first, of the polynomial part of the ''c'' term of Hill's approximation. */
+  private val HillC = Array(-98.0, -16.0, 96.36)
+
+  /** Numerator of the ''d'' term of Hill's approximation. */
+  private val HillD = 94.5
+
+  /** Offset common to the ''d'' and ''z'' terms, and the multiplier of the extreme tail term, of Hill's approximation.
+   */
+  private val HillOffset = 3.0
+
+  /** Tail probability margin, beyond ''a'', above which the asymptotic expansion is used. */
+  private val ExpansionMargin = 0.05
+
+  /** Degrees of freedom below which the ''c'' term is corrected. */
+  private val SmallDegrees = 5.0
+
+  /** Coefficient of the small degrees of freedom correction to the ''c'' term. */
+  private val SmallScale = 0.3
+
+  /** Degrees of freedom offset of the small degrees of freedom correction to the ''c'' term. */
+  private val SmallDegreesOffset = 4.5
+
+  /** Quantile offset of the small degrees of freedom correction to the ''c'' term. */
+  private val SmallQuantileOffset = 0.6
+
+  /** Coefficient of the ''d x''^4^ part of the asymptotic expansion's ''c'' term. */
+  private val ExpansionCLead = 0.05
+
+  /** Coefficients, highest power of ''x'' first, of the remaining polynomial, divided by ''x'', of the asymptotic
+   *  expansion's ''c'' term.
+   */
+  private val ExpansionC = Array(-5.0, -7.0, -2.0)
+
+  /** Coefficients, highest power of ''x''^2^ first, of the numerator of the asymptotic expansion's ''z'' term. */
+  private val ExpansionZ = Array(0.4, 6.3, 36.0, 94.5)
+
+  /** Degrees of freedom offset of the extreme tail term of Hill's approximation. */
+  private val TailDegreesOffset = 6.0
+
+  /** Coefficient of ''d'' in the extreme tail term of Hill's approximation. */
+  private val TailD = 0.089
+
+  /** Constant of the extreme tail term of Hill's approximation. */
+  private val TailConstant = 0.822
+
+  /** Degrees of freedom offset of the extreme tail correction of Hill's approximation. */
+  private val TailCorrectionOffset = 4.0
+
+  /** Hill's approximation to the ''t''-distribution quantile for three or more degrees of freedom.
+   *
+   *  @param p Two-tailed probability.
+   *
+   *  @param n Degrees of freedom.
+   *
+   *  @return Two-sided critical value.
+   */
+  private def hill(p: Double, n: Double): Double = {
+    val a = 1.0 / (n - 0.5)
+    val b = HillB / (a * a)
+    val c0 = HillCLead * a * a * a / b + horner(HillC, a)
+    val d = ((HillD / (b + c0) - HillOffset) / b + 1.0) * Math.sqrt(a * HalfPi) * n
+    val y0 = Math.pow(d * p, 2.0 / n)
+
+    // For all but the most extreme tail probabilities, refine the normal quantile by an asymptotic expansion.
+    val y = if(y0 > ExpansionMargin + a) {
+      val x = normalQuantile(0.5 * p)
+      val x2 = x * x
+      val c1 = if(n < SmallDegrees) c0 + SmallScale * (n - SmallDegreesOffset) * (x + SmallQuantileOffset) else c0
+      val c = (ExpansionCLead * d * x * x2 + horner(ExpansionC, x)) * x + b + c1
+      val z = ((horner(ExpansionZ, x2) / c - x2 - HillOffset) / b + 1.0) * x
+      Math.expm1(a * z * z)
+    }
+    else ((1.0 / (((n + TailDegreesOffset) / (n * y0) - TailD * d - TailConstant) * (n + 2.0) * HillOffset) + 0.5 /
+    (n + TailCorrectionOffset)) * y0 - 1.0) * (n + 1.0) / (n + 2.0) + 1.0 / y0
+    Math.sqrt(n * y)
+  }
+
+  /** Coefficients of the numerator of the central region rational approximation to the normal quantile. */
+  private val CentralNumerator = Array(-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+    1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00)
+
+  /** Coefficients of the denominator of the central region rational approximation to the normal quantile. */
+  private val CentralDenominator = Array(-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+    6.680131188771972e+01, -1.328068155288572e+01, 1.0)
+
+  /** Coefficients of the numerator of the tail region rational approximation to the normal quantile. */
+  private val TailNumerator = Array(-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+    -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00)
+
+  /** Coefficients of the denominator of the tail region rational approximation to the normal quantile. */
+  private val TailDenominator = Array(7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+    3.754408661907416e+00, 1.0)
+
+  /** Probability below which the tail approximation is used. */
+  private val TailProbability = 0.02425
+
+  /** Evaluate a polynomial, with coefficients supplied in order of decreasing power, using Horner's method.
+   *
+   *  @param coefficients Polynomial coefficients, highest power first.
+   *
+   *  @param x Value at which to evaluate the polynomial.
+   *
+   *  @return Value of the polynomial at `x`.
+   */
+  private def horner(coefficients: Array[Double], x: Double): Double = coefficients.foldLeft(0.0)(_ * x + _)
+
+  /** Standard normal distribution lower-tail quantile, using Acklam's rational approximation.
+   *
+   *  The relative error is less than 1.15 × 10^-9^ throughout, which is ample for the ''t'' refinement.
+   *
+   *  @param p Lower-tail probability, in the range (0, 1).
+   *
+   *  @return Value, ''x'', such that a standard normal random variable is less than ''x'' with probability `p`.
+   */
+  private def normalQuantile(p: Double): Double = {
+    if(p < TailProbability) {
+      val q = Math.sqrt(-2.0 * Math.log(p))
+      horner(TailNumerator, q) / horner(TailDenominator, q)
+    }
+    else if(p > 1.0 - TailProbability) -normalQuantile(1.0 - p)
+    else {
+      val q = p - 0.5
+      val r = q * q
+      horner(CentralNumerator, r) * q / horner(CentralDenominator, r)
+    }
+  }
+}
@@ -0,0 +1,182 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat package.
+//======================================================================================================================
+package org.facsim.stat
+
+import org.facsim.util.requireFinite
+
+/** Constant-memory summary of a stream of observations.
+ *
+ *  Summaries are updated using Welford's method, which—unlike the textbook ''sum of squares'' formula—does not suffer
+ *  from catastrophic cancellation when the observations are large relative to their spread, or when very large numbers
+ *  of observations are recorded. Each summary retains just five numbers, irrespective of how many observations it
+ *  describes, and no reference to any prior summary.
+ *
+ *  Summaries of disjoint sets of observations (such as those recorded by different replications, or by different
+ *  threads) can be combined using [[merge]], which is associative and has [[SummaryStatistics.Empty]] as its identity.
+ *
+ *  For hot loops, in which allocation of a new summary for each observation is undesirable, use a
+ *  [[MutableSummaryStatistics]] and retrieve its immutable result once all observations have been recorded.
+ *
+ *  @constructor Create a new summary. Summaries should typically be created by adding observations to
+ *  [[SummaryStatistics.Empty]], or by using [[SummaryStatistics.apply(observations:IterableOnce[Double])*]].
+ *
+ *  @param size Number of observations summarized.
+ *
+ *  @param mean Sample mean of the observations. This value is zero if there are no observations.
+ *
+ *  @param m2 Sum of squared deviations of the observations from their mean.
+ *
+ *  @param minimum Smallest observation. This value is positive infinity if there are no observations.
+ *
+ *  @param maximum Largest observation. This value is negative infinity if there are no observations.
+ *
+ *  @since 0.3
+ */
+final case class SummaryStatistics(size: Long, mean: Double, m2: Double, minimum: Double, maximum: Double)
+extends Statistic[SummaryStatistics] {
+
+  /** @inheritdoc */
+  override def reset: SummaryStatistics = SummaryStatistics.Empty
+
+  /** Determine whether this summary has no observations.
+   *
+   *  @return `true` if no observations have been summarized; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def isEmpty: Boolean = size == 0L
+
+  /** Sum of the observations.
+   *
+   *  @return Sum of all observations summarized, or zero if there are no observations.
+   *
+   *  @since 0.3
+   */
+  def sum: Double = mean * size.toDouble
+
+  /** Sample variance of the observations.
+   *
+   *  @return Unbiased sample variance of the observations, wrapped in `[[scala.Some Some]]`, or `[[scala.None None]]`
+   *  if there are fewer than two observations.
+   *
+   *  @since 0.3
+   */
+  def variance: Option[Double] = if(size < 2L) None else Some(m2 / (size - 1L).toDouble)
+
+  /** Sample standard deviation of the observations.
+   *
+   *  @return Sample standard deviation of the observations, wrapped in `[[scala.Some Some]]`, or
+   *  `[[scala.None None]]` if there are fewer than two observations.
+   *
+   *  @since 0.3
+   */
+  def stdDeviation: Option[Double] = variance.map(Math.sqrt)
+
+  /** Summarize an additional observation.
+   *
+   *  @param observation Observation to be added. This value must be finite.
+   *
+   *  @return Summary of the observations in this summary, together with `observation`.
+   *
+   *  @throws IllegalArgumentException if `observation` is not finite.
+   *
+   *  @since 0.3
+   */
+  def add(observation: Double): SummaryStatistics = {
+    requireFinite(observation)
+    val n = size + 1L
+    val delta = observation - mean
+    val nextMean = mean + delta / n.toDouble
+    SummaryStatistics(n, nextMean, m2 + delta * (observation - nextMean), Math.min(minimum, observation),
+    Math.max(maximum, observation))
+  }
+
+  /** Combine this summary with a summary of a disjoint set of observations.
+   *
+   *  The combination is performed using the parallel algorithm of Chan, Golub & LeVeque, so that the result is
+   *  equivalent (to within rounding error) to having added all the observations to a single summary.
+   *
+   *  @param that Summary of other observations.
+   *
+   *  @return Summary of the observations in both this summary and `that`.
+   *
+   *  @since 0.3
+   */
+  def merge(that: SummaryStatistics): SummaryStatistics = {
+    if(that.isEmpty) this
+    else if(isEmpty) that
+    else {
+      val n = size + that.size
+      val delta = that.mean - mean
+      val thatFraction = that.size.toDouble / n.toDouble
+      val nextMean = mean + delta * thatFraction
+      val nextM2 = m2 + that.m2 + delta * delta * size.toDouble * thatFraction
+      SummaryStatistics(n, nextMean, nextM2, Math.min(minimum, that.minimum), Math.max(maximum, that.maximum))
+    }
+  }
+}
+
+/** Summary statistics companion.
+ *
+ *  @since 0.3
+ */
+object SummaryStatistics {
+
+  /** Summary of no observations.
+   *
+   *  @since 0.3
+   */
+  val Empty: SummaryStatistics = SummaryStatistics(0L, 0.0, 0.0, Double.PositiveInfinity, Double.NegativeInfinity)
+
+  /** Summarize a sequence of observations.
+   *
+   *  Observations are summarized in a single pass, without allocating a new summary for each observation.
+   *
+   *  @param observations Observations to be summarized. Each observation must be finite.
+   *
+   *  @return Summary of `observations`.
+   *
+   *  @throws IllegalArgumentException if any observation is not finite.
+   *
+   *  @since 0.3
+   */
+  def apply(observations: IterableOnce[Double]): SummaryStatistics = {
+    val acc = new MutableSummaryStatistics
+    observations.iterator.foreach(acc.add)
+    acc.result
+  }
+}
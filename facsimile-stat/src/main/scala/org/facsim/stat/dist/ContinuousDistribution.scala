@@ -0,0 +1,90 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+
+/** Continuous probability distribution of double values.
+ *
+ *  @since 0.3
+ */
+trait ContinuousDistribution
+extends Distribution[Double] {
+
+  /** Mean of this distribution.
+   *
+   *  @return Expected value of a random variate sampled from this distribution.
+   *
+   *  @since 0.3
+   */
+  def mean: Double
+
+  /** Variance of this distribution.
+   *
+   *  @return Variance of a random variate sampled from this distribution.
+   *
+   *  @since 0.3
+   */
+  def variance: Double
+
+  /** Fill an array with random variates sampled from this distribution.
+   *
+   *  This allows, say, a block of service times to be drawn in a single call. The array is filled with the same values,
+   *  in the same order, as successive calls to `[[sample]]` would produce.
+   *
+   *  @tparam G Final type of the generator, which must be a subclass of `[[org.facsim.stat.prng.PRNG PRNG]][G]`.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @param g Generator instance to be employed to sample the variates.
+   *
+   *  @return Generator instance following the last variate sampled.
+   *
+   *  @since 0.3
+   */
+  def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    var gi = g //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < values.length) { //scalastyle:ignore while
+      val (x, nextG) = sample(gi)
+      values(i) = x
+      gi = nextG
+      i += 1
+    }
+    gi
+  }
+}
@@ -0,0 +1,168 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+import scala.collection.mutable
+
+/** Discrete empirical distribution.
+ *
+ *  Outcomes are sampled in constant time, irrespective of the number of outcomes, using Vose's implementation of
+ *  Walker's ''alias method'': each sample requires a single uniform variate, which selects a column of the alias table
+ *  and determines whether that column's own outcome, or its alias, is chosen.
+ *
+ *  @tparam A Type of outcome.
+ *
+ *  @constructor Create a new discrete distribution.
+ *
+ *  @param outcomes Possible outcomes, each paired with its relative weight. There must be at least one outcome, each
+ *  weight must be finite and non-negative, and at least one weight must be positive. Weights need not sum to one.
+ *
+ *  @throws IllegalArgumentException if `outcomes` is invalid.
+ *
+ *  @since 0.3
+ */
+final case class Discrete[A](outcomes: IndexedSeq[(A, Double)])
+extends Distribution[A] {
+  requireValid(outcomes, outcomes.nonEmpty)
+  outcomes.foreach {
+    case (_, weight) =>
+      requireFinite(weight)
+      requireValid(weight, weight >= 0.0)
+  }
+
+  /** Sum of the weights. */
+  private val total = outcomes.map(_._2).sum
+  requireValid(outcomes, total > 0.0)
+
+  /** Number of outcomes. */
+  private val size = outcomes.length
+
+  /** Probability that each column of the alias table selects its own outcome, rather than its alias. */
+  private val keep = new Array[Double](size)
+
+  /** Outcome index of the alias of each column of the alias table. */
+  private val alias = new Array[Int](size)
+
+  // Build the alias table, by pairing each under-full column with an over-full column.
+  locally {
+    val scaled = outcomes.map(_._2 * size.toDouble / total).toArray
+    val (small, large) = scaled.indices.partition(i => scaled(i) < 1.0)
+    val under = mutable.Stack.from(small)
+    val over = mutable.Stack.from(large)
+    while(under.nonEmpty && over.nonEmpty) { //scalastyle:ignore while
+      val l = under.pop()
+      val g = over.pop()
+      keep(l) = scaled(l)
+      alias(l) = g
+      scaled(g) = scaled(g) + scaled(l) - 1.0
+      if(scaled(g) < 1.0) under.push(g) else over.push(g)
+    }
+
+    // Any remaining columns, whether due to rounding errors or not, are full.
+    (under ++ over).foreach {i =>
+      keep(i) = 1.0
+      alias(i) = i
+    }
+  }
+
+  /** Probability of an outcome.
+   *
+   *  @param i Index of the outcome, in the range [0, `outcomes.length`).
+   *
+   *  @return Probability that outcome `i` is sampled.
+   *
+   *  @since 0.3
+   */
+  def probability(i: Int): Double = outcomes(i)._2 / total
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (A, G) = {
+    val (i, nextG) = sampleIndex(g)
+    (outcomes(i)._1, nextG)
+  }
+
+  /** Sample the index of an outcome.
+   *
+   *  @tparam G Final type of the generator, which must be a subclass of `[[org.facsim.stat.prng.PRNG PRNG]][G]`.
+   *
+   *  @param g Generator instance to be employed to sample the outcome.
+   *
+   *  @return Index of the sampled outcome, together with the next generator instance.
+   *
+   *  @since 0.3
+   */
+  def sampleIndex[G <: PRNG[G]](g: G): (Int, G) = {
+    val (u, nextG) = g.nextDouble
+    (column(u), nextG)
+  }
+
+  /** Fill an array with the indices of sampled outcomes.
+   *
+   *  The array is filled with the same indices, in the same order, as successive calls to `[[sampleIndex]]` would
+   *  produce.
+   *
+   *  @tparam G Final type of the generator, which must be a subclass of `[[org.facsim.stat.prng.PRNG PRNG]][G]`.
+   *
+   *  @param indices Array to be filled. Its existing contents are overwritten.
+   *
+   *  @param g Generator instance to be employed to sample the outcomes.
+   *
+   *  @return Generator instance following the last outcome sampled.
+   *
+   *  @since 0.3
+   */
+  def fillIndices[G <: PRNG[G]](indices: Array[Int], g: G): G = {
+    val u = new Array[Double](indices.length)
+    val nextG = g.fillDoubles(u)
+    indices.indices.foreach(i => indices(i) = column(u(i)))
+    nextG
+  }
+
+  /** Select an outcome using the alias table.
+   *
+   *  @param u Uniform variate, in the range [0, 1).
+   *
+   *  @return Index of the selected outcome.
+   */
+  private def column(u: Double): Int = {
+    val x = u * size.toDouble
+    val i = Math.min(x.toInt, size - 1)
+    if(x - i.toDouble < keep(i)) i else alias(i)
+  }
+}
@@ -0,0 +1,75 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.stat.prng.PRNG.Rand
+
+/** Probability distribution from which random variates may be sampled.
+ *
+ *  Sampling follows the same state-passing style as `[[org.facsim.stat.prng.PRNG.Rand PRNG.Rand]]`: each sample is
+ *  drawn using a generator instance, and is returned together with the next generator instance. The distribution
+ *  itself is immutable, so that it may be shared freely.
+ *
+ *  @tparam A Type of value sampled from the distribution.
+ *
+ *  @since 0.3
+ */
+trait Distribution[A] {
+
+  /** Sample a random variate from this distribution.
+   *
+   *  @tparam G Final type of the generator, which must be a subclass of `[[org.facsim.stat.prng.PRNG PRNG]][G]`.
+   *
+   *  @param g Generator instance to be employed to sample the variate.
+   *
+   *  @return Random variate, together with the next generator instance.
+   *
+   *  @since 0.3
+   */
+  def sample[G <: PRNG[G]](g: G): (A, G)
+
+  /** State transition sampling from this distribution.
+   *
+   *  @tparam G Final type of the generator, which must be a subclass of `[[org.facsim.stat.prng.PRNG PRNG]][G]`.
+   *
+   *  @return State transition that samples a random variate from this distribution.
+   *
+   *  @since 0.3
+   */
+  final def rand[G <: PRNG[G]]: Rand[G, A] = g => sample(g)
+}
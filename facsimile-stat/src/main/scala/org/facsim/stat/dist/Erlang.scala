@@ -0,0 +1,124 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+import scala.annotation.tailrec
+
+/** Erlang distribution.
+ *
+ *  An Erlang variate is the sum of `shape` independent exponential variates, each with mean `mean / shape`; it is
+ *  commonly used to model process times that comprise a number of similar stages. Each stage is sampled using the
+ *  ''ziggurat'' method.
+ *
+ *  @constructor Create a new Erlang distribution.
+ *
+ *  @param shape Number of exponential stages. This value must be positive.
+ *
+ *  @param mean Mean of the distribution. This value must be finite and positive.
+ *
+ *  @throws IllegalArgumentException if `shape` is not positive, or if `mean` is not finite and positive.
+ *
+ *  @since 0.3
+ */
+final case class Erlang(shape: Int, override val mean: Double)
+extends ContinuousDistribution {
+  requireValid(shape, shape > 0)
+  requireFinite(mean)
+  requireValid(mean, mean > 0.0)
+
+  /** Mean of each stage. */
+  private val stageMean = mean / shape.toDouble
+
+  /** @inheritdoc */
+  override def variance: Double = mean * stageMean
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (Double, G) = {
+
+    // Sum the unit exponential variates of each stage.
+    @tailrec
+    def stages(n: Int, sum: Double, gi: G): (Double, G) = {
+      if(n == 0) (stageMean * sum, gi)
+      else {
+        val (x, nextG) = Ziggurat.exponential(gi)
+        stages(n - 1, sum + x, nextG)
+      }
+    }
+    stages(shape, 0.0, g)
+  }
+
+  /** @inheritdoc */
+  override def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+
+    // Sample the stages of as many variates as fit in a batch at once, then sum each variate's stages in turn.
+    val batchSize = Math.max(Erlang.BatchStages / shape, 1)
+    val stages = new Array[Double](Math.min(batchSize, values.length) * shape)
+    var gi = g //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < values.length) { //scalastyle:ignore while
+      val n = Math.min(batchSize, values.length - i)
+      val batch = if(n * shape == stages.length) stages else new Array[Double](n * shape)
+      gi = Ziggurat.fillExponential(batch, gi)
+      var j = 0 //scalastyle:ignore var.local
+      var k = 0 //scalastyle:ignore var.local
+      while(j < n) { //scalastyle:ignore while
+        var sum = 0.0 //scalastyle:ignore var.local
+        val end = k + shape
+        while(k < end) { //scalastyle:ignore while
+          sum += batch(k)
+          k += 1
+        }
+        values(i + j) = stageMean * sum
+        j += 1
+      }
+      i += n
+    }
+    gi
+  }
+}
+
+/** Erlang distribution companion.
+ *
+ *  @since 0.3
+ */
+object Erlang {
+
+  /** Number of exponential stages sampled at a time when filling arrays with variates. */
+  private val BatchStages = 1024
+}
@@ -0,0 +1,75 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+
+/** Exponential distribution.
+ *
+ *  Variates are sampled using the ''ziggurat'' method, which requires neither a logarithm nor a division for the
+ *  overwhelming majority of samples.
+ *
+ *  @constructor Create a new exponential distribution.
+ *
+ *  @param mean Mean of the distribution. This value must be finite and positive.
+ *
+ *  @throws IllegalArgumentException if `mean` is not finite and positive.
+ *
+ *  @since 0.3
+ */
+final case class Exponential(override val mean: Double)
+extends ContinuousDistribution {
+  requireFinite(mean)
+  requireValid(mean, mean > 0.0)
+
+  /** @inheritdoc */
+  override def variance: Double = mean * mean
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (Double, G) = {
+    val (x, nextG) = Ziggurat.exponential(g)
+    (mean * x, nextG)
+  }
+
+  /** @inheritdoc */
+  override def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    val nextG = Ziggurat.fillExponential(values, g)
+    values.indices.foreach(i => values(i) = mean * values(i))
+    nextG
+  }
+}
@@ -0,0 +1,78 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+
+/** Normal (''Gaussian'') distribution.
+ *
+ *  Variates are sampled using the ''ziggurat'' method, which requires neither a logarithm nor a square root for the
+ *  overwhelming majority of samples.
+ *
+ *  @constructor Create a new normal distribution.
+ *
+ *  @param mean Mean of the distribution. This value must be finite.
+ *
+ *  @param stdDeviation Standard deviation of the distribution. This value must be finite and positive.
+ *
+ *  @throws IllegalArgumentException if `mean` is not finite, or if `stdDeviation` is not finite and positive.
+ *
+ *  @since 0.3
+ */
+final case class Normal(override val mean: Double, stdDeviation: Double)
+extends ContinuousDistribution {
+  requireFinite(mean)
+  requireFinite(stdDeviation)
+  requireValid(stdDeviation, stdDeviation > 0.0)
+
+  /** @inheritdoc */
+  override def variance: Double = stdDeviation * stdDeviation
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (Double, G) = {
+    val (z, nextG) = Ziggurat.normal(g)
+    (mean + stdDeviation * z, nextG)
+  }
+
+  /** @inheritdoc */
+  override def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    val nextG = Ziggurat.fillNormal(values, g)
+    values.indices.foreach(i => values(i) = mean + stdDeviation * values(i))
+    nextG
+  }
+}
@@ -0,0 +1,119 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+
+/** Triangular distribution.
+ *
+ *  Variates are sampled by inverting the cumulative distribution function, which has a closed form, so that each
+ *  sample requires a single uniform variate and a square root.
+ *
+ *  @constructor Create a new triangular distribution.
+ *
+ *  @param minimum Smallest possible value. This value must be finite.
+ *
+ *  @param mode Most likely value. This value must be finite, and in the range [`minimum`, `maximum`].
+ *
+ *  @param maximum Largest possible value. This value must be finite and greater than `minimum`.
+ *
+ *  @throws IllegalArgumentException if any argument is not finite, if `maximum` is not greater than `minimum`, or if
+ *  `mode` lies outside of the range [`minimum`, `maximum`].
+ *
+ *  @since 0.3
+ */
+final case class Triangular(minimum: Double, mode: Double, maximum: Double)
+extends ContinuousDistribution {
+  requireFinite(minimum)
+  requireFinite(mode)
+  requireFinite(maximum)
+  requireValid(maximum, maximum > minimum)
+  requireValid(mode, mode >= minimum && mode <= maximum)
+
+  /** Width of the distribution. */
+  private val range = maximum - minimum
+
+  /** Cumulative probability at the mode. */
+  private val modeProb = (mode - minimum) / range
+
+  /** @inheritdoc */
+  override def mean: Double = (minimum + mode + maximum) / Triangular.MeanDivisor
+
+  /** @inheritdoc */
+  override def variance: Double = {
+    (minimum * minimum + mode * mode + maximum * maximum - minimum * mode - minimum * maximum - mode * maximum) /
+    Triangular.VarianceDivisor
+  }
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (Double, G) = {
+    val (u, nextG) = g.nextDouble
+    (inverse(u), nextG)
+  }
+
+  /** @inheritdoc */
+  override def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    val nextG = g.fillDoubles(values)
+    values.indices.foreach(i => values(i) = inverse(values(i)))
+    nextG
+  }
+
+  /** Inverse cumulative distribution function.
+   *
+   *  @param u Cumulative probability, in the range [0, 1).
+   *
+   *  @return Value whose cumulative probability is `u`.
+   */
+  private def inverse(u: Double): Double = {
+    if(u < modeProb) minimum + Math.sqrt(u * range * (mode - minimum))
+    else maximum - Math.sqrt((1.0 - u) * range * (maximum - mode))
+  }
+}
+
+/** Triangular distribution companion.
+ *
+ *  @since 0.3
+ */
+object Triangular {
+
+  /** Divisor of the sum of the distribution's parameters that yields its mean. */
+  private val MeanDivisor = 3.0
+
+  /** Divisor of the distribution's parameter products that yields its variance. */
+  private val VarianceDivisor = 18.0
+}
@@ -0,0 +1,92 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import org.facsim.util.{requireFinite, requireValid}
+
+/** Continuous uniform distribution.
+ *
+ *  @constructor Create a new uniform distribution.
+ *
+ *  @param lower Lower bound of the distribution, which is inclusive. This value must be finite.
+ *
+ *  @param upper Upper bound of the distribution, which is exclusive. This value must be finite and greater than
+ *  `lower`.
+ *
+ *  @throws IllegalArgumentException if either bound is not finite, or if `upper` is not greater than `lower`.
+ *
+ *  @since 0.3
+ */
+final case class Uniform(lower: Double, upper: Double)
+extends ContinuousDistribution {
+  requireFinite(lower)
+  requireFinite(upper)
+  requireValid(upper, upper > lower)
+
+  /** Width of the distribution. */
+  private val range = upper - lower
+
+  /** @inheritdoc */
+  override def mean: Double = lower + 0.5 * range
+
+  /** @inheritdoc */
+  override def variance: Double = range * range / Uniform.VarianceDivisor
+
+  /** @inheritdoc */
+  override def sample[G <: PRNG[G]](g: G): (Double, G) = {
+    val (u, nextG) = g.nextDouble
+    (lower + range * u, nextG)
+  }
+
+  /** @inheritdoc */
+  override def fill[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    val nextG = g.fillDoubles(values)
+    values.indices.foreach(i => values(i) = lower + range * values(i))
+    nextG
+  }
+}
+
+/** Uniform distribution companion.
+ *
+ *  @since 0.3
+ */
+object Uniform {
+
+  /** Divisor of the squared width of the distribution that yields its variance. */
+  private val VarianceDivisor = 12.0
+}
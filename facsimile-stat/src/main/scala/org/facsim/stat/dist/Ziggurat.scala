@@ -0,0 +1,364 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist package.
+//======================================================================================================================
+package org.facsim.stat.dist
+
+import org.facsim.stat.prng.PRNG
+import scala.annotation.tailrec
+
+/** ''Ziggurat'' samplers for the standard normal and unit exponential distributions.
+ *
+ *  These are the algorithms of Marsaglia & Tsang (''The Ziggurat Method for Generating Random Variables'', 2000). The
+ *  density is covered by a stack of equal-area horizontal layers; a single random integer selects a layer and a point
+ *  within it, and in the great majority of cases this point lies wholly inside the density, so that the variate is
+ *  produced with one multiplication and one comparison. Rarely, the point falls within the wedge at the layer's edge,
+ *  or in the tail, and an exact correction is applied.
+ */
+private[dist] object Ziggurat {
+
+  /** Number of layers in the normal ziggurat. */
+  private val NormalLayers = 128
+
+  /** Start of the normal tail. */
+  private val NormalTail = 3.442619855899
+
+  /** Area of each layer of the normal ziggurat. */
+  private val NormalArea = 9.91256303526217e-3
+
+  /** Number of layers in the exponential ziggurat. */
+  private val ExponentialLayers = 256
+
+  /** Start of the exponential tail. */
+  private val ExponentialTail = 7.697117470131487
+
+  /** Area of each layer of the exponential ziggurat. */
+  private val ExponentialArea = 3.949659822581572e-3
+
+  /** Scale of the signed 32-bit integers used to sample the normal ziggurat. */
+  private val NormalScale = 2147483648.0
+
+  /** Scale of the unsigned 32-bit integers used to sample the exponential ziggurat. */
+  private val ExponentialScale = 4294967296.0
+
+  /** Mask retaining an unsigned 32-bit integer value. */
+  private val UnsignedMask = 0xFFFFFFFFL
+
+  /** Number of random integers drawn at a time when filling arrays with variates. */
+  private val BatchSize = 32
+
+  /** Normal layer acceptance thresholds. */
+  private val kn = new Array[Long](NormalLayers)
+
+  /** Normal layer widths, scaled by the integer range. */
+  private val wn = new Array[Double](NormalLayers)
+
+  /** Normal density at the top of each layer. */
+  private val fn = new Array[Double](NormalLayers)
+
+  /** Exponential layer acceptance thresholds. */
+  private val ke = new Array[Long](ExponentialLayers)
+
+  /** Exponential layer widths, scaled by the integer range. */
+  private val we = new Array[Double](ExponentialLayers)
+
+  /** Exponential density at the top of each layer. */
+  private val fe = new Array[Double](ExponentialLayers)
+
+  // Build the normal ziggurat tables.
+  locally {
+    val q = NormalArea / Math.exp(-0.5 * NormalTail * NormalTail)
+    val last = NormalLayers - 1
+    kn(0) = (NormalTail / q * NormalScale).toLong
+    kn(1) = 0L
+    wn(0) = q / NormalScale
+    wn(last) = NormalTail / NormalScale
+    fn(0) = 1.0
+    fn(last) = Math.exp(-0.5 * NormalTail * NormalTail)
+    var tn = NormalTail //scalastyle:ignore var.local
+    var i = last - 1 //scalastyle:ignore var.local
+    while(i > 0) { //scalastyle:ignore while
+      val dn = Math.sqrt(-2.0 * Math.log(NormalArea / tn + Math.exp(-0.5 * tn * tn)))
+      kn(i + 1) = (dn / tn * NormalScale).toLong
+      fn(i) = Math.exp(-0.5 * dn * dn)
+      wn(i) = dn / NormalScale
+      tn = dn
+      i -= 1
+    }
+  }
+
+  // Build the exponential ziggurat tables.
+  locally {
+    val q = ExponentialArea / Math.exp(-ExponentialTail)
+    val last = ExponentialLayers - 1
+    ke(0) = (ExponentialTail / q * ExponentialScale).toLong
+    ke(1) = 0L
+    we(0) = q / ExponentialScale
+    we(last) = ExponentialTail / ExponentialScale
+    fe(0) = 1.0
+    fe(last) = Math.exp(-ExponentialTail)
+    var te = ExponentialTail //scalastyle:ignore var.local
+    var i = last - 1 //scalastyle:ignore var.local
+    while(i > 0) { //scalastyle:ignore while
+      val de = -Math.log(ExponentialArea / te + Math.exp(-te))
+      ke(i + 1) = (de / te * ExponentialScale).toLong
+      fe(i) = Math.exp(-de)
+      we(i) = de / ExponentialScale
+      te = de
+      i -= 1
+    }
+  }
+
+  /** Sample a standard normal variate.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Variate with mean 0 and standard deviation 1, together with the next generator instance.
+   */
+  def normal[G <: PRNG[G]](g: G): (Double, G) = {
+    val (hz, nextG) = g.nextInt
+    normalFrom(hz, nextG)
+  }
+
+  /** Fill an array with standard normal variates.
+   *
+   *  The array is filled with the same values, in the same order, as successive calls to `[[normal]]` would produce.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Generator instance following the last variate sampled.
+   */
+  def fillNormal[G <: PRNG[G]](values: Array[Double], g: G): G = fillFrom(values, g, normalFast, normalFrom[G])
+
+  /** Sample a unit exponential variate.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Variate with mean 1, together with the next generator instance.
+   */
+  def exponential[G <: PRNG[G]](g: G): (Double, G) = {
+    val (i, nextG) = g.nextInt
+    exponentialFrom(i, nextG)
+  }
+
+  /** Fill an array with unit exponential variates.
+   *
+   *  The array is filled with the same values, in the same order, as successive calls to `[[exponential]]` would
+   *  produce.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Generator instance following the last variate sampled.
+   */
+  def fillExponential[G <: PRNG[G]](values: Array[Double], g: G): G = {
+    fillFrom(values, g, exponentialFast, exponentialFrom[G])
+  }
+
+  /** Sample a uniform variate in the range (0, 1], which may safely be passed to `Math.log`.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Uniform variate in the range (0, 1], together with the next generator instance.
+   */
+  def positiveUniform[G <: PRNG[G]](g: G): (Double, G) = {
+    val (u, nextG) = g.nextDouble
+    (1.0 - u, nextG)
+  }
+
+  /** Standard normal variate for a random integer, if it falls wholly inside the density.
+   *
+   *  @param hz Random integer selecting a layer and a point within it.
+   *
+   *  @return Corresponding variate, or `NaN` if the point does not lie wholly inside the density.
+   */
+  private def normalFast(hz: Int): Double = {
+    val iz = hz & (NormalLayers - 1)
+    if(Math.abs(hz.toLong) < kn(iz)) hz.toDouble * wn(iz) else Double.NaN
+  }
+
+  /** Complete the sampling of a standard normal variate from a random integer that has already been drawn.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param hz Random integer selecting a layer and a point within it.
+   *
+   *  @param g Generator instance following the one that produced `hz`.
+   *
+   *  @return Variate with mean 0 and standard deviation 1, together with the next generator instance.
+   */
+  @tailrec
+  private def normalFrom[G <: PRNG[G]](hz: Int, g: G): (Double, G) = {
+    val iz = hz & (NormalLayers - 1)
+    val x = hz.toDouble * wn(iz)
+    if(Math.abs(hz.toLong) < kn(iz)) (x, g)
+    else if(iz == 0) normalTail(hz > 0, g)
+    else {
+      val (u, g1) = g.nextDouble
+      if(fn(iz) + u * (fn(iz - 1) - fn(iz)) < Math.exp(-0.5 * x * x)) (x, g1)
+      else {
+        val (nextHz, g2) = g1.nextInt
+        normalFrom(nextHz, g2)
+      }
+    }
+  }
+
+  /** Unit exponential variate for a random integer, if it falls wholly inside the density.
+   *
+   *  @param i Random integer selecting a layer and a point within it.
+   *
+   *  @return Corresponding variate, or `NaN` if the point does not lie wholly inside the density.
+   */
+  private def exponentialFast(i: Int): Double = {
+    val jz = i.toLong & UnsignedMask
+    val iz = i & (ExponentialLayers - 1)
+    if(jz < ke(iz)) jz.toDouble * we(iz) else Double.NaN
+  }
+
+  /** Complete the sampling of a unit exponential variate from a random integer that has already been drawn.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param i Random integer selecting a layer and a point within it.
+   *
+   *  @param g Generator instance following the one that produced `i`.
+   *
+   *  @return Variate with mean 1, together with the next generator instance.
+   */
+  @tailrec
+  private def exponentialFrom[G <: PRNG[G]](i: Int, g: G): (Double, G) = {
+    val jz = i.toLong & UnsignedMask
+    val iz = i & (ExponentialLayers - 1)
+    val x = jz.toDouble * we(iz)
+    if(jz < ke(iz)) (x, g)
+    else if(iz == 0) {
+      val (u, g1) = positiveUniform(g)
+      (ExponentialTail - Math.log(u), g1)
+    }
+    else {
+      val (u, g1) = g.nextDouble
+      if(fe(iz) + u * (fe(iz - 1) - fe(iz)) < Math.exp(-x)) (x, g1)
+      else {
+        val (nextI, g2) = g1.nextInt
+        exponentialFrom(nextI, g2)
+      }
+    }
+  }
+
+  /** Fill an array with variates, drawing the random integers for the common case in batches.
+   *
+   *  Random integers are drawn using the generator's `fillInts` method, so that no intermediate generator instances
+   *  are created for values that fall wholly inside the density. When a value requires correction, the generator is
+   *  repositioned just after that value's integer and the variate is completed by `slow`, exactly as a single sample
+   *  would be; consequently, the array receives the same values, in the same order, as successive single samples.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @param fast Variate corresponding to a random integer, or `NaN` if that variate requires correction.
+   *
+   *  @param slow Variate corresponding to a random integer that has already been drawn, together with the next
+   *  generator instance.
+   *
+   *  @return Generator instance following the last variate sampled.
+   */
+  private def fillFrom[G <: PRNG[G]](values: Array[Double], g: G, fast: Int => Double,
+  slow: (Int, G) => (Double, G)): G = {
+    val bits = new Array[Int](Math.min(BatchSize, values.length))
+    var gi = g //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < values.length) { //scalastyle:ignore while
+      val batch = if(values.length - i >= bits.length) bits else new Array[Int](values.length - i)
+      val batchG = gi.fillInts(batch)
+      var j = 0 //scalastyle:ignore var.local
+      var accepted = true //scalastyle:ignore var.local
+      while(accepted && j < batch.length) { //scalastyle:ignore while
+        val x = fast(batch(j))
+        if(x.isNaN) accepted = false
+        else {
+          values(i + j) = x
+          j += 1
+        }
+      }
+
+      // If a value requires correction, regenerate the integers up to and including its own, then complete it.
+      if(accepted) gi = batchG
+      else {
+        val (x, nextG) = slow(batch(j), gi.fillInts(new Array[Int](j + 1)))
+        values(i + j) = x
+        gi = nextG
+        j += 1
+      }
+      i += j
+    }
+    gi
+  }
+
+  /** Sample from the tail of the normal distribution, beyond the base layer of the ziggurat.
+   *
+   *  @tparam G Final type of the generator.
+   *
+   *  @param positive Whether the upper, rather than the lower, tail is to be sampled.
+   *
+   *  @param g Generator instance to be employed.
+   *
+   *  @return Variate from the requested tail, together with the next generator instance.
+   */
+  @tailrec
+  private def normalTail[G <: PRNG[G]](positive: Boolean, g: G): (Double, G) = {
+    val (u1, g1) = positiveUniform(g)
+    val (u2, g2) = positiveUniform(g1)
+    val x = -Math.log(u1) / NormalTail
+    val y = -Math.log(u2)
+    if(y + y >= x * x) (if(positive) NormalTail + x else -NormalTail - x, g2)
+    else normalTail(positive, g2)
+  }
+}
@@ -0,0 +1,115 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng package.
+//======================================================================================================================
+package org.facsim.stat.prng
+
+/** ''Antithetic'' ''pseudo-random number'' (''PRN'') generator.
+ *
+ *  Wraps another generator and, when mirrored, complements every value that it generates: integers have their bits
+ *  inverted, and a double value ''u'' becomes `1 - u` (less the smallest difference between generated values, so that
+ *  the result remains in the range [0, 1)). A probability ''p'' sampled using `[[PRNG.nextProb]]` therefore becomes
+ *  (almost exactly) `p.not`.
+ *
+ *  Running a replication with a stream, and again with its mirrored stream, produces a pair of negatively correlated
+ *  observations, whose mean has a lower variance than that of two independent observations. The effect is strongest
+ *  for variates sampled by inversion, such as `[[org.facsim.stat.dist.Uniform Uniform]]` and
+ *  `[[org.facsim.stat.dist.Triangular Triangular]]`; variates sampled by rejection are only partly mirrored.
+ *
+ *  When not mirrored, values are passed through unchanged, so that both the original and mirrored streams have the
+ *  same type.
+ *
+ *  @constructor Create a new antithetic generator.
+ *
+ *  @tparam G Type of the underlying generator.
+ *
+ *  @param base Underlying generator, whose values are to be mirrored.
+ *
+ *  @param mirrored Indicates whether the values of `base` are to be mirrored (`true`) or passed through unchanged
+ *  (`false`).
+ *
+ *  @since 0.3
+ */
+final case class Antithetic[G <: PRNG[G]](base: G, mirrored: Boolean = true)
+extends PRNG[Antithetic[G]] {
+
+  /** Antithetic partner of this generator.
+   *
+   *  @return Generator in the same state as this generator, but whose values are mirrored if this generator's values
+   *  are not, and vice versa.
+   *
+   *  @since 0.3
+   */
+  def antithetic: Antithetic[G] = copy(mirrored = !mirrored)
+
+  /** @inheritdoc */
+  override def nextInt: (Int, Antithetic[G]) = {
+    val (i, nextBase) = base.nextInt
+    (if(mirrored) ~i else i, copy(base = nextBase))
+  }
+
+  /** @inheritdoc */
+  override def nextDouble: (Double, Antithetic[G]) = {
+    val (u, nextBase) = base.nextDouble
+    (if(mirrored) Antithetic.MaxDouble - u else u, copy(base = nextBase))
+  }
+
+  /** @inheritdoc */
+  override def fillInts(values: Array[Int]): Antithetic[G] = {
+    val nextBase = base.fillInts(values)
+    if(mirrored) values.indices.foreach(i => values(i) = ~values(i))
+    copy(base = nextBase)
+  }
+
+  /** @inheritdoc */
+  override def fillDoubles(values: Array[Double]): Antithetic[G] = {
+    val nextBase = base.fillDoubles(values)
+    if(mirrored) values.indices.foreach(i => values(i) = Antithetic.MaxDouble - values(i))
+    copy(base = nextBase)
+  }
+}
+
+/** Antithetic generator companion.
+ *
+ *  @since 0.3
+ */
+object Antithetic {
+
+  /** Largest double value generated from 53 random bits.
+   *
+   *  Subtracting a generated value from this value is exact, and complements its 53 random bits.
+   */
+  private val MaxDouble = 1.0 - PRNG.DoubleUnit
+}
@@ -47,6 +47,7 @@ package org.facsim.stat.prng
  *  @since 0.0
  */
 trait PRNG[G <: PRNG[G]] {
+  self: G =>
 
   /** Generate next random number in current stream.
    *
@@ -56,6 +57,73 @@ trait PRNG[G <: PRNG[G]] {
    *  @since 0.0
    */
   def nextInt: (Int, G)
+
+  /** Generate the next random double value in the current stream.
+   *
+   *  Unlike `[[PRNG.nextProb nextProb]]`, no `[[Probability]]` instance is created, and the value has 53 significant
+   *  bits, rather than 31.
+   *
+   *  By default, the value is formed from the high-order bits of two successive integer values, in the same manner as
+   *  `java.util.Random`. Generators that can produce 64 random bits at once should override this method.
+   *
+   *  @return A uniformly-distributed double value in the range [0, 1), together with the next generator instance.
+   *
+   *  @since 0.3
+   */
+  def nextDouble: (Double, G) = {
+    val (hi, g1) = nextInt
+    val (lo, g2) = g1.nextInt
+    val bits = ((hi >>> 6).toLong << 27) | (lo >>> 5).toLong
+    (bits.toDouble * PRNG.DoubleUnit, g2)
+  }
+
+  /** Fill an array with random integer values from the current stream.
+   *
+   *  The array is filled with the same values, in the same order, as successive calls to `[[nextInt]]` would generate.
+   *  Generators should override this method if they are able to do so without creating an intermediate generator for
+   *  each value.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @return Generator instance following the last value generated.
+   *
+   *  @since 0.3
+   */
+  def fillInts(values: Array[Int]): G = {
+    var g: G = self //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < values.length) { //scalastyle:ignore while
+      val (x, nextG) = g.nextInt
+      values(i) = x
+      g = nextG
+      i += 1
+    }
+    g
+  }
+
+  /** Fill an array with random double values, in the range [0, 1), from the current stream.
+   *
+   *  The array is filled with the same values, in the same order, as successive calls to `[[nextDouble]]` would
+   *  generate. Generators should override this method if they are able to do so without creating an intermediate
+   *  generator for each value.
+   *
+   *  @param values Array to be filled. Its existing contents are overwritten.
+   *
+   *  @return Generator instance following the last value generated.
+   *
+   *  @since 0.3
+   */
+  def fillDoubles(values: Array[Double]): G = {
+    var g: G = self //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < values.length) { //scalastyle:ignore while
+      val (x, nextG) = g.nextDouble
+      values(i) = x
+      g = nextG
+      i += 1
+    }
+    g
+  }
 }
 
 /** ''Pseudo-random number'' companion object.
@@ -64,6 +132,12 @@ trait PRNG[G <: PRNG[G]] {
  */
 object PRNG {
 
+  /** Difference between successive double values generated from 53 random bits.
+   *
+   *  @since 0.3
+   */
+  val DoubleUnit: Double = 1.0 / (1L << 53).toDouble
+
   /** ''State transition'' (a.k.a. ''state action'') for converting the state of a PRNG instance to a new instance.
    *
    *  This signature, for a function that takes a [[PRNG]] instance and uses it to generate a random value of some type
@@ -36,6 +36,8 @@
 //======================================================================================================================
 package org.facsim.stat.prng
 
+import org.facsim.util.requireValid
+
 /** Simple ''pseudo-random number'' (''PRN'') generator, using an algorithm that is identical to that of ''Java''.
  *
  *  @since 0.0
@@ -43,11 +45,100 @@ package org.facsim.stat.prng
 case class SimplePRNG(seed: Long)
 extends PRNG[SimplePRNG] {
 
+  // Helper
+  import SimplePRNG.{Increment, Mask, Multiplier}
+
   /** @inheritdoc */
   override def nextInt: (Int, SimplePRNG) = {
-    val nextSeed = (seed * 0x5DEECE66DL + 0xBL) & 0xFFFFFFFFFFFFL
+    val nextSeed = (seed * Multiplier + Increment) & Mask
     val nextPRNG = SimplePRNG(nextSeed)
     val u = (nextSeed >>> 16).toInt
     (u, nextPRNG)
   }
+
+  /** Advance this generator by the indicated number of steps, without generating the intervening values.
+   *
+   *  The linear congruential recurrence is composed with itself by repeated squaring, so that the cost of the jump is
+   *  logarithmic, rather than linear, in the number of steps.
+   *
+   *  @param steps Number of values to be skipped. This value must be non-negative.
+   *
+   *  @return Generator in the same state as this generator would be after `steps` calls to `nextInt`.
+   *
+   *  @throws IllegalArgumentException if `steps` is negative.
+   *
+   *  @since 0.3
+   */
+  def jump(steps: Long): SimplePRNG = {
+    requireValid(steps, steps >= 0L)
+
+    // Accumulated multiplier and increment of the composed recurrence, together with those of the current power of two.
+    var accMult = 1L //scalastyle:ignore var.local
+    var accPlus = 0L //scalastyle:ignore var.local
+    var curMult = Multiplier //scalastyle:ignore var.local
+    var curPlus = Increment //scalastyle:ignore var.local
+    var k = steps //scalastyle:ignore var.local
+    while(k > 0L) { //scalastyle:ignore while
+      if((k & 1L) != 0L) {
+        accMult = (accMult * curMult) & Mask
+        accPlus = (accPlus * curMult + curPlus) & Mask
+      }
+      curPlus = ((curMult + 1L) * curPlus) & Mask
+      curMult = (curMult * curMult) & Mask
+      k >>>= 1
+    }
+    SimplePRNG((accMult * seed + accPlus) & Mask)
+  }
+}
+
+/** Simple ''pseudo-random number'' generator companion.
+ *
+ *  @since 0.3
+ */
+object SimplePRNG {
+
+  /** Multiplier of the linear congruential recurrence. */
+  private val Multiplier = 0x5DEECE66DL
+
+  /** Increment of the linear congruential recurrence. */
+  private val Increment = 0xBL
+
+  /** Mask retaining the 48 bits of generator state. */
+  private val Mask = 0xFFFFFFFFFFFFL
+
+  /** Number of values in each stream.
+   *
+   *  @since 0.3
+   */
+  val StreamLength: Long = 1L << 32
+
+  /** Number of non-overlapping streams available from a single seed.
+   *
+   *  The 48-bit state has a period of 2^48^ values, which is partitioned into this many streams of [[StreamLength]]
+   *  values each.
+   *
+   *  @since 0.3
+   */
+  val StreamCount: Int = 1 << 16
+
+  /** Create a generator for one of a number of non-overlapping streams, all derived from the same seed.
+   *
+   *  Stream `i` starts `i * StreamLength` values into the sequence generated from `seed`, so that streams do not
+   *  overlap provided that no stream draws more than [[StreamLength]] values. This allows independent simulation
+   *  replications to each use their own stream, while remaining repeatable.
+   *
+   *  @param seed Seed shared by all streams.
+   *
+   *  @param stream Index of the required stream, in the range [0, [[StreamCount]]).
+   *
+   *  @return Generator positioned at the start of the indicated stream.
+   *
+   *  @throws IllegalArgumentException if `stream` is outside of the valid range.
+   *
+   *  @since 0.3
+   */
+  def stream(seed: Long, stream: Int): SimplePRNG = {
+    requireValid(stream, stream >= 0 && stream < StreamCount)
+    SimplePRNG(seed & Mask).jump(stream * StreamLength)
+  }
 }
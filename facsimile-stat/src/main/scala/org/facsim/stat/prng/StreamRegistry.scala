@@ -0,0 +1,135 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng package.
+//======================================================================================================================
+package org.facsim.stat.prng
+
+import org.facsim.util.requireValid
+
+/** Registry of ''pseudo-random number'' streams, keyed by model component name.
+ *
+ *  Comparing alternative scenarios of a model is far more efficient if each scenario samples the same random values
+ *  for the same purposes, using ''common random numbers'' (''CRN''). The differences in the scenarios' results are
+ *  then due largely to the differences between the scenarios, rather than to sampling noise, so that far fewer
+ *  replications are required to identify a significant difference.
+ *
+ *  To achieve this, each stochastic source in a model (such as an action, or an element) should obtain its own stream
+ *  from the registry, using a name (or other identifier) that is the same in each scenario. Streams are determined
+ *  solely by the seed, the replication number and the name, and not by the order in which they are requested, so a
+ *  component retains the same stream even if components are added to, or removed from, a scenario.
+ *
+ *  Each stream is a `[[Xoshiro256PlusPlus]]` generator, seeded from a hash of the registry's key and the stream's
+ *  name. With a period of 2^256^ - 1, the chance of two such streams overlapping within a simulation run is
+ *  negligible.
+ *
+ *  @constructor Create a new stream registry.
+ *
+ *  @param seed Seed from which all of the registry's streams are derived.
+ *
+ *  @param replication Number of the replication whose streams are to be registered. This value cannot be negative.
+ *
+ *  @param mirrored Indicates whether the streams provided by this registry are mirrored `[[Antithetic]]` streams.
+ *
+ *  @throws IllegalArgumentException if `replication` is negative.
+ *
+ *  @since 0.3
+ */
+final case class StreamRegistry(seed: Long, replication: Int, mirrored: Boolean = false) {
+  requireValid(replication, replication >= 0)
+
+  // Helper
+  import StreamRegistry.{Offset, hash}
+
+  /** Hash of the seed and replication number, shared by all of the registry's streams. */
+  private val key = hash(hash(Offset, seed), replication.toLong)
+
+  /** Antithetic partner of this registry.
+   *
+   *  @return Registry providing the same streams as this registry, but whose values are mirrored if this registry's
+   *  values are not, and vice versa.
+   *
+   *  @since 0.3
+   */
+  def antithetic: StreamRegistry = copy(mirrored = !mirrored)
+
+  /** Retrieve the stream for a named model component.
+   *
+   *  The generator returned is always positioned at the start of the component's stream, so a component should
+   *  retrieve its stream once, and thereafter use the updated generator instances that it produces.
+   *
+   *  @param name Name identifying the stochastic source to which the stream belongs. This should typically be the
+   *  name of the model component employing the stream, such as an action's name, or an element's id.
+   *
+   *  @return Generator positioned at the start of the stream for `name`.
+   *
+   *  @since 0.3
+   */
+  def stream(name: String): Antithetic[Xoshiro256PlusPlus] = {
+    Antithetic(Xoshiro256PlusPlus(name.foldLeft(key)((h, c) => hash(h, c.toLong))), mirrored)
+  }
+}
+
+/** Stream registry companion.
+ *
+ *  @since 0.3
+ */
+object StreamRegistry {
+
+  /** Offset basis of the 64-bit ''FNV-1a'' hash. */
+  private val Offset = 0xCBF29CE484222325L
+
+  /** Prime of the 64-bit ''FNV-1a'' hash. */
+  private val Prime = 0x100000001B3L
+
+  /** Number of bits in a byte. */
+  private val ByteSize = java.lang.Byte.SIZE
+
+  /** Mask retaining the least-significant byte of a value. */
+  private val ByteMask = 0xFFL
+
+  /** Add the bytes of a value to a 64-bit ''FNV-1a'' hash.
+   *
+   *  @param h Current hash value.
+   *
+   *  @param value Value whose bytes are to be hashed, least-significant byte first.
+   *
+   *  @return Updated hash value.
+   */
+  private def hash(h: Long, value: Long): Long = {
+    (0 until java.lang.Long.BYTES).foldLeft(h) {(hi, b) =>
+      (hi ^ ((value >>> (b * ByteSize)) & ByteMask)) * Prime
+    }
+  }
+}
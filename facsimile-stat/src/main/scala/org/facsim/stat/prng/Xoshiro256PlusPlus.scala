@@ -0,0 +1,313 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng package.
+//======================================================================================================================
+package org.facsim.stat.prng
+
+import java.lang.Long.rotateLeft
+import org.facsim.util.requireValid
+
+/** ''xoshiro256++'' ''pseudo-random number'' (''PRN'') generator.
+ *
+ *  This is the generator of Blackman & Vigna (''Scrambled Linear Pseudorandom Number Generators'', 2019), which has
+ *  256 bits of state, a period of 2^256^ - 1 and excellent statistical properties, while being considerably faster
+ *  than 48-bit linear congruential generators such as `[[SimplePRNG]]`.
+ *
+ *  Independent streams may be obtained in two ways:
+ *   - `[[jump]]` and `[[longJump]]` advance the generator by 2^128^ and 2^192^ values respectively, so that streams
+ *     created by repeated jumps are guaranteed not to overlap. `[[Xoshiro256PlusPlus.streams]]` uses long jumps to
+ *     create streams for, say, independent replications, which can then be jumped to create sub-streams for individual
+ *     model components.
+ *   - `[[split]]` seeds a new generator from the output of this generator. This is convenient, and the resulting
+ *     streams are statistically independent, but they are not guaranteed to be non-overlapping.
+ *
+ *  Bulk generation, using `[[fillInts]]` and `[[fillDoubles]]`, creates no intermediate generator instances.
+ *
+ *  @constructor Create a new generator with the specified state. Generators should typically be created from a seed,
+ *  using [[Xoshiro256PlusPlus.apply(seed:Long)*]].
+ *
+ *  @param s0 First word of the generator's state.
+ *
+ *  @param s1 Second word of the generator's state.
+ *
+ *  @param s2 Third word of the generator's state.
+ *
+ *  @param s3 Fourth word of the generator's state.
+ *
+ *  @throws IllegalArgumentException if all four words of the state are zero.
+ *
+ *  @since 0.3
+ */
+final case class Xoshiro256PlusPlus(s0: Long, s1: Long, s2: Long, s3: Long)
+extends PRNG[Xoshiro256PlusPlus] {
+  requireValid(this, (s0 | s1 | s2 | s3) != 0L)
+
+  // Helper
+  import Xoshiro256PlusPlus.{DoubleShift, IntShift, JumpPolynomial, LongJumpPolynomial, OutputRotation, StateRotation,
+  StateShift, output}
+
+  /** @inheritdoc */
+  override def nextInt: (Int, Xoshiro256PlusPlus) = {
+    val i = (output(s0, s3) >>> IntShift).toInt
+    (i, advance)
+  }
+
+  /** Generate the next random long integer value in the current stream.
+   *
+   *  @return A uniformly-distributed long integer value in the range [Long.MinValue, Long.MaxValue], together with the
+   *  next generator instance.
+   *
+   *  @since 0.3
+   */
+  def nextLong: (Long, Xoshiro256PlusPlus) = (output(s0, s3), advance)
+
+  /** @inheritdoc */
+  override def nextDouble: (Double, Xoshiro256PlusPlus) = {
+    val d = (output(s0, s3) >>> DoubleShift).toDouble * PRNG.DoubleUnit
+    (d, advance)
+  }
+
+  /** @inheritdoc */
+  override def fillInts(values: Array[Int]): Xoshiro256PlusPlus = {
+    fill(values.length)((i, x) => values(i) = (x >>> IntShift).toInt)
+  }
+
+  /** @inheritdoc */
+  override def fillDoubles(values: Array[Double]): Xoshiro256PlusPlus = {
+    fill(values.length)((i, x) => values(i) = (x >>> DoubleShift).toDouble * PRNG.DoubleUnit)
+  }
+
+  /** Advance this generator by 2^128^ values.
+   *
+   *  @return Generator in the same state as this generator would be after 2^128^ calls to `nextLong`. Up to 2^128^
+   *  non-overlapping streams, each of 2^128^ values, can be obtained by repeated jumps.
+   *
+   *  @since 0.3
+   */
+  def jump: Xoshiro256PlusPlus = jumpBy(JumpPolynomial)
+
+  /** Advance this generator by 2^192^ values.
+   *
+   *  @return Generator in the same state as this generator would be after 2^192^ calls to `nextLong`. Up to 2^64^
+   *  non-overlapping streams, each of 2^192^ values, can be obtained by repeated long jumps; each such stream can then
+   *  be divided into 2^64^ sub-streams using `[[jump]]`.
+   *
+   *  @since 0.3
+   */
+  def longJump: Xoshiro256PlusPlus = jumpBy(LongJumpPolynomial)
+
+  /** Split this generator into two.
+   *
+   *  The new generator is seeded, using `[[Xoshiro256PlusPlus.apply(seed:Long)* Xoshiro256PlusPlus(Long)]]`, with the
+   *  next value of this generator. Its stream is statistically independent of, but not guaranteed to be disjoint from,
+   *  that of this generator; use `[[jump]]` or `[[longJump]]` if non-overlapping streams are required.
+   *
+   *  @return Next instance of this generator, together with a new generator.
+   *
+   *  @since 0.3
+   */
+  def split: (Xoshiro256PlusPlus, Xoshiro256PlusPlus) = {
+    val (seed, nextG) = nextLong
+    (nextG, Xoshiro256PlusPlus(seed))
+  }
+
+  /** Generator instance following this instance.
+   *
+   *  @return Generator with the state that follows the state of this instance.
+   */
+  private def advance: Xoshiro256PlusPlus = {
+    val t = s1 << StateShift
+    val n2 = s2 ^ s0
+    val n3 = s3 ^ s1
+    Xoshiro256PlusPlus(s0 ^ n3, s1 ^ n2, n2 ^ t, rotateLeft(n3, StateRotation))
+  }
+
+  /** Generate a number of successive outputs without creating intermediate generator instances.
+   *
+   *  @param length Number of outputs to be generated.
+   *
+   *  @param store Function storing the output with the indicated index.
+   *
+   *  @return Generator instance following the last output generated.
+   */
+  private def fill(length: Int)(store: (Int, Long) => Unit): Xoshiro256PlusPlus = {
+    var a = s0 //scalastyle:ignore var.local
+    var b = s1 //scalastyle:ignore var.local
+    var c = s2 //scalastyle:ignore var.local
+    var d = s3 //scalastyle:ignore var.local
+    var i = 0 //scalastyle:ignore var.local
+    while(i < length) { //scalastyle:ignore while
+      store(i, output(a, d))
+      val t = b << StateShift
+      c ^= a
+      d ^= b
+      b ^= c
+      a ^= d
+      c ^= t
+      d = rotateLeft(d, StateRotation)
+      i += 1
+    }
+    Xoshiro256PlusPlus(a, b, c, d)
+  }
+
+  /** Advance this generator by the number of values encoded by a jump polynomial.
+   *
+   *  @param polynomial Jump polynomial, as four 64-bit words.
+   *
+   *  @return Generator advanced by the number of values encoded by `polynomial`.
+   */
+  private def jumpBy(polynomial: Seq[Long]): Xoshiro256PlusPlus = {
+    var g: Xoshiro256PlusPlus = this //scalastyle:ignore var.local
+    var j0 = 0L //scalastyle:ignore var.local
+    var j1 = 0L //scalastyle:ignore var.local
+    var j2 = 0L //scalastyle:ignore var.local
+    var j3 = 0L //scalastyle:ignore var.local
+    for {
+      word <- polynomial
+      bit <- 0 until java.lang.Long.SIZE
+    } {
+      if(((word >>> bit) & 1L) != 0L) {
+        j0 ^= g.s0
+        j1 ^= g.s1
+        j2 ^= g.s2
+        j3 ^= g.s3
+      }
+      g = g.advance
+    }
+    Xoshiro256PlusPlus(j0, j1, j2, j3)
+  }
+}
+
+/** ''xoshiro256++'' ''pseudo-random number'' generator companion.
+ *
+ *  @since 0.3
+ */
+object Xoshiro256PlusPlus {
+
+  /** Left shift applied to the second state word during each state transition. */
+  private val StateShift = 17
+
+  /** Left rotation applied to the fourth state word during each state transition. */
+  private val StateRotation = 45
+
+  /** Left rotation applied when scrambling the output. */
+  private val OutputRotation = 23
+
+  /** Right shift retaining the high-order 53 bits of an output as a double value's significand. */
+  private val DoubleShift = java.lang.Long.SIZE - 53
+
+  /** Right shift retaining the high-order 32 bits of an output as an integer value. */
+  private val IntShift = java.lang.Long.SIZE - java.lang.Integer.SIZE
+
+  /** Jump polynomial, advancing a generator by 2^128^ values. */
+  private val JumpPolynomial = Seq(0x180EC6D33CFD0ABAL, 0xD5A61266F0C9392CL, 0xA9582618E03FC9AAL, 0x39ABDC4529B1661CL)
+
+  /** Jump polynomial, advancing a generator by 2^192^ values. */
+  private val LongJumpPolynomial = Seq(0x76E15D3EFEFDCBBFL, 0xC5004E441C522FB3L, 0x77710069854EE241L,
+  0x39109BB02ACBE635L)
+
+  /** Increment of the ''SplitMix64'' generator used to expand seeds. */
+  private val GoldenGamma = 0x9E3779B97F4A7C15L
+
+  /** First right shift applied by the ''SplitMix64'' finalizer. */
+  private val MixShift1 = 30
+
+  /** First multiplier applied by the ''SplitMix64'' finalizer. */
+  private val MixMultiplier1 = 0xBF58476D1CE4E5B9L
+
+  /** Second right shift applied by the ''SplitMix64'' finalizer. */
+  private val MixShift2 = 27
+
+  /** Second multiplier applied by the ''SplitMix64'' finalizer. */
+  private val MixMultiplier2 = 0x94D049BB133111EBL
+
+  /** Final right shift applied by the ''SplitMix64'' finalizer. */
+  private val MixShift3 = 31
+
+  /** Create a generator from a 64-bit seed.
+   *
+   *  The seed is expanded into the generator's 256-bit state using the ''SplitMix64'' generator, as recommended by the
+   *  authors of ''xoshiro256++''; this produces the same state words as the first four values generated by a
+   *  `java.util.SplittableRandom` created with the same seed.
+   *
+   *  @param seed Seed from which the generator's state is to be derived. Any value is acceptable.
+   *
+   *  @return Generator initialized from `seed`.
+   *
+   *  @since 0.3
+   */
+  def apply(seed: Long): Xoshiro256PlusPlus = {
+    val w0 = seed + GoldenGamma
+    val w1 = w0 + GoldenGamma
+    val w2 = w1 + GoldenGamma
+    val w3 = w2 + GoldenGamma
+    Xoshiro256PlusPlus(mix(w0), mix(w1), mix(w2), mix(w3))
+  }
+
+  /** Create a sequence of non-overlapping streams, all derived from the same seed.
+   *
+   *  Each stream starts 2^192^ values after the previous stream, so that streams are guaranteed not to overlap. This
+   *  allows independent simulation replications to each use their own stream, while remaining repeatable.
+   *
+   *  @param seed Seed shared by all streams.
+   *
+   *  @return Generators positioned at the start of each successive stream.
+   *
+   *  @since 0.3
+   */
+  def streams(seed: Long): Iterator[Xoshiro256PlusPlus] = Iterator.iterate(Xoshiro256PlusPlus(seed))(_.longJump)
+
+  /** Scramble the state of a generator to produce an output.
+   *
+   *  @param s0 First word of the generator's state.
+   *
+   *  @param s3 Fourth word of the generator's state.
+   *
+   *  @return Output value corresponding to the state.
+   */
+  private def output(s0: Long, s3: Long): Long = rotateLeft(s0 + s3, OutputRotation) + s0
+
+  /** ''SplitMix64'' finalizer, converting successive values of a Weyl sequence into well-distributed random values.
+   *
+   *  @param z Value to be mixed.
+   *
+   *  @return Mixed value.
+   */
+  private def mix(z: Long): Long = {
+    val z1 = (z ^ (z >>> MixShift1)) * MixMultiplier1
+    val z2 = (z1 ^ (z1 >>> MixShift2)) * MixMultiplier2
+    z2 ^ (z2 >>> MixShift3)
+  }
+}
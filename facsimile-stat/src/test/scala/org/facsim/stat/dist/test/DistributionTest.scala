@@ -0,0 +1,187 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.dist.test package.
+//======================================================================================================================
+package org.facsim.stat.dist.test
+
+import org.facsim.stat.SummaryStatistics
+import org.facsim.stat.dist.{ContinuousDistribution, Discrete, Erlang, Exponential, Normal, Triangular, Uniform}
+import org.facsim.stat.prng.{SimplePRNG, Xoshiro256PlusPlus}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the distributions in the `[[org.facsim.stat.dist]]` package. */
+final class DistributionTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Number of variates sampled when verifying the properties of a distribution. */
+  private val SampleSize = 200000
+
+  /** Distributions to be tested, with the value of a point and the probability of sampling a value below it. */
+  private val distributions = Seq[(ContinuousDistribution, Double, Double)](
+    (Uniform(-1.0, 3.0), 0.0, 0.25),
+    (Exponential(2.0), 2.0, 1.0 - Math.exp(-1.0)),
+    (Exponential(0.5), 4.0, 1.0 - Math.exp(-8.0)),
+    (Normal(10.0, 2.0), 12.0, 0.8413447),
+    (Normal(0.0, 1.0), -2.0, 0.0227501),
+    (Normal(0.0, 1.0), 3.5, 0.9997674),
+    (Triangular(1.0, 2.0, 5.0), 2.0, 0.25),
+    (Triangular(0.0, 0.0, 1.0), 0.5, 0.75),
+    (Erlang(1, 3.0), 3.0, 1.0 - Math.exp(-1.0)),
+    (Erlang(3, 6.0), 2.0, 1.0 - Math.exp(-1.0) * 2.5),
+  )
+
+  /** Sample a large number of variates from a distribution. */
+  private def variates(d: ContinuousDistribution, seed: Long): Array[Double] = {
+    val values = new Array[Double](SampleSize)
+    d.fill(values, Xoshiro256PlusPlus(seed))
+    values
+  }
+
+  // Test the continuous distributions.
+  distributions.foreach {
+    case (d, x, p) =>
+      describe(d.toString) {
+
+        // Verify the moments of the distribution.
+        it("must sample variates with the expected mean and variance") {
+          val s = SummaryStatistics(variates(d, 1L))
+          val sd = Math.sqrt(d.variance)
+          assert(Math.abs(s.mean - d.mean) < 5.0 * sd / Math.sqrt(SampleSize.toDouble))
+          assert(Math.abs(s.variance.get / d.variance - 1.0) < 0.02)
+        }
+
+        // Verify the distribution function at a single point.
+        it("must sample variates with the expected distribution") {
+          val below = variates(d, 2L).count(_ < x).toDouble / SampleSize.toDouble
+          assert(Math.abs(below - p) < 5.0 * Math.sqrt(p * (1.0 - p) / SampleSize.toDouble) + 1.0e-6)
+        }
+
+        // Verify that bulk sampling is equivalent to single samples, and that state is passed correctly.
+        it("must fill arrays with the same variates as successive samples") {
+          forAll(Gen.choose(0, 500), Gen.long) {(n, seed) =>
+            val g = Xoshiro256PlusPlus(seed)
+            val (expected, nextG) = (1 to n).foldLeft((Vector.empty[Double], g)) {
+              case ((xs, gi), _) =>
+                val (v, gn) = d.rand[Xoshiro256PlusPlus](gi)
+                (xs :+ v, gn)
+            }
+            val values = new Array[Double](n)
+            assert(d.fill(values, g) === nextG)
+            assert(values.toVector === expected)
+          }
+        }
+
+        // Verify that distributions work with other generators.
+        it("must sample variates using any generator") {
+          val (v, _) = d.sample(SimplePRNG(5L))
+          assert(!v.isNaN)
+        }
+      }
+  }
+
+  // Verify that invalid parameters are rejected.
+  describe("Continuous distributions") {
+    it("must reject invalid parameters") {
+      assertThrows[IllegalArgumentException](Uniform(1.0, 1.0))
+      assertThrows[IllegalArgumentException](Uniform(0.0, Double.PositiveInfinity))
+      assertThrows[IllegalArgumentException](Exponential(0.0))
+      assertThrows[IllegalArgumentException](Normal(0.0, -1.0))
+      assertThrows[IllegalArgumentException](Normal(Double.NaN, 1.0))
+      assertThrows[IllegalArgumentException](Triangular(0.0, 2.0, 1.0))
+      assertThrows[IllegalArgumentException](Triangular(1.0, 1.0, 1.0))
+      assertThrows[IllegalArgumentException](Erlang(0, 1.0))
+      assertThrows[IllegalArgumentException](Erlang(2, -1.0))
+    }
+  }
+
+  // Test the discrete distribution.
+  describe(classOf[Discrete[_]].getCanonicalName) {
+
+    // Verify that invalid outcomes are rejected.
+    it("must reject invalid outcomes") {
+      assertThrows[IllegalArgumentException](Discrete(IndexedSeq.empty[(String, Double)]))
+      assertThrows[IllegalArgumentException](Discrete(IndexedSeq("a" -> 0.0)))
+      assertThrows[IllegalArgumentException](Discrete(IndexedSeq("a" -> 1.0, "b" -> -1.0)))
+      assertThrows[IllegalArgumentException](Discrete(IndexedSeq("a" -> Double.NaN)))
+    }
+
+    // Verify that outcomes are sampled with the expected frequencies.
+    it("must sample outcomes in proportion to their weights") {
+      forAll(Gen.nonEmptyListOf(Gen.oneOf(Gen.const(0.0), Gen.choose(0.0, 10.0))).suchThat(_.exists(_ > 0.0)),
+      Gen.long) {(weights, seed) =>
+        val d = Discrete(weights.zipWithIndex.map(_.swap).toIndexedSeq)
+        val indices = new Array[Int](20000)
+        d.fillIndices(indices, Xoshiro256PlusPlus(seed))
+        val counts = indices.groupBy(identity).view.mapValues(_.length).toMap
+        weights.indices.foreach {i =>
+          val p = d.probability(i)
+          val f = counts.getOrElse(i, 0).toDouble / indices.length.toDouble
+          if(p == 0.0) assert(f === 0.0)
+          else assert(Math.abs(f - p) < 5.0 * Math.sqrt(p * (1.0 - p) / indices.length.toDouble) + 1.0e-3)
+        }
+      }
+    }
+
+    // Verify that outcomes and indices are sampled consistently.
+    it("must sample outcomes consistently with their indices") {
+      forAll(Gen.long) {seed =>
+        val d = Discrete(IndexedSeq("a" -> 1.0, "b" -> 2.0, "c" -> 3.0))
+        val g = Xoshiro256PlusPlus(seed)
+        val (i, gi) = d.sampleIndex(g)
+        val (o, go) = d.sample(g)
+        val indices = new Array[Int](1)
+        assert(o === d.outcomes(i)._1)
+        assert(gi === go)
+        assert(d.fillIndices(indices, g) === gi)
+        assert(indices(0) === i)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
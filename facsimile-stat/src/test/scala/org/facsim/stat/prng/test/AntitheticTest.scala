@@ -0,0 +1,143 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng.test package.
+//======================================================================================================================
+package org.facsim.stat.prng.test
+
+import org.facsim.stat.prng.{Antithetic, PRNG, SimplePRNG, Xoshiro256PlusPlus}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[Antithetic]] class. */
+final class AntitheticTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  // Tell the user which class we're testing.
+  describe(classOf[Antithetic[_]].getCanonicalName) {
+
+    // Verify that unmirrored generators pass values through unchanged.
+    describe("when not mirrored") {
+      it("must generate the same values as the underlying generator") {
+        forAll {seed: Long =>
+          val base = Xoshiro256PlusPlus(seed)
+          val g = Antithetic(base, mirrored = false)
+          val (i, gi) = g.nextInt
+          val (d, gd) = g.nextDouble
+          assert(i === base.nextInt._1)
+          assert(d === base.nextDouble._1)
+          assert(gi.base === base.nextInt._2)
+          assert(gd.base === base.nextDouble._2)
+          assert(!gi.mirrored)
+        }
+      }
+    }
+
+    // Verify that mirrored generators complement values.
+    describe("when mirrored") {
+      it("must complement the values of the underlying generator") {
+        forAll {seed: Long =>
+          val base = Xoshiro256PlusPlus(seed)
+          val g = Antithetic(base)
+          val (i, gi) = g.nextInt
+          val (d, gd) = g.nextDouble
+          assert(i === ~base.nextInt._1)
+          assert(d + base.nextDouble._1 === 1.0 - PRNG.DoubleUnit)
+          assert(d >= 0.0 && d < 1.0)
+          assert(gi === Antithetic(base.nextInt._2))
+          assert(gd === Antithetic(base.nextDouble._2))
+        }
+      }
+
+      it("must mirror sampled non-negative integers, from which probabilities are sampled") {
+        forAll {seed: Long =>
+          val base = SimplePRNG(seed)
+          val (i, _) = PRNG.nextNonNegInt(base)
+          val (j, _) = PRNG.nextNonNegInt(Antithetic(base))
+          assert(i + j === Int.MaxValue)
+        }
+      }
+    }
+
+    // Verify that bulk generation matches successive values.
+    describe(".fillInts(Array[Int]) and .fillDoubles(Array[Double])") {
+      it("must generate the same values as successive calls") {
+        forAll(Gen.long, Gen.choose(0, 20), Gen.oneOf(true, false)) {(seed, n, mirrored) =>
+          val g = Antithetic(Xoshiro256PlusPlus(seed), mirrored)
+          val ints = new Array[Int](n)
+          val doubles = new Array[Double](n)
+          val gi = g.fillInts(ints)
+          val gd = g.fillDoubles(doubles)
+          val (expectedInts, ei) = (1 to n).foldLeft((Vector.empty[Int], g)) {
+            case ((xs, gx), _) =>
+              val (x, nextG) = gx.nextInt
+              (xs :+ x, nextG)
+          }
+          val (expectedDoubles, ed) = (1 to n).foldLeft((Vector.empty[Double], g)) {
+            case ((xs, gx), _) =>
+              val (x, nextG) = gx.nextDouble
+              (xs :+ x, nextG)
+          }
+          assert(ints.toVector === expectedInts)
+          assert(doubles.toVector === expectedDoubles)
+          assert(gi === ei)
+          assert(gd === ed)
+        }
+      }
+    }
+
+    // Verify antithetic partners.
+    describe(".antithetic") {
+      it("must toggle mirroring") {
+        val g = Antithetic(SimplePRNG(1L), mirrored = false)
+        assert(g.antithetic === Antithetic(SimplePRNG(1L)))
+        assert(g.antithetic.antithetic === g)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,93 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng.test package.
+//======================================================================================================================
+package org.facsim.stat.prng.test
+
+import org.facsim.stat.prng.{PRNG, SimplePRNG}
+import org.facsim.util.test.RegressionBenchmark
+import org.scalameter.api._
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Benchmark of `[[org.facsim.stat.prng.SimplePRNG SimplePRNG]]` value generation throughput.
+ *
+ *  Values generated per second is given by dividing the number of values by the reported time.
+ */
+object SimplePRNGBenchmark
+extends RegressionBenchmark {
+
+  /** Numbers of values to be generated by each measurement. */
+  val counts: Gen[Int] = Gen.exponential("values")(10000, 1000000, 10)
+
+  /** Initial generator. */
+  val prng = SimplePRNG(1234L)
+
+  performance of "SimplePRNG" in {
+    measure method "nextInt" in {
+      using(counts) in {n =>
+        var g = prng //scalastyle:ignore var.local
+        var i = 0 //scalastyle:ignore var.local
+        while(i < n) { //scalastyle:ignore while
+          g = g.nextInt._2
+          i += 1
+        }
+      }
+    }
+    measure method "PRNG.nextProb" in {
+      using(counts) in {n =>
+        var g = prng //scalastyle:ignore var.local
+        var i = 0 //scalastyle:ignore var.local
+        while(i < n) { //scalastyle:ignore while
+          g = PRNG.nextProb(g)._2
+          i += 1
+        }
+      }
+    }
+    measure method "jump" in {
+      using(counts) in {n =>
+        prng.jump(n.toLong)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
@@ -0,0 +1,152 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng.test package.
+//======================================================================================================================
+package org.facsim.stat.prng.test
+
+import org.facsim.stat.prng.SimplePRNG
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import scala.annotation.tailrec
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[SimplePRNG]] class. */
+final class SimplePRNGTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Advance a generator one value at a time.
+   *
+   *  @param g Generator to be advanced.
+   *
+   *  @param steps Number of values to be generated.
+   *
+   *  @return Generator after `steps` values have been generated.
+   */
+  @tailrec
+  private def step(g: SimplePRNG, steps: Int): SimplePRNG = {
+    if(steps == 0) g
+    else step(g.nextInt._2, steps - 1)
+  }
+
+  // Tell the user which class we're testing.
+  describe(classOf[SimplePRNG].getCanonicalName) {
+
+    // Test the nextInt function.
+    describe(".nextInt") {
+
+      // Verify that values are identical to those generated by java.util.Random.
+      it("must generate the same sequence as java.util.Random") {
+        forAll {seed: Long =>
+
+          // java.util.Random scrambles its seed, so we need to do the same.
+          val r = new java.util.Random(seed)
+          val g = SimplePRNG((seed ^ 0x5DEECE66DL) & 0xFFFFFFFFFFFFL)
+          val (i, _) = g.nextInt
+          assert(i === r.nextInt())
+        }
+      }
+    }
+
+    // Test the jump function.
+    describe(".jump(Long)") {
+
+      // Verify that negative jumps are rejected.
+      it("must reject negative step counts") {
+        assertThrows[IllegalArgumentException] {
+          SimplePRNG(0L).jump(-1L)
+        }
+      }
+
+      // Verify that a jump is equivalent to generating the intervening values.
+      it("must match the generator's state after the same number of steps") {
+        forAll(Gen.posNum[Long], Gen.choose(0, 2000)) {(seed, steps) =>
+          val g = SimplePRNG(seed)
+          assert(g.jump(steps.toLong) === step(g, steps))
+        }
+      }
+    }
+  }
+
+  // Test the companion.
+  describe(SimplePRNG.getClass.getCanonicalName) {
+
+    // Test the stream function.
+    describe(".stream(Long, Int)") {
+
+      // Verify that invalid stream indices are rejected.
+      it("must reject invalid stream indices") {
+        assertThrows[IllegalArgumentException] {
+          SimplePRNG.stream(0L, -1)
+        }
+        assertThrows[IllegalArgumentException] {
+          SimplePRNG.stream(0L, SimplePRNG.StreamCount)
+        }
+      }
+
+      // Verify that stream 0 starts from the seed.
+      it("must start stream 0 at the seed") {
+        forAll(Gen.posNum[Long]) {seed =>
+          assert(SimplePRNG.stream(seed, 0) === SimplePRNG(seed & 0xFFFFFFFFFFFFL))
+        }
+      }
+
+      // Verify that each stream starts where the previous stream ends.
+      it("must separate consecutive streams by the stream length") {
+        forAll(Gen.posNum[Long], Gen.choose(0, SimplePRNG.StreamCount - 2)) {(seed, s) =>
+          assert(SimplePRNG.stream(seed, s).jump(SimplePRNG.StreamLength) === SimplePRNG.stream(seed, s + 1))
+        }
+      }
+
+      // Verify that streams generate different values.
+      it("must generate different values for different streams") {
+        val first = (0 until 100).map(s => SimplePRNG.stream(1L, s).nextInt._1)
+        assert(first.distinct.size === first.size)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,115 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng.test package.
+//======================================================================================================================
+package org.facsim.stat.prng.test
+
+import org.facsim.stat.prng.StreamRegistry
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[StreamRegistry]] class. */
+final class StreamRegistryTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Component names. */
+  private val names = Gen.alphaNumStr
+
+  // Tell the user which class we're testing.
+  describe(classOf[StreamRegistry].getCanonicalName) {
+
+    // Verify that negative replication numbers are rejected.
+    it("must reject negative replication numbers") {
+      assertThrows[IllegalArgumentException](StreamRegistry(0L, -1))
+    }
+
+    describe(".stream(String)") {
+
+      // Verify that streams are repeatable.
+      it("must return the same stream for the same seed, replication and name") {
+        forAll(Gen.long, Gen.choose(0, 1000), names) {(seed, r, name) =>
+          assert(StreamRegistry(seed, r).stream(name) === StreamRegistry(seed, r).stream(name))
+        }
+      }
+
+      // Verify that streams do not depend upon the order in which they are requested.
+      it("must not depend upon which other streams have been requested") {
+        val registry = StreamRegistry(7L, 3)
+        val a = registry.stream("a")
+        val b = registry.stream("b")
+        assert(registry.stream("b") === b)
+        assert(registry.stream("a") === a)
+      }
+
+      // Verify that streams differ by name, replication and seed.
+      it("must return different streams for different names, replications and seeds") {
+        val streams = for {
+          seed <- 0L to 3L
+          r <- 0 to 3
+          name <- Seq("", "a", "b", "ab", "ba", "Source1", "Source2")
+        } yield StreamRegistry(seed, r).stream(name).base
+        assert(streams.distinct.size === streams.size)
+      }
+
+      // Verify mirroring.
+      it("must mirror streams if, and only if, the registry is mirrored") {
+        forAll(Gen.long, Gen.choose(0, 1000), names) {(seed, r, name) =>
+          val registry = StreamRegistry(seed, r)
+          val s = registry.stream(name)
+          val m = registry.antithetic.stream(name)
+          assert(!s.mirrored)
+          assert(m.mirrored)
+          assert(m.base === s.base)
+          assert(registry.antithetic.antithetic === registry)
+          assert(m.nextInt._1 === ~s.nextInt._1)
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,194 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.prng.test package.
+//======================================================================================================================
+package org.facsim.stat.prng.test
+
+import java.util.SplittableRandom
+import org.facsim.stat.prng.{SimplePRNG, Xoshiro256PlusPlus}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[Xoshiro256PlusPlus]] class. */
+final class Xoshiro256PlusPlusTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Generator with a simple state, for which reference values are available. */
+  private val reference = Xoshiro256PlusPlus(1L, 2L, 3L, 4L)
+
+  /** Generate a number of successive long values.
+   *
+   *  @param g Generator to be used.
+   *
+   *  @param n Number of values to be generated.
+   *
+   *  @return Generated values, together with the next generator instance.
+   */
+  private def longs(g: Xoshiro256PlusPlus, n: Int): (List[Long], Xoshiro256PlusPlus) = {
+    (1 to n).foldLeft((List.empty[Long], g)) {
+      case ((xs, gi), _) =>
+        val (x, nextG) = gi.nextLong
+        (x :: xs, nextG)
+    } match {
+      case (xs, nextG) => (xs.reverse, nextG)
+    }
+  }
+
+  // Tell the user which class we're testing.
+  describe(classOf[Xoshiro256PlusPlus].getCanonicalName) {
+
+    // Verify that the all-zero state is rejected.
+    it("must reject an all-zero state") {
+      assertThrows[IllegalArgumentException](Xoshiro256PlusPlus(0L, 0L, 0L, 0L))
+    }
+
+    // Verify values against the reference implementation.
+    describe(".nextLong") {
+      it("must generate the same sequence as the reference implementation") {
+        assert(longs(reference, 4)._1 === List(41943041L, 58720359L, 3588806011781223L, 3591011842654386L))
+      }
+    }
+
+    // Verify that integer and double values are derived from the high-order bits of each long value.
+    describe(".nextInt and .nextDouble") {
+      it("must use the high-order bits of each value") {
+        forAll {seed: Long =>
+          val g = Xoshiro256PlusPlus(seed)
+          val (x, nextG) = g.nextLong
+          val (i, gi) = g.nextInt
+          val (d, gd) = g.nextDouble
+          assert(i === (x >>> 32).toInt)
+          assert(d === (x >>> 11).toDouble / (1L << 53).toDouble)
+          assert(d >= 0.0 && d < 1.0)
+          assert(gi === nextG)
+          assert(gd === nextG)
+        }
+      }
+    }
+
+    // Verify the jump functions against the reference implementation.
+    describe(".jump and .longJump") {
+      it("must match the reference implementation") {
+        assert(reference.jump === Xoshiro256PlusPlus(-8324317625228856367L, 8079205330032121950L, 7289065458748526725L,
+          -8969279818415701936L))
+        assert(reference.longJump === Xoshiro256PlusPlus(678511610814637056L, -2596244294217022186L,
+          6002989639035333134L, 3559352929785830385L))
+      }
+    }
+
+    // Verify bulk generation.
+    describe(".fillInts(Array[Int]) and .fillDoubles(Array[Double])") {
+      it("must fill arrays with the same values as successive single draws") {
+        forAll(Gen.choose(0, 100), Gen.long) {(n, seed) =>
+          val g = Xoshiro256PlusPlus(seed)
+          val (xs, nextG) = longs(g, n)
+          val ints = new Array[Int](n)
+          val doubles = new Array[Double](n)
+          assert(g.fillInts(ints) === nextG)
+          assert(g.fillDoubles(doubles) === nextG)
+          assert(ints.toList === xs.map(x => (x >>> 32).toInt))
+          assert(doubles.toList === xs.map(x => (x >>> 11).toDouble / (1L << 53).toDouble))
+        }
+      }
+    }
+
+    // Verify splitting.
+    describe(".split") {
+      it("must advance this generator and seed a new generator from its next value") {
+        forAll {seed: Long =>
+          val g = Xoshiro256PlusPlus(seed)
+          val (x, nextG) = g.nextLong
+          assert(g.split === ((nextG, Xoshiro256PlusPlus(x))))
+        }
+      }
+    }
+  }
+
+  // Test the companion.
+  describe(Xoshiro256PlusPlus.getClass.getCanonicalName) {
+
+    // Verify seeding
+    describe(".apply(Long)") {
+      it("must expand seeds using SplitMix64") {
+        forAll {seed: Long =>
+          val r = new SplittableRandom(seed)
+          assert(Xoshiro256PlusPlus(seed) === Xoshiro256PlusPlus(r.nextLong(), r.nextLong(), r.nextLong(),
+            r.nextLong()))
+        }
+        assert(Xoshiro256PlusPlus(42L).nextLong._1 === -3425465463722317665L)
+      }
+    }
+
+    // Verify streams.
+    describe(".streams(Long)") {
+      it("must separate streams by long jumps") {
+        val streams = Xoshiro256PlusPlus.streams(7L).take(3).toList
+        assert(streams.head === Xoshiro256PlusPlus(7L))
+        assert(streams(1) === streams.head.longJump)
+        assert(streams(2) === streams(1).longJump)
+      }
+    }
+  }
+
+  // Verify the default bulk generation of the PRNG trait.
+  describe(classOf[SimplePRNG].getCanonicalName) {
+    describe(".fillInts(Array[Int]) and .nextDouble") {
+      it("must match successive single draws and java.util.Random") {
+        forAll {seed: Long =>
+          val g = SimplePRNG((seed ^ 0x5DEECE66DL) & 0xFFFFFFFFFFFFL)
+          val r = new java.util.Random(seed)
+          val ints = new Array[Int](3)
+          val nextG = g.fillInts(ints)
+          assert(ints.toList === List.fill(3)(r.nextInt()))
+          assert(nextG.nextDouble._1 === r.nextDouble())
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
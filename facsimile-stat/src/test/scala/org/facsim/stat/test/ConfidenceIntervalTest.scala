@@ -0,0 +1,141 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.test package.
+//======================================================================================================================
+package org.facsim.stat.test
+
+import org.facsim.stat.{ConfidenceInterval, StudentT}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[ConfidenceInterval]] class and the [[StudentT]] object. */
+final class ConfidenceIntervalTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Published two-sided critical values, as (level, degrees of freedom, critical value). */
+  private val tTable = Seq(
+    (0.95, 1, 12.7062),
+    (0.95, 2, 4.3027),
+    (0.95, 3, 3.1824),
+    (0.95, 4, 2.7764),
+    (0.95, 9, 2.2622),
+    (0.95, 29, 2.0452),
+    (0.95, 99, 1.9842),
+    (0.99, 4, 4.6041),
+    (0.99, 29, 2.7564),
+    (0.90, 9, 1.8331),
+    (0.80, 29, 1.3114),
+  )
+
+  // Test the Student's t critical values.
+  describe(StudentT.getClass.getCanonicalName) {
+    describe(".criticalValue(Double, Int)") {
+
+      // Verify that invalid arguments are rejected.
+      it("must reject invalid arguments") {
+        assertThrows[IllegalArgumentException](StudentT.criticalValue(0.0, 10))
+        assertThrows[IllegalArgumentException](StudentT.criticalValue(1.0, 10))
+        assertThrows[IllegalArgumentException](StudentT.criticalValue(0.95, 0))
+      }
+
+      // Verify values against published tables.
+      it("must match published critical values") {
+        tTable.foreach {
+          case (level, df, t) => assert(Math.abs(StudentT.criticalValue(level, df) - t) < 1.0e-4)
+        }
+      }
+
+      // Verify that critical values approach those of the normal distribution.
+      it("must approach the normal distribution for large sample sizes") {
+        assert(Math.abs(StudentT.criticalValue(0.95, 1000000) - 1.959964) < 1.0e-5)
+      }
+    }
+  }
+
+  // Test the confidence interval factory.
+  describe(ConfidenceInterval.getClass.getCanonicalName) {
+    describe(".apply(Iterable[Double], Double)") {
+
+      // Verify that invalid arguments are rejected.
+      it("must reject invalid arguments") {
+        assertThrows[IllegalArgumentException](ConfidenceInterval(Nil, 0.95))
+        assertThrows[IllegalArgumentException](ConfidenceInterval(Seq(1.0, 2.0), 1.0))
+      }
+
+      // Verify that a single observation has an unbounded interval.
+      it("must report an unbounded interval for a single observation") {
+        val ci = ConfidenceInterval(Seq(5.0), 0.95)
+        assert(ci.mean === 5.0)
+        assert(ci.halfWidth === Double.PositiveInfinity)
+        assert(ci.size === 1)
+      }
+
+      // Verify a known example.
+      it("must report the correct interval for a known sample") {
+        val ci = ConfidenceInterval(Seq(2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0), 0.95)
+        val expectedHalfWidth = 2.3646 * Math.sqrt(32.0 / 7.0 / 8.0)
+        assert(ci.mean === 5.0)
+        assert(Math.abs(ci.halfWidth - expectedHalfWidth) < 1.0e-3)
+        assert(ci.level === 0.95)
+        assert(ci.size === 8)
+        assert(ci.contains(ci.lower) && ci.contains(ci.upper) && !ci.contains(ci.upper + 1.0e-6))
+      }
+
+      // Verify that the interval is unaffected by a constant offset, which would otherwise cause cancellation errors.
+      it("must be numerically stable") {
+        forAll(Gen.nonEmptyListOf(Gen.choose(-1.0, 1.0)).suchThat(_.size > 1)) {xs =>
+          val ci = ConfidenceInterval(xs, 0.95)
+          val offset = ConfidenceInterval(xs.map(_ + 1.0e9), 0.95)
+          assert(Math.abs(offset.mean - 1.0e9 - ci.mean) < 1.0e-5)
+          assert(Math.abs(offset.halfWidth - ci.halfWidth) < 1.0e-5)
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
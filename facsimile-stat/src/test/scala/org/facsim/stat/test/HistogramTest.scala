@@ -0,0 +1,198 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.test package.
+//======================================================================================================================
+package org.facsim.stat.test
+
+import org.facsim.stat.{ConcurrentHistogram, Histogram, HistogramLayout}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import scala.concurrent.duration.Duration
+import scala.concurrent.{Await, ExecutionContext, Future}
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[HistogramLayout]], [[Histogram]] and [[ConcurrentHistogram]] classes. */
+final class HistogramTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Layout used for testing. */
+  private val layout = HistogramLayout(1.0e-3, 1.0e6, 5)
+
+  /** Generator for values within the tracked range of the test layout. */
+  private val tracked = Gen.choose(1.0e-3, 1.0e6)
+
+  /** Generator for lists of non-negative observations, including some outside of the tracked range. */
+  private val observations = Gen.listOf(Gen.oneOf(tracked, Gen.choose(0.0, 1.0e-3), Gen.choose(1.0e6, 1.0e9)))
+
+  /** Create a histogram from a list of observations. */
+  private def histogramOf(xs: Seq[Double]): Histogram = {
+    val h = new ConcurrentHistogram(layout, 1)
+    xs.foreach(h.record)
+    h.snapshot
+  }
+
+  // Test the histogram layout class.
+  describe(classOf[HistogramLayout].getCanonicalName) {
+
+    // Verify that invalid arguments are rejected.
+    it("must reject invalid arguments") {
+      assertThrows[IllegalArgumentException](HistogramLayout(0.0, 1.0, 5))
+      assertThrows[IllegalArgumentException](HistogramLayout(1.0, 1.0, 5))
+      assertThrows[IllegalArgumentException](HistogramLayout(1.0, Double.PositiveInfinity, 5))
+      assertThrows[IllegalArgumentException](HistogramLayout(1.0, 2.0, -1))
+      assertThrows[IllegalArgumentException](HistogramLayout(1.0, 2.0, 17))
+    }
+
+    // Verify that each tracked value lies within its bucket, and that the bucket's relative width is bounded.
+    it("must place tracked values in buckets of bounded relative width") {
+      forAll(tracked) {x =>
+        val i = layout.bucket(x)
+        assert(i > 0 && i < layout.size - 1)
+        assert(layout.lowerBound(i) <= x && x < layout.upperBound(i))
+        assert(layout.upperBound(i) - layout.lowerBound(i) <= layout.lowerBound(i) / 32.0)
+      }
+    }
+
+    // Verify the underflow and overflow buckets.
+    it("must place untracked values in the underflow and overflow buckets") {
+      assert(layout.bucket(0.0) === 0)
+      assert(layout.bucket(1.0e-4) === 0)
+      assert(layout.bucket(1.0e9) === layout.size - 1)
+      assert(layout.bucket(Double.PositiveInfinity) === layout.size - 1)
+      assert(layout.lowerBound(0) === 0.0)
+      assert(layout.upperBound(layout.size - 1) === Double.PositiveInfinity)
+    }
+
+    // Verify that buckets are contiguous.
+    it("must have contiguous buckets") {
+      (1 until layout.size).foreach(i => assert(layout.lowerBound(i) === layout.upperBound(i - 1)))
+    }
+  }
+
+  // Test the histogram class.
+  describe(classOf[Histogram].getCanonicalName) {
+
+    // Verify merging.
+    describe(".merge(Histogram)") {
+
+      // Verify that merging histograms is equivalent to recording all observations in a single histogram.
+      it("must be equivalent to recording all observations") {
+        forAll(observations, observations) {(xs, ys) =>
+          val merged = histogramOf(xs).merge(histogramOf(ys))
+          assert(merged === histogramOf(xs ++ ys))
+          assert(merged.total === (xs.size + ys.size).toLong)
+        }
+      }
+
+      // Verify that histograms with different layouts cannot be merged.
+      it("must reject histograms with different layouts") {
+        val other = Histogram.empty(HistogramLayout(1.0e-3, 1.0e6, 4))
+        assertThrows[IllegalArgumentException](histogramOf(Nil).merge(other))
+      }
+    }
+
+    // Verify quantile estimates.
+    describe(".quantile(Double)") {
+
+      // Verify that invalid arguments are rejected, and that empty histograms have no quantiles.
+      it("must reject invalid probabilities and report no quantiles when empty") {
+        val h = Histogram.empty(layout)
+        assertThrows[IllegalArgumentException](h.quantile(0.0))
+        assertThrows[IllegalArgumentException](h.quantile(1.1))
+        assert(h.quantile(0.5) === None)
+      }
+
+      // Verify that quantile estimates have bounded relative error.
+      it("must estimate quantiles with bounded relative error") {
+        forAll(Gen.nonEmptyListOf(tracked), Gen.choose(0.01, 1.0)) {(xs, p) =>
+          val sorted = xs.sorted
+          val exact = sorted((Math.ceil(p * xs.size.toDouble).toInt - 1).max(0))
+          val estimate = histogramOf(xs).quantile(p).get
+          assert(estimate > exact)
+          assert(estimate <= exact * (1.0 + 1.0 / 32.0))
+        }
+      }
+    }
+
+    // Verify reporting of non-empty buckets.
+    it("must report non-empty buckets in order") {
+      val h = histogramOf(Seq(1.0, 1.0, 100.0))
+      val buckets = h.nonEmptyBuckets
+      assert(buckets.map(_._3) === Seq(2L, 1L))
+      assert(buckets.head._1 <= 1.0 && 1.0 < buckets.head._2)
+      assert(buckets(1)._1 <= 100.0 && 100.0 < buckets(1)._2)
+    }
+  }
+
+  // Test the concurrent histogram class.
+  describe(classOf[ConcurrentHistogram].getCanonicalName) {
+
+    // Verify that invalid arguments and observations are rejected.
+    it("must reject invalid arguments") {
+      assertThrows[IllegalArgumentException](new ConcurrentHistogram(layout, 0))
+      val h = new ConcurrentHistogram(layout)
+      assertThrows[IllegalArgumentException](h.record(-1.0))
+      assertThrows[IllegalArgumentException](h.record(Double.NaN))
+    }
+
+    // Verify that observations recorded concurrently are not lost.
+    it("must count all observations recorded concurrently") {
+      implicit val ec: ExecutionContext = ExecutionContext.global
+      val h = new ConcurrentHistogram(layout, 4)
+      val threads = 8
+      val perThread = 10000
+      val tasks = Future.traverse((1 to threads).toList) {t =>
+        Future((1 to perThread).foreach(i => h.record(t.toDouble * i.toDouble)))
+      }
+      Await.result(tasks, Duration.Inf)
+      val snapshot = h.snapshot
+      assert(snapshot.total === (threads * perThread).toLong)
+      assert(snapshot === histogramOf((1 to threads).flatMap(t => (1 to perThread).map(i => t.toDouble * i.toDouble))))
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
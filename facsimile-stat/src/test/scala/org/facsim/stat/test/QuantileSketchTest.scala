@@ -0,0 +1,182 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.test package.
+//======================================================================================================================
+package org.facsim.stat.test
+
+import org.facsim.stat.{Names, QuantileSketch, Symbols}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import scala.util.Random
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[QuantileSketch]] class. */
+final class QuantileSketchTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Maximum permitted rank error, as a fraction of the number of observations. */
+  private val RankTolerance = 0.02
+
+  /** Probabilities at which quantiles are verified. */
+  private val probabilities = Seq(0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99, 1.0)
+
+  /** Create a sketch of a sequence of observations. */
+  private def sketchOf(xs: Iterable[Double], accuracy: Int = QuantileSketch.DefaultAccuracy): QuantileSketch = {
+    val sketch = new QuantileSketch(accuracy)
+    xs.foreach(sketch.add)
+    sketch
+  }
+
+  /** Verify that each estimated quantile has a true rank close to the required probability. */
+  private def assertAccurate(sketch: QuantileSketch, xs: IndexedSeq[Double]): Unit = {
+    val sorted = xs.sorted
+    probabilities.foreach {p =>
+      val q = sketch.quantile(p).get
+      val trueRank = sorted.count(_ <= q).toDouble / sorted.size.toDouble
+      assert(Math.abs(trueRank - p) <= RankTolerance, s"p = $p, q = $q, true rank = $trueRank")
+    }
+  }
+
+  describe(classOf[QuantileSketch].getCanonicalName) {
+
+    // Verify that invalid arguments are rejected.
+    it("must reject invalid arguments") {
+      assertThrows[IllegalArgumentException](new QuantileSketch(7))
+      val sketch = new QuantileSketch
+      assertThrows[IllegalArgumentException](sketch.add(Double.NaN))
+      assertThrows[IllegalArgumentException](sketch.quantile(0.0))
+      assertThrows[IllegalArgumentException](sketch.quantile(1.5))
+      assertThrows[IllegalArgumentException](sketch.merge(sketch))
+      assertThrows[IllegalArgumentException](sketch.merge(new QuantileSketch(100)))
+    }
+
+    // Verify that empty sketches report no quantiles.
+    it("must report no quantiles or ranks when empty") {
+      val sketch = new QuantileSketch
+      assert(sketch.size === 0L)
+      assert(sketch.quantile(0.5) === None)
+      assert(sketch.rank(0.0) === None)
+    }
+
+    // Verify that small samples are represented exactly.
+    it("must report exact quantiles for small samples") {
+      forAll(Gen.nonEmptyListOf(Gen.choose(-1.0e6, 1.0e6)).suchThat(_.size < 100)) {xs =>
+        val sketch = sketchOf(xs)
+        val sorted = xs.sorted
+        assert(sketch.quantile(1.0) === Some(sorted.last))
+        assert(sketch.quantile(0.5) === Some(sorted((sorted.size + 1) / 2 - 1)))
+        assert(sketch.rank(sorted.head) === Some(sorted.count(_ <= sorted.head).toDouble / sorted.size.toDouble))
+      }
+    }
+
+    // Verify accuracy and bounded memory for large samples.
+    it("must estimate quantiles of large samples accurately, in bounded memory") {
+      val rng = new Random(1L)
+      val xs = IndexedSeq.fill(1000000)(-Math.log(1.0 - rng.nextDouble()))
+      val sketch = sketchOf(xs)
+      assert(sketch.size === xs.size.toLong)
+      assert(sketch.retained <= 4 * sketch.accuracy)
+      assertAccurate(sketch, xs)
+      val median = sketch.quantile(0.5).get
+      assert(sketch.rank(median).exists(r => Math.abs(r - 0.5) <= RankTolerance))
+    }
+
+    // Verify that the sketch is insensitive to the order of the observations.
+    it("must estimate quantiles of sorted samples accurately") {
+      val xs = (1 to 200000).map(_.toDouble)
+      assertAccurate(sketchOf(xs), xs)
+      assertAccurate(sketchOf(xs.reverse), xs)
+    }
+
+    // Verify that merged sketches remain accurate.
+    it("must merge sketches accurately") {
+      val rng = new Random(2L)
+      val parts = IndexedSeq.fill(8)(IndexedSeq.fill(50000)(rng.nextGaussian()))
+      val merged = new QuantileSketch
+      parts.foreach(xs => merged.merge(sketchOf(xs)))
+      val all = parts.flatten
+      assert(merged.size === all.size.toLong)
+      assert(merged.retained <= 4 * merged.accuracy)
+      assertAccurate(merged, all)
+    }
+
+    // Verify that sketches are reproducible.
+    it("must be deterministic") {
+      val rng = new Random(3L)
+      val xs = IndexedSeq.fill(100000)(rng.nextDouble())
+      val a = sketchOf(xs)
+      val b = sketchOf(xs)
+      assert(probabilities.map(a.quantile) === probabilities.map(b.quantile))
+    }
+
+    // Verify reset.
+    it("must reset to an empty sketch with the same accuracy") {
+      val r = sketchOf(Seq(1.0, 2.0), 50).reset
+      assert(r.size === 0L)
+      assert(r.accuracy === 50)
+    }
+  }
+
+  // Verify that quantiles are named and symbolized using the common statistic nomenclature.
+  describe("Quantile nomenclature") {
+    it("must name quantiles using the sample quantile name") {
+      val name = new QuantileSketch().quantileName(0.95)
+      assert(name.startsWith(Names.SampleQuantile))
+      assert(name.contains("95"))
+    }
+    it("must symbolize quantiles using the sample quantile symbol") {
+      val symbol = new QuantileSketch().quantileSymbol(0.5)
+      assert(symbol.startsWith(s"${Symbols.SampleQuantile}("))
+      assert(symbol.contains("5"))
+    }
+    it("must reject invalid probabilities") {
+      assertThrows[IllegalArgumentException](new QuantileSketch().quantileName(0.0))
+      assertThrows[IllegalArgumentException](new QuantileSketch().quantileSymbol(1.5))
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -0,0 +1,200 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.stat.test package.
+//======================================================================================================================
+package org.facsim.stat.test
+
+import org.facsim.stat.{MutableSummaryStatistics, SummaryStatistics}
+import org.scalacheck.Gen
+import org.scalatest.funspec.AnyFunSpec
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[SummaryStatistics]] and [[MutableSummaryStatistics]] classes. */
+final class SummaryStatisticsTest
+extends AnyFunSpec
+with ScalaCheckPropertyChecks {
+
+  /** Generator for lists of observations. */
+  private val observations = Gen.listOf(Gen.choose(-1.0e3, 1.0e3))
+
+  /** Tolerance used for comparing results that are subject to rounding error. */
+  private val Tolerance = 1.0e-6
+
+  /** Determine whether two values are approximately equal. */
+  private def near(a: Double, b: Double): Boolean = Math.abs(a - b) <= Tolerance * Math.max(1.0, Math.abs(b))
+
+  /** Determine whether two summaries are approximately equal. */
+  private def near(a: SummaryStatistics, b: SummaryStatistics): Boolean = {
+    a.size == b.size && near(a.mean, b.mean) && near(a.m2, b.m2) && a.minimum == b.minimum && a.maximum == b.maximum
+  }
+
+  // Test the summary statistics class.
+  describe(classOf[SummaryStatistics].getCanonicalName) {
+
+    // Verify the empty summary.
+    describe("Empty") {
+      it("must summarize no observations") {
+        val s = SummaryStatistics.Empty
+        assert(s.isEmpty)
+        assert(s.size === 0L)
+        assert(s.sum === 0.0)
+        assert(s.variance === None)
+        assert(s.stdDeviation === None)
+      }
+    }
+
+    // Verify the addition of observations.
+    describe(".add(Double)") {
+
+      // Verify that non-finite observations are rejected.
+      it("must reject non-finite observations") {
+        assertThrows[IllegalArgumentException](SummaryStatistics.Empty.add(Double.NaN))
+        assertThrows[IllegalArgumentException](SummaryStatistics.Empty.add(Double.PositiveInfinity))
+      }
+
+      // Verify a known example.
+      it("must report the correct statistics for a known sample") {
+        val s = Seq(2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0).foldLeft(SummaryStatistics.Empty)(_.add(_))
+        assert(s.size === 8L)
+        assert(s.mean === 5.0)
+        assert(s.sum === 40.0)
+        assert(s.minimum === 2.0)
+        assert(s.maximum === 9.0)
+        assert(s.variance.exists(v => near(v, 32.0 / 7.0)))
+        assert(s.stdDeviation.exists(sd => near(sd, Math.sqrt(32.0 / 7.0))))
+      }
+
+      // Verify agreement with a conventional, two-pass calculation.
+      it("must agree with a two-pass calculation") {
+        forAll(observations.suchThat(_.size > 1)) {xs =>
+          val s = xs.foldLeft(SummaryStatistics.Empty)(_.add(_))
+          val mean = xs.sum / xs.size.toDouble
+          val variance = xs.map(x => (x - mean) * (x - mean)).sum / (xs.size - 1).toDouble
+          assert(s.size === xs.size.toLong)
+          assert(near(s.mean, mean))
+          assert(s.variance.exists(v => near(v, variance)))
+          assert(s.minimum === xs.min)
+          assert(s.maximum === xs.max)
+        }
+      }
+
+      // Verify that the variance is unaffected by a constant offset, which would otherwise cause cancellation errors.
+      it("must be numerically stable") {
+        forAll(Gen.listOf(Gen.choose(-1.0, 1.0)).suchThat(_.size > 1)) {xs =>
+          val s = SummaryStatistics(xs)
+          val offset = SummaryStatistics(xs.map(_ + 1.0e9))
+          assert(Math.abs(offset.mean - 1.0e9 - s.mean) < 1.0e-5)
+          assert(Math.abs(offset.variance.get - s.variance.get) < 1.0e-5)
+        }
+      }
+    }
+
+    // Verify the merging of summaries.
+    describe(".merge(SummaryStatistics)") {
+
+      // Verify that the empty summary is the identity.
+      it("must have the empty summary as its identity") {
+        forAll(observations) {xs =>
+          val s = SummaryStatistics(xs)
+          assert(s.merge(SummaryStatistics.Empty) === s)
+          assert(SummaryStatistics.Empty.merge(s) === s)
+        }
+      }
+
+      // Verify that merging partial summaries is equivalent to summarizing all observations.
+      it("must be equivalent to summarizing all observations") {
+        forAll(observations, observations) {(xs, ys) =>
+          assert(near(SummaryStatistics(xs).merge(SummaryStatistics(ys)), SummaryStatistics(xs ++ ys)))
+        }
+      }
+
+      // Verify that merging is associative.
+      it("must be associative") {
+        forAll(observations, observations, observations) {(xs, ys, zs) =>
+          val (a, b, c) = (SummaryStatistics(xs), SummaryStatistics(ys), SummaryStatistics(zs))
+          assert(near(a.merge(b).merge(c), a.merge(b.merge(c))))
+        }
+      }
+    }
+  }
+
+  // Test the mutable summary statistics class.
+  describe(classOf[MutableSummaryStatistics].getCanonicalName) {
+
+    // Verify that the mutable accumulator agrees with the immutable summary.
+    it("must agree with the immutable summary") {
+      forAll(observations) {xs =>
+        val acc = new MutableSummaryStatistics
+        xs.foreach(acc.add)
+        assert(acc.size === xs.size.toLong)
+        assert(acc.result === xs.foldLeft(SummaryStatistics.Empty)(_.add(_)))
+      }
+    }
+
+    // Verify that results are unaffected by subsequent observations.
+    it("must return results that are unaffected by subsequent observations") {
+      val acc = new MutableSummaryStatistics
+      acc.add(1.0)
+      val r = acc.result
+      acc.add(2.0)
+      assert(r.size === 1L)
+      assert(acc.result.size === 2L)
+    }
+
+    // Verify merging and clearing.
+    it("must merge and clear correctly") {
+      forAll(observations, observations) {(xs, ys) =>
+        val acc = new MutableSummaryStatistics
+        xs.foreach(acc.add)
+        acc.merge(SummaryStatistics(ys))
+        assert(near(acc.result, SummaryStatistics(xs ++ ys)))
+        acc.clear()
+        assert(acc.result === SummaryStatistics.Empty)
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
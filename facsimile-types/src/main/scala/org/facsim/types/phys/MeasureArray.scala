@@ -0,0 +1,169 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.types.phys types.
+//======================================================================================================================
+package org.facsim.types.phys
+
+import org.facsim.util.requireValid
+import scala.annotation.tailrec
+
+/** Columnar array of unchecked measurements of a physical quantity, stored as primitive values.
+ *
+ *  Measurement arrays store the ''[[http://en.wikipedia.org/wiki/SI SI]]'' unit values of a large number of
+ *  `[[org.facsim.types.phys.Quantity Quantity]]` instances in a single primitive array, so that bulk operations
+ *  (kinematic updates, unit conversions, aggregation, etc.) run without boxing. As with quantities, the physical
+ *  quantity family `P` is tracked by the compiler only, and results are not validated until they are converted back
+ *  into measurements by the `[[org.facsim.types.phys.Physical.measure(array* measure]]` function of the family.
+ *
+ *  Arrays are created by the `[[org.facsim.types.phys.Physical.newArray newArray]]` and
+ *  `[[org.facsim.types.phys.Physical.importArray importArray]]` functions of a physical quantity family.
+ *
+ *  @note Measurement arrays are mutable, and are not thread-safe.
+ *
+ *  @tparam P Singleton type of the physical quantity family to which the stored measurements belong, such as
+ *  `Length.type`.
+ *
+ *  @constructor Create a new measurement array. Measurement arrays can only be created by their physical quantity
+ *  family.
+ *
+ *  @param si Values of the measurements expressed in the family's ''SI'' units.
+ *
+ *  @since 0.3
+ */
+final class MeasureArray[P <: Physical] private[phys](private[phys] val si: Array[Double]) {
+
+  /** Number of measurements stored in this array.
+   *
+   *  @since 0.3
+   */
+  val length: Int = si.length
+
+  /** Retrieve a measurement.
+   *
+   *  @param i Index of the measurement to be retrieved.
+   *
+   *  @return Measurement at index `i`.
+   *
+   *  @throws scala.ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def apply(i: Int): Quantity[P] = new Quantity[P](si(i))
+
+  /** Replace a measurement.
+   *
+   *  @param i Index of the measurement to be replaced.
+   *
+   *  @param q New measurement to be stored at index `i`.
+   *
+   *  @throws scala.ArrayIndexOutOfBoundsException if `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  def update(i: Int, q: Quantity[P]): Unit = si(i) = q.si
+
+  /** Set every measurement to the same value.
+   *
+   *  @param q Value to which every measurement is set.
+   *
+   *  @since 0.3
+   */
+  def fill(q: Quantity[P]): Unit = java.util.Arrays.fill(si, q.si)
+
+  /** Scale every measurement in place.
+   *
+   *  @param factor Factor by which every measurement is multiplied.
+   *
+   *  @since 0.3
+   */
+  def scale(factor: Double): Unit = {
+    @tailrec
+    def loop(i: Int): Unit = {
+      if(i < length) {
+        si(i) *= factor
+        loop(i + 1)
+      }
+    }
+    loop(0)
+  }
+
+  /** Add a scaled array of measurements to this array, in place.
+   *
+   *  This is the fundamental operation of an explicit kinematic update: for example, a column of positions can be
+   *  advanced by adding a column of displacements scaled by a time step.
+   *
+   *  @param that Measurements to be added to the corresponding measurements of this array.
+   *
+   *  @param factor Factor by which the measurements of `that` array are multiplied before being added.
+   *
+   *  @throws scala.IllegalArgumentException if `that` array does not have the same length as this array.
+   *
+   *  @since 0.3
+   */
+  def addScaled(that: MeasureArray[P], factor: Double): Unit = {
+    requireValid(that, that.length == length)
+    @tailrec
+    def loop(i: Int): Unit = {
+      if(i < length) {
+        si(i) += that.si(i) * factor
+        loop(i + 1)
+      }
+    }
+    loop(0)
+  }
+
+  /** Report the sum of the measurements in this array.
+   *
+   *  @return Sum of the measurements, or zero if the array is empty.
+   *
+   *  @since 0.3
+   */
+  def sum: Quantity[P] = {
+    @tailrec
+    def loop(i: Int, total: Double): Double = {
+      if(i < length) loop(i + 1, total + si(i))
+      else total
+    }
+    new Quantity[P](loop(0, 0.0))
+  }
+
+  /** Create a copy of this array.
+   *
+   *  @return Independent copy of this measurement array.
+   *
+   *  @since 0.3
+   */
+  def copy: MeasureArray[P] = new MeasureArray[P](si.clone())
+}
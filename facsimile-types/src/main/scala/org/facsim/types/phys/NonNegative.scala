@@ -62,6 +62,9 @@ extends Specific {
   /** @inheritdoc */
   override type Units <: NonNegativeUnits
 
+  /** @inheritdoc */
+  protected[phys] override def isValid(value: Double): Boolean = value >= 0.0 && super.isValid(value)
+
   /** Abstract base class for physical quantity measurements that cannot be negative.
    *
    *  @tparam F Final measurement type.
@@ -37,7 +37,7 @@
 package org.facsim.types.phys
 
 import org.facsim.types.algebra.AdditiveTypedSemigroup
-import org.facsim.util.requireFinite
+import org.facsim.util.{requireFinite, requireValid}
 import scala.util.Try
 import spire.algebra.Order
 
@@ -144,6 +144,103 @@ abstract class Physical {
   // Developer note: This must NOT throw an exception for any measurement family.
   final lazy val Zero: Measure = newMeasure(0.0)
 
+  /** Determine whether a value, expressed in this physical quantity's ''[[http://en.wikipedia.org/wiki/SI SI]]
+   *  units'', is a valid measurement.
+   *
+   *  @note This function must agree with the validation performed by `[[newMeasure]]`; it allows bulk data to be
+   *  validated without creating a measurement for each value.
+   *
+   *  @param value Value of the measurement expressed in ''SI'' units.
+   *
+   *  @return `true` if `value` is a valid measurement of this physical quantity; `false` otherwise.
+   */
+  protected[phys] def isValid(value: Double): Boolean = !value.isNaN && !value.isInfinite
+
+  /** Create an unchecked, unboxed quantity from a measurement of this physical quantity.
+   *
+   *  @param measure Measurement to be converted. Since the measurement was validated upon its creation, the resulting
+   *  quantity is valid too.
+   *
+   *  @return Quantity having the same value as `measure`.
+   *
+   *  @since 0.3
+   */
+  final def quantity(measure: Measure): Quantity[this.type] = new Quantity[this.type](measure.value)
+
+  /** Validate an unchecked quantity of this physical quantity, converting it into a measurement.
+   *
+   *  @param q Quantity to be converted, typically the result of a calculation.
+   *
+   *  @return A measurement with the same value as `q`, wrapped in a `[[scala.util.Success Success]]` if successful, or
+   *  a `[[scala.util.Failure Failure]]` wrapping a failure exception in the event that the value of `q` is invalid.
+   *
+   *  @since 0.3
+   */
+  final def measure(q: Quantity[this.type]): Try[Measure] = apply(q.si)
+
+  /** Validate an element of an unchecked measurement array of this physical quantity, converting it into a
+   *  measurement.
+   *
+   *  @param array Measurement array containing the element to be converted.
+   *
+   *  @param i Index of the element to be converted.
+   *
+   *  @return A measurement with the same value as the element, wrapped in a `[[scala.util.Success Success]]` if
+   *  successful, or a `[[scala.util.Failure Failure]]` wrapping a failure exception in the event that the element's
+   *  value is invalid, or that `i` is not a valid index.
+   *
+   *  @since 0.3
+   */
+  final def measure(array: MeasureArray[this.type], i: Int): Try[Measure] = Try(array.si(i)).flatMap(apply)
+
+  /** Create a new measurement array for this physical quantity, with every element initialized to zero.
+   *
+   *  @param length Number of measurements to be stored in the array.
+   *
+   *  @return Measurement array of the specified `length`.
+   *
+   *  @throws scala.NegativeArraySizeException if `length` is negative.
+   *
+   *  @since 0.3
+   */
+  final def newArray(length: Int): MeasureArray[this.type] = new MeasureArray[this.type](new Array[Double](length))
+
+  /** Create a new measurement array for this physical quantity, from values expressed in the specified units.
+   *
+   *  Each value is converted into ''[[http://en.wikipedia.org/wiki/SI SI]] units'' and validated, without creating a
+   *  measurement for each value.
+   *
+   *  @param values Values of the measurements, expressed in `units`.
+   *
+   *  @param units Units in which `values` are expressed.
+   *
+   *  @return Measurement array containing the converted values, wrapped in a `[[scala.util.Success Success]]` if
+   *  successful, or a `[[scala.util.Failure Failure]]` wrapping an `[[scala.IllegalArgumentException
+   *  IllegalArgumentException]]` if any of the converted values is invalid.
+   *
+   *  @since 0.3
+   */
+  final def importArray(values: Array[Double], units: Units): Try[MeasureArray[this.type]] = Try {
+    val converted = values.map(units.importValue)
+    requireValid(values, converted.forall(isValid))
+    new MeasureArray[this.type](converted)
+  }
+
+  /** Export the measurements of a measurement array of this physical quantity, expressed in the specified units.
+   *
+   *  @note This function is intended to support bulk output of measurements, such as to animation or reporting
+   *  systems. As for measurements, the raw values should not be used to by-pass the unit protection logic.
+   *
+   *  @param array Measurement array to be exported.
+   *
+   *  @param units Units in which the exported values are to be expressed.
+   *
+   *  @return Values of the measurements in `array`, expressed in `units`.
+   *
+   *  @since 0.3
+   */
+  final def exportArray(array: MeasureArray[this.type], units: Units): Array[Double] = array.si.map(units.exportValue)
+
   /** Ordering for physical measurements.
    *
    *  Supports comparison operators for physical quantity measurements.
@@ -0,0 +1,204 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.types.phys types.
+//======================================================================================================================
+package org.facsim.types.phys
+
+/** Unchecked, unboxed measurement of a physical quantity, for use in performance-critical calculations.
+ *
+ *  Quantities are value classes wrapping a measurement expressed in the ''[[http://en.wikipedia.org/wiki/SI SI]]''
+ *  units of the physical quantity family `P`. The family is tracked by the compiler only, so that&mdash;unlike
+ *  `[[org.facsim.types.phys.Physical.PhysicalMeasure PhysicalMeasure]]` instances&mdash;quantities are not allocated
+ *  on the heap (except when stored in generic collections) and arithmetic upon them neither allocates nor validates its
+ *  results. Measurements from different families cannot be combined, since their quantity types differ.
+ *
+ *  Quantities are intended for use in inner loops, such as the kinematic updates of a large number of conveyor
+ *  segments. A quantity is created from a measurement that was validated upon its own creation, by the family's
+ *  `[[org.facsim.types.phys.Physical.quantity quantity]]` function, and the result of a calculation is validated once,
+ *  upon conversion back into a measurement, by the family's `[[org.facsim.types.phys.Physical.measure measure]]`
+ *  function.
+ *
+ *  @note As with measurements, the raw values of quantities are not available to user code.
+ *
+ *  @tparam P Singleton type of the physical quantity family to which this quantity belongs, such as `Length.type`.
+ *
+ *  @constructor Create a new quantity. Quantities can only be created by their physical quantity family.
+ *
+ *  @param si Value of the quantity expressed in the family's ''SI'' units.
+ *
+ *  @since 0.3
+ */
+final class Quantity[P <: Physical] private[phys](private[phys] val si: Double)
+extends AnyVal {
+
+  /** Add a quantity of the same family to this quantity.
+   *
+   *  @param that Quantity to be added.
+   *
+   *  @return Sum of the two quantities.
+   *
+   *  @since 0.3
+   */
+  def +(that: Quantity[P]): Quantity[P] = new Quantity[P](si + that.si)
+
+  /** Subtract a quantity of the same family from this quantity.
+   *
+   *  @param that Quantity to be subtracted.
+   *
+   *  @return Difference between the two quantities.
+   *
+   *  @since 0.3
+   */
+  def -(that: Quantity[P]): Quantity[P] = new Quantity[P](si - that.si)
+
+  /** Change the sign of this quantity.
+   *
+   *  @return Quantity having a sign opposite that of this quantity.
+   *
+   *  @since 0.3
+   */
+  def unary_- : Quantity[P] = new Quantity[P](-si) //scalastyle:ignore disallow.space.before.token
+
+  /** Scale this quantity.
+   *
+   *  @param factor Factor by which this quantity is to be multiplied.
+   *
+   *  @return Scaled quantity.
+   *
+   *  @since 0.3
+   */
+  def *(factor: Double): Quantity[P] = new Quantity[P](si * factor)
+
+  /** Divide this quantity by a constant.
+   *
+   *  @param divisor Value by which this quantity is to be divided.
+   *
+   *  @return Divided quantity.
+   *
+   *  @since 0.3
+   */
+  def /(divisor: Double): Quantity[P] = new Quantity[P](si / divisor)
+
+  /** Report the ratio of this quantity to another quantity of the same family.
+   *
+   *  @param that Quantity by which this quantity is to be divided.
+   *
+   *  @return Dimensionless ratio of this quantity to `that` quantity.
+   *
+   *  @since 0.3
+   */
+  def /(that: Quantity[P]): Double = si / that.si
+
+  /** Report the absolute value of this quantity.
+   *
+   *  @note As for measurements, the absolute value is based upon the quantity expressed in ''SI'' units.
+   *
+   *  @return Absolute value of this quantity.
+   *
+   *  @since 0.3
+   */
+  def abs: Quantity[P] = new Quantity[P](Math.abs(si))
+
+  /** Report the smaller of this quantity and another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return The smaller of the two quantities.
+   *
+   *  @since 0.3
+   */
+  def min(that: Quantity[P]): Quantity[P] = if(si <= that.si) this else that
+
+  /** Report the larger of this quantity and another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return The larger of the two quantities.
+   *
+   *  @since 0.3
+   */
+  def max(that: Quantity[P]): Quantity[P] = if(si >= that.si) this else that
+
+  /** Compare this quantity to another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return A negative value if this quantity is less than `that` quantity, zero if they are equal, or a positive
+   *  value if this quantity is greater than `that` quantity.
+   *
+   *  @since 0.3
+   */
+  def compare(that: Quantity[P]): Int = java.lang.Double.compare(si, that.si)
+
+  /** Determine whether this quantity is less than another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return `true` if this quantity is less than `that` quantity; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def <(that: Quantity[P]): Boolean = si < that.si
+
+  /** Determine whether this quantity is less than, or equal to, another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return `true` if this quantity is less than or equal to `that` quantity; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def <=(that: Quantity[P]): Boolean = si <= that.si
+
+  /** Determine whether this quantity is greater than another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return `true` if this quantity is greater than `that` quantity; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def >(that: Quantity[P]): Boolean = si > that.si
+
+  /** Determine whether this quantity is greater than, or equal to, another quantity of the same family.
+   *
+   *  @param that Quantity being compared.
+   *
+   *  @return `true` if this quantity is greater than or equal to `that` quantity; `false` otherwise.
+   *
+   *  @since 0.3
+   */
+  def >=(that: Quantity[P]): Boolean = si >= that.si
+}
@@ -0,0 +1,130 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.types.phys.test types.
+//======================================================================================================================
+package org.facsim.types.phys.test
+
+import org.facsim.types.phys.{Length, Time}
+import org.scalatest.FunSpec
+
+//scalastyle:off scaladoc
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+/** Test suite for the [[org.facsim.types.phys.Quantity]] and [[org.facsim.types.phys.MeasureArray]] classes. */
+class QuantityTest
+extends FunSpec {
+
+  /** Test data. */
+  trait TestData {
+    val one = Length.quantity(Length(1.0, Length.Meters).get)
+    val two = Length.quantity(Length(2.0, Length.Meters).get)
+    val second = Time.quantity(Time(1.0, Time.Seconds).get)
+  }
+
+  // Quantity test fixture description.
+  describe("org.facsim.types.phys.Quantity") {
+
+    // Verify unchecked arithmetic.
+    describe("arithmetic") {
+      it("must add, subtract, scale and compare quantities of the same family") {
+        new TestData {
+          assert(one + one === two)
+          assert(two - one === one)
+          assert(one * 2.0 === two)
+          assert(two / 2.0 === one)
+          assert(two / one === 2.0)
+          assert((-one).abs === one)
+          assert(one < two && two > one && one <= one && one >= one)
+          assert((one min two) === one && (one max two) === two)
+        }
+      }
+    }
+
+    // Verify that results are validated upon conversion back into measurements.
+    describe(".measure(Quantity)") {
+      it("must convert a valid quantity into an equal measurement") {
+        new TestData {
+          assert(Length.measure(one + one) === Length(2.0, Length.Meters))
+        }
+      }
+      it("must fail to convert an invalid quantity") {
+        new TestData {
+          assert(Time.measure(-second).isFailure)
+        }
+      }
+    }
+  }
+
+  // MeasureArray test fixture description.
+  describe("org.facsim.types.phys.MeasureArray") {
+
+    // Verify bulk import and export.
+    describe(".importArray(Array[Double], Units)") {
+      it("must convert values to and from the specified units") {
+        val a = Length.importArray(Array(1.0, 2.0, 3.0), Length.Kilometers).get
+        assert(a.length === 3)
+        assert(Length.measure(a, 1) === Length(2000.0, Length.Meters))
+        assert(Length.exportArray(a, Length.Meters).toList === List(1000.0, 2000.0, 3000.0))
+      }
+      it("must fail if any value is invalid") {
+        assert(Length.importArray(Array(1.0, Double.NaN), Length.Meters).isFailure)
+        assert(Time.importArray(Array(1.0, -1.0), Time.Seconds).isFailure)
+      }
+    }
+
+    // Verify bulk kinematic operations.
+    describe(".addScaled(MeasureArray, Double)") {
+      it("must add a scaled array to each element") {
+        new TestData {
+          val positions = Length.newArray(4)
+          val displacements = Length.newArray(4)
+          displacements.fill(two)
+          positions.addScaled(displacements, 0.5)
+          assert((0 until 4).forall(i => positions(i) === one))
+          positions.scale(2.0)
+          assert(positions.sum === two * 4.0)
+        }
+      }
+      it("must throw an IllegalArgumentException if the arrays have different lengths") {
+        intercept[IllegalArgumentException] {
+          Length.newArray(2).addScaled(Length.newArray(3), 1.0)
+        }
+      }
+    }
+  }
+}
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on scaladoc
@@ -36,9 +36,23 @@
 //======================================================================================================================
 package org.facsim.util
 
-import scala.collection.mutable.Map
+import java.util.concurrent.atomic.{AtomicBoolean, LongAdder}
+import java.util.concurrent.{ConcurrentHashMap, ConcurrentLinkedQueue}
+import scala.annotation.tailrec
 
 /** Base class for ''pure function memoization'' classes.
+ *
+ *  Memoized functions may safely be called concurrently from multiple threads. Cached results are held in a concurrent
+ *  map, so that looking up a previously cached result requires no locking. The first call with a given argument value
+ *  evaluates the function exactly once; concurrent calls with the same argument wait for that evaluation to complete,
+ *  but calls with other argument values are unaffected.
+ *
+ *  If a capacity is specified, then the number of cached results is bounded: when the capacity is exceeded, results
+ *  are evicted using the ''CLOCK'' (or ''second chance'') algorithm, which approximates ''least-recently used''
+ *  (''LRU'') eviction without requiring cache hits to update a shared structure. Evicted results are re-evaluated if
+ *  required again.
+ *
+ *  Argument values cannot be `null`.
  *
  *  @tparam A Types of argument values (as ''tuples'', for multiple argument classes) passed to function `f`.
  *
@@ -46,24 +60,148 @@ import scala.collection.mutable.Map
  *
  *  @param f Function to be ''memoized''.
  *
+ *  @param capacity Maximum number of results to be cached, which must be positive. If this is
+ *  `[[Memoize.Unbounded]]`, then all results are cached, and the cache is never evicted.
+ *
+ *  @throws IllegalArgumentException if `capacity` is not positive.
+ *
  *  @since 0.0
  */
-sealed abstract class Memoize[A, R] private(f: A => R) {
+sealed abstract class Memoize[A, R] private(f: A => R, capacity: Int) {
+  requireValidFn[Int](capacity, _ > 0, "capacity")
+
+  /** Cached result of the function for an argument value.
+   *
+   *  @param a Argument value to be passed to the function.
+   */
+  private final class Entry(a: A) {
+
+    /** Result of the function, which is evaluated, once only, when first required. */
+    lazy val result: R = f(a)
+
+    /** Flag indicating whether this entry has been referenced since it was last considered for eviction. */
+    @volatile var referenced: Boolean = false //scalastyle:ignore var.field
+  }
+
+  /** Flag indicating whether the number of cached results is bounded. */
+  private final val bounded = capacity != Memoize.Unbounded
 
   /** Map of argument values to results. */
-  private final val results = Map.empty[A, R]
+  private final val results = new ConcurrentHashMap[A, Entry]()
+
+  /** Argument values of cached results in the order that they will be considered for eviction.
+   *
+   *  This is only maintained if the number of cached results is bounded.
+   */
+  private final val order = new ConcurrentLinkedQueue[A]()
+
+  /** Flag indicating whether a thread is currently evicting results. */
+  private final val evicting = new AtomicBoolean(false)
+
+  /** Number of evaluations whose results were retrieved from the cache. */
+  private final val hitCount = new LongAdder()
+
+  /** Number of evaluations that required the function to be executed. */
+  private final val missCount = new LongAdder()
+
+  /** Number of cache hits.
+   *
+   *  @return Number of evaluations whose results were retrieved from the cache.
+   *
+   *  @since 0.3
+   */
+  final def hits: Long = hitCount.sum()
+
+  /** Number of cache misses.
+   *
+   *  @return Number of evaluations that required the function to be executed.
+   *
+   *  @since 0.3
+   */
+  final def misses: Long = missCount.sum()
+
+  /** Number of cached results.
+   *
+   *  @return Number of results that are currently cached. This may briefly exceed the capacity while results are being
+   *  evicted.
+   *
+   *  @since 0.3
+   */
+  final def size: Long = results.mappingCount()
 
   /** Evaluate the function.
    *
    *  @note If the function has not been called previously, then it is executed and the result cached; otherwise, the
    *  previously cached result is returned instead. Note that if the function has any ''side-effects'', that they will
-   *  only occur for the first evaluation.
+   *  only occur for the first evaluation (or, if the number of cached results is bounded, the first evaluation since
+   *  the result was last evicted).
    *
    *  @param a Argument to be passed to the function.
    *
    *  @return Result of `f(a)`.
    */
-  protected final def eval(a: A): R = synchronized(results.getOrElseUpdate(a, f(a)))
+  protected final def eval(a: A): R = {
+    val cached = results.get(a)
+    if(cached ne null) hit(cached) //scalastyle:ignore null
+    else {
+      val entry = new Entry(a)
+      val prior = results.putIfAbsent(a, entry)
+      if(prior ne null) hit(prior) //scalastyle:ignore null
+      else {
+        missCount.increment()
+        if(bounded) {
+          val _ = order.offer(a)
+          evict()
+        }
+        entry.result
+      }
+    }
+  }
+
+  /** Retrieve a cached result.
+   *
+   *  @param entry Entry holding the cached result.
+   *
+   *  @return Cached result, which may still be being evaluated by another thread.
+   */
+  private final def hit(entry: Entry): R = {
+    hitCount.increment()
+    if(bounded && !entry.referenced) entry.referenced = true
+    entry.result
+  }
+
+  /** Evict cached results until the capacity is no longer exceeded.
+   *
+   *  Only one thread evicts results at a time; other threads that exceed the capacity while eviction is in progress
+   *  leave their surplus results to the evicting thread.
+   */
+  private final def evict(): Unit = {
+
+    // Consider the next argument value for eviction. If it has been referenced since it was last considered, then give
+    // it a second chance.
+    @tailrec
+    def sweep(): Unit = {
+      if(results.mappingCount() > capacity) {
+        val a = order.poll()
+        if(a != null) { //scalastyle:ignore null
+          val entry = results.get(a)
+          if(entry.referenced) {
+            entry.referenced = false
+            val _ = order.offer(a)
+          }
+          else {
+            val _ = results.remove(a, entry)
+          }
+          sweep()
+        }
+      }
+    }
+
+    if(results.mappingCount() > capacity && evicting.compareAndSet(false, true)) {
+      try sweep()
+      finally evicting.set(false)
+    }
+  }
 }
 
 /** Memoization companion.
@@ -72,6 +210,12 @@ sealed abstract class Memoize[A, R] private(f: A => R) {
  */
 object Memoize {
 
+  /** Capacity of memoized functions that cache all of their results.
+   *
+   *  @since 0.3
+   */
+  val Unbounded: Int = Int.MaxValue
+
   /** Single-argument ''pure function memoization'' class.
    *
    *  @tparam A Type of argument values passed to function `f`.
@@ -82,10 +226,13 @@ object Memoize {
    *
    *  @param f Function to be ''memoized''.
    *
+   *  @param capacity Maximum number of results to be cached, or `[[Memoize.Unbounded]]` if all results are to be
+   *  cached.
+   *
    *  @since 0.0
    */
-  final class Memoize1[A, R] private[Memoize](f: A => R)
-  extends Memoize[A, R](f)
+  final class Memoize1[A, R] private[Memoize](f: A => R, capacity: Int)
+  extends Memoize[A, R](f, capacity)
   with (A => R) {
 
     /** Evaluate ''memoized'' function.
@@ -111,10 +258,13 @@ object Memoize {
    *
    *  @param f Function to be ''memoized''.
    *
+   *  @param capacity Maximum number of results to be cached, or `[[Memoize.Unbounded]]` if all results are to be
+   *  cached.
+   *
    *  @since 0.0
    */
-  final class Memoize2[A1, A2, R] private[Memoize](f: (A1, A2) => R)
-  extends Memoize[(A1, A2), R](f.tupled)
+  final class Memoize2[A1, A2, R] private[Memoize](f: (A1, A2) => R, capacity: Int)
+  extends Memoize[(A1, A2), R](f.tupled, capacity)
   with ((A1, A2) => R) {
 
     /** Evaluate ''memoized'' function.
@@ -144,10 +294,13 @@ object Memoize {
    *
    *  @param f Function to be ''memoized''.
    *
+   *  @param capacity Maximum number of results to be cached, or `[[Memoize.Unbounded]]` if all results are to be
+   *  cached.
+   *
    *  @since 0.0
    */
-  final class Memoize3[A1, A2, A3, R] private[Memoize](f: (A1, A2, A3) => R)
-  extends Memoize[(A1, A2, A3), R](f.tupled)
+  final class Memoize3[A1, A2, A3, R] private[Memoize](f: (A1, A2, A3) => R, capacity: Int)
+  extends Memoize[(A1, A2, A3), R](f.tupled, capacity)
   with ((A1, A2, A3) => R) {
 
     /** Evaluate ''memoized'' function.
@@ -177,7 +330,7 @@ object Memoize {
    *
    *  @since 0.0
    */
-  def apply[A, R](f: A => R): Memoize1[A, R] = new Memoize1[A, R](f)
+  def apply[A, R](f: A => R): Memoize1[A, R] = new Memoize1[A, R](f, Unbounded)
 
   /** Memoize a double-argument function.
    *
@@ -193,7 +346,7 @@ object Memoize {
    *
    *  @since 0.0
    */
-  def apply[A1, A2, R](f: (A1, A2) => R): Memoize2[A1, A2, R] = new Memoize2[A1, A2, R](f)
+  def apply[A1, A2, R](f: (A1, A2) => R): Memoize2[A1, A2, R] = new Memoize2[A1, A2, R](f, Unbounded)
 
   /** Memoize a triple-argument function.
    *
@@ -211,5 +364,67 @@ object Memoize {
    *
    *  @since 0.0
    */
-  def apply[A1, A2, A3, R](f: (A1, A2, A3) => R): Memoize3[A1, A2, A3, R] = new Memoize3[A1, A2, A3, R](f)
+  def apply[A1, A2, A3, R](f: (A1, A2, A3) => R): Memoize3[A1, A2, A3, R] = new Memoize3[A1, A2, A3, R](f, Unbounded)
+
+  /** Memoize a single-argument function, caching a bounded number of results.
+   *
+   *  @tparam A Type of argument passed to function `f`.
+   *
+   *  @tparam R Type of result returned by `f`.
+   *
+   *  @param f ''Pure function'' to be ''memoized''.
+   *
+   *  @param capacity Maximum number of results to be cached. This value must be positive.
+   *
+   *  @return Memoized version of `f`
+   *
+   *  @throws IllegalArgumentException if `capacity` is not positive.
+   *
+   *  @since 0.3
+   */
+  def apply[A, R](f: A => R, capacity: Int): Memoize1[A, R] = new Memoize1[A, R](f, capacity)
+
+  /** Memoize a double-argument function, caching a bounded number of results.
+   *
+   *  @tparam A1 Type of first argument passed to function `f`.
+   *
+   *  @tparam A2 Type of second argument passed to function `f`.
+   *
+   *  @tparam R Type of result returned by `f`.
+   *
+   *  @param f ''Pure function'' to be ''memoized''.
+   *
+   *  @param capacity Maximum number of results to be cached. This value must be positive.
+   *
+   *  @return Memoized version of `f`
+   *
+   *  @throws IllegalArgumentException if `capacity` is not positive.
+   *
+   *  @since 0.3
+   */
+  def apply[A1, A2, R](f: (A1, A2) => R, capacity: Int): Memoize2[A1, A2, R] = new Memoize2[A1, A2, R](f, capacity)
+
+  /** Memoize a triple-argument function, caching a bounded number of results.
+   *
+   *  @tparam A1 Type of first argument passed to function `f`.
+   *
+   *  @tparam A2 Type of second argument passed to function `f`.
+   *
+   *  @tparam A3 Type of third argument passed to function `f`.
+   *
+   *  @tparam R Type of result returned by `f`.
+   *
+   *  @param f ''Pure function'' to be ''memoized''.
+   *
+   *  @param capacity Maximum number of results to be cached. This value must be positive.
+   *
+   *  @return Memoized version of `f`
+   *
+   *  @throws IllegalArgumentException if `capacity` is not positive.
+   *
+   *  @since 0.3
+   */
+  def apply[A1, A2, A3, R](f: (A1, A2, A3) => R, capacity: Int): Memoize3[A1, A2, A3, R] = {
+    new Memoize3[A1, A2, A3, R](f, capacity)
+  }
 }
\ No newline at end of file
@@ -42,7 +42,6 @@ import akka.{Done, NotUsed}
 import org.facsim.util.stream.DataSource
 import org.facsim.util.NonPure
 import scala.concurrent.Future
-import scala.reflect.runtime.universe.TypeTag
 
 /** Create and manage a queued ''Akka'' source for issuing log messages.
  *
@@ -59,6 +58,9 @@ import scala.reflect.runtime.universe.TypeTag
  *  `[[org.facsim.util.stream.DataSource.MaxBufferSize MaxBufferSize]]`, or an `[[scala.IllegalArgumentException
  *  IllegalArgumentException]]` will be thrown.
  *
+ *  @param threshold Minimum severity of messages sent to the stream. Messages having a lower severity are discarded
+ *  before they are queued and, when logged lazily, before they are even created. By default, all messages are sent.
+ *
  *  @param materializer Stream materializer to be utilized when creating the stream.
  *
  *  @throws IllegalArgumentException if `bufferSize` is less than 1 or greater than `[[DataSource.MaxBufferSize
@@ -66,11 +68,25 @@ import scala.reflect.runtime.universe.TypeTag
  *
  *  @since 0.2
  */
-final class LogStream[A: TypeTag](bufferSize: Int = LogStream.defaultBufferSize)(implicit materializer: Materializer) {
+final class LogStream[A](bufferSize: Int = LogStream.defaultBufferSize,
+val threshold: Severity = DebugSeverity)(implicit materializer: Materializer) {
 
   /** Data source to be used for logging. */
   private val ds = new DataSource[LogMessage[A]](bufferSize)
 
+  /** Determine whether messages of the indicated severity are sent to the stream.
+   *
+   *  This function can be used to guard the construction of expensive messages on performance-critical paths.
+   *
+   *  @param severity Severity of a message.
+   *
+   *  @return `true` if messages of the indicated severity are at or above the stream's `threshold`, and will be sent
+   *  to the stream; `false` if they will be discarded.
+   *
+   *  @since 0.3
+   */
+  def isEnabled(severity: Severity): Boolean = severity >= threshold
+
   /** Send a message instance to the stream.
    *
    *  @note This operation will fail if the stream has been closed previously.
@@ -83,12 +99,62 @@ final class LogStream[A: TypeTag](bufferSize: Int = LogStream.defaultBufferSize)
    *  `[[akka.stream.QueueOfferResult.QueueClosed QueueClosed]]` if the queue was closed before the data could be
    *  processed. If the queue was closed before the data was sent, the result is a `[[scala.util.Failure Failure]]`
    *  wrapping an `[[akka.stream.StreamDetachedException StreamDetachedException]]`. If a failure closed the queue, it
-   *  will respond with a `Failure` wrapping the exception that signaled failure of the queue.
+   *  will respond with a `Failure` wrapping the exception that signaled failure of the queue. If the message's
+   *  severity is below the stream's `threshold`, the message is discarded and the result is `Dropped`.
    *
    *  @since 0.2
    */
   @NonPure
-  def log(message: LogMessage[A]): Future[QueueOfferResult] = ds.send(message)
+  def log(message: LogMessage[A]): Future[QueueOfferResult] = {
+    if(isEnabled(message.severity)) ds.send(message)
+    else LogStream.Filtered
+  }
+
+  /** Lazily create and send a message to the stream.
+   *
+   *  The severity of the message is checked against the stream's `threshold` first: the message's prefix and text are
+   *  evaluated, and the message is created, only if the message will be sent. Expensive message text&mdash;such as
+   *  that formatted from a `[[org.facsim.util.LibResource LibResource]]` with arguments&mdash;therefore costs nothing
+   *  to log at a disabled severity.
+   *
+   *  @note This operation will fail if the stream has been closed previously.
+   *
+   *  @param severity Severity of the message.
+   *
+   *  @param scope Scope of the message.
+   *
+   *  @param prefix Prefix for the message, evaluated only if the message is sent.
+   *
+   *  @param msg Message text, evaluated only if the message is sent.
+   *
+   *  @return Future containing the result of the message logging operation, as for `[[log(message:* log]]`.
+   *
+   *  @since 0.3
+   */
+  @NonPure
+  def log(severity: Severity, scope: Scope, prefix: => A)(msg: => String): Future[QueueOfferResult] = {
+    if(isEnabled(severity)) ds.send(LogMessage(prefix, msg, scope, severity))
+    else LogStream.Filtered
+  }
+
+  /** Send a batch of messages to the stream, without blocking the current thread.
+   *
+   *  Messages having a severity below the stream's `threshold` are discarded; the remainder are sent in order.
+   *
+   *  @note This operation will fail if the stream has been closed previously.
+   *
+   *  @param messages Messages to be sent to the stream.
+   *
+   *  @return Future containing `[[akka.stream.QueueOfferResult.Enqueued Enqueued]]` if all messages at or above the
+   *  threshold were queued, or the result of the first message that was not queued otherwise. Failures are reported as
+   *  for `[[log(message:* log]]`.
+   *
+   *  @since 0.3
+   */
+  @NonPure
+  def logAll(messages: Iterable[LogMessage[A]]): Future[QueueOfferResult] = {
+    ds.sendAll(messages.filter(m => isEnabled(m.severity)))
+  }
 
   /** Report the stream to which flows and sinks can be attached.
    *
@@ -119,4 +185,10 @@ object LogStream {
    *  @since 0.2
    */
   val defaultBufferSize: Int = 100
+
+  /** Result of logging a message whose severity is below a stream's threshold.
+   *
+   *  This is shared by all such messages, so that discarding a message allocates nothing.
+   */
+  private val Filtered: Future[QueueOfferResult] = Future.successful(QueueOfferResult.Dropped)
 }
\ No newline at end of file
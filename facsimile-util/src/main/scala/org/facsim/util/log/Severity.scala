@@ -37,8 +37,6 @@
 package org.facsim.util.log
 
 import org.facsim.util.LibResource
-import scala.reflect.runtime.currentMirror
-import scala.reflect.runtime.universe._
 
 /** Base trait for all log message severity classifications.
  *
@@ -218,36 +216,22 @@ extends Severity {
  */
 object Severity {
 
-  /** Set of all severity object classes.
+  /** Set of all severity objects.
+   *
+   *  @note Severities are registered explicitly, rather than discovered through runtime reflection, since initializing
+   *  the ''Scala'' reflection library significantly delays application startup. Each new severity object must be added
+   *  to this set.
    *
    *  @return Set of all severity objects.
    */
-  private val severities: Set[Severity] = {
-
-    // Get the symbol of the Severity trait. Since we cannot lookup direct known subclasses of a trait, we must then
-    // convert it to a class.
-    val cls = symbolOf[Severity].asClass
-
-    // Now lookup all known sub-class instances. This gives us a set of Symbol instances for the above defined
-    // subclasses of Severity. First, we must convert them to ClassSymbols. For safety, we then filter out any that are
-    // not Scala "object" types (termed modules in the reflection library: a ModuleClassSymbol stores the type of the
-    // Object as a subclass of ClassSymbol.)
-    //
-    // Next, we need to get the self type of the module class instance and convert this to a ModuleSymbol, which we
-    // obtain via the type's "termSymbol" method.
-    //
-    // Finally, we turn the resulting ModuleSymbols back into the actual case object value instances.
-    //
-    // Phew!
-    //
-    // For more on ClassSymbols, ModuleClassSymbols, ModuleSymbols, Symbols, TermSymbols and TypeSymbols, refer to:
-    //   https://docs.scala-lang.org/overviews/reflection/symbols-trees-types.html
-    cls.knownDirectSubclasses
-    .map(_.asClass)
-    .filter(_.isModuleClass)
-    .map(_.selfType.termSymbol.asModule)
-    .map(ms => currentMirror.reflectModule(ms).instance.asInstanceOf[Severity]) //scalastyle:ignore token
-  }
+  private val severities: Set[Severity] = Set(
+    DebugSeverity,
+    InformationSeverity,
+    WarningSeverity,
+    ImportantSeverity,
+    ErrorSeverity,
+    FatalSeverity
+  )
 
   /** Map of severity name to severity.
    *
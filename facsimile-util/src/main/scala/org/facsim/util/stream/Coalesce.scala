@@ -0,0 +1,79 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.util.stream package.
+//======================================================================================================================
+package org.facsim.util.stream
+
+import akka.NotUsed
+import akka.stream.scaladsl.Flow
+import scala.collection.immutable.VectorMap
+import scala.concurrent.duration.FiniteDuration
+
+/** Stream stages that coalesce frequently updated state.
+ *
+ *  @since 0.3
+ */
+object Coalesce {
+
+  /** Create a flow that emits, at most once per interval, the latest value of each distinct element received since the
+   *  previous emission.
+   *
+   *  This flow is intended for streams of state updates, such as the motion state of each animated object in a
+   *  simulation, where only the latest state of each object is of interest to a consumer (such as an animation) that
+   *  refreshes at a fixed frame rate. Updates received while the consumer is busy, or while waiting for the next frame,
+   *  are merged, so that the consumer does no more work than necessary, while the producer is never back pressured.
+   *
+   *  @tparam A Type of value flowing through the stream.
+   *
+   *  @tparam K Type of key identifying the element to which a value belongs.
+   *
+   *  @param key Function identifying the element to which a value belongs. Values having equal keys supersede each
+   *  other.
+   *
+   *  @param interval Minimum time between successive emissions, typically the frame interval of the consumer.
+   *
+   *  @return Flow emitting the latest value of each element updated since the previous emission. Values are emitted in
+   *  the order in which their elements were first updated since the previous emission. The first value received after
+   *  an idle period is emitted immediately.
+   *
+   *  @since 0.3
+   */
+  def latestPerKey[A, K](key: A => K, interval: FiniteDuration): Flow[A, Vector[A], NotUsed] = {
+    Flow[A]
+    .conflateWithSeed(a => VectorMap(key(a) -> a))((frame, a) => frame.updated(key(a), a))
+    .throttle(1, interval)
+    .map(_.values.toVector)
+  }
+}
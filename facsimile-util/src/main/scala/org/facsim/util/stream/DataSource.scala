@@ -40,9 +40,8 @@ import akka.stream.{Materializer, OverflowStrategy, QueueOfferResult}
 import akka.stream.scaladsl.Source
 import akka.{Done, NotUsed}
 import org.facsim.util.{LibResource, NonPure}
-import scala.concurrent.{Await, Future}
+import scala.concurrent.{Await, ExecutionContext, Future}
 import scala.concurrent.duration.Duration
-import scala.reflect.runtime.universe.TypeTag
 
 /** Create a new ''Akka Streams'' data source, to which data can be sent on demand.
  *
@@ -58,6 +57,10 @@ import scala.reflect.runtime.universe.TypeTag
  *  exerted. This value must be greater than zero and than `[[DataSource.MaxBufferSize MaxBufferSize]]`, or an
  *  `[[scala.IllegalArgumentException IllegalArgumentException]]` will be thrown.
  *
+ *  @param overflow Policy determining what happens when data is sent while the buffer is full. By default, the
+ *  `[[DataSource.Backpressure Backpressure]]` policy blocks the sending thread until the data can be queued; other
+ *  policies never block the sending thread.
+ *
  *  @param materializer Stream materializer to be utilized when creating the stream.
  *
  *  @throws IllegalArgumentException if `bufferSize` is less than 1 or greater than `[[DataSource.MaxBufferSize
@@ -65,14 +68,18 @@ import scala.reflect.runtime.universe.TypeTag
  *
  *  @since 0.2
  */
-final class DataSource[A: TypeTag](bufferSize: Int)(implicit materializer: Materializer) {
+final class DataSource[A](bufferSize: Int, overflow: DataSource.Overflow = DataSource.Backpressure)
+(implicit materializer: Materializer) {
 
   // Sanity check.
   require(bufferSize > 0 && bufferSize <= DataSource.MaxBufferSize,
   LibResource("stream.DataSourceInvalidBufferSize", bufferSize, DataSource.MaxBufferSize))
 
   /** Queue stream and source requested. */
-  private val streamSource = Source.queue[A](bufferSize, OverflowStrategy.backpressure).preMaterialize()
+  private val streamSource = Source.queue[A](bufferSize, overflow.strategy).preMaterialize()
+
+  /** Execution context used to chain the offers of batched data. */
+  private implicit val ec: ExecutionContext = materializer.executionContext
 
   /** Future resulting from the previous send operation.
    *
@@ -89,6 +96,10 @@ final class DataSource[A: TypeTag](bufferSize: Int)(implicit materializer: Mater
    *
    *  Data will not flow through the stream unless the stream is materialized and run.
    *
+   *  If this source has the `[[DataSource.Backpressure Backpressure]]` overflow policy, then the current thread is
+   *  blocked until all previously sent data has been queued. Otherwise, this function never blocks, and data that
+   *  cannot be buffered is handled according to the overflow policy.
+   *
    *  @param data Data to be sent to the stream.
    *
    *  @return Future containing the result of the data queuing operation. If successful, the result can be
@@ -105,11 +116,14 @@ final class DataSource[A: TypeTag](bufferSize: Int)(implicit materializer: Mater
   def send(data: A): Future[QueueOfferResult] = synchronized {
 
     // If the previous future did not complete, then wait for it to do so. If the future has already completed, then no
-    // time should elapse.
+    // time should elapse. This is only necessary when exerting back pressure: the queue accepts further offers
+    // immediately under all other overflow policies.
     //
     // Note: This can lock the current thread, should nothing be consuming the messages
-    Await.result(lastSendFuture, Duration.Inf)
-    assert(lastSendFuture.isCompleted, "Last data future did not complete.")
+    if(overflow.blocking) {
+      Await.result(lastSendFuture, Duration.Inf)
+      assert(lastSendFuture.isCompleted, "Last data future did not complete.")
+    }
 
     // Send the data, receiving a new future in the process.
     lastSendFuture = streamSource._1.offer(data)
@@ -118,13 +132,60 @@ final class DataSource[A: TypeTag](bufferSize: Int)(implicit materializer: Mater
     lastSendFuture
   }
 
+  /** Send a batch of data to the stream, without blocking the current thread.
+   *
+   *  Data will not flow through the stream unless the stream is materialized and run.
+   *
+   *  If this source has the `[[DataSource.Backpressure Backpressure]]` overflow policy, then each datum is offered once
+   *  the previous offer has completed, by chaining the offers' futures rather than by waiting for them; if an offer is
+   *  not successful, the remaining data in the batch is not sent. Subsequent calls to `[[send]]` wait for the entire
+   *  batch to be queued. Under other overflow policies, each datum is offered immediately.
+   *
+   *  @param batch Data to be sent to the stream, in order.
+   *
+   *  @return Future containing `[[akka.stream.QueueOfferResult.Enqueued Enqueued]]` if all of the data was queued, or
+   *  the result of the first offer that was not queued otherwise. Failures are reported as for `[[send]]`.
+   *
+   *  @since 0.3
+   */
+  @NonPure
+  def sendAll(batch: Iterable[A]): Future[QueueOfferResult] = synchronized {
+
+    // Stream queue concerned.
+    val queue = streamSource._1
+
+    // When exerting back pressure, chain each offer onto the completion of the previous offer.
+    if(overflow.blocking) {
+      lastSendFuture = batch.foldLeft(lastSendFuture) {(previous, data) =>
+        previous.flatMap {
+          case QueueOfferResult.Enqueued => queue.offer(data)
+          case other => Future.successful(other)
+        }
+      }
+      lastSendFuture
+    }
+
+    // Otherwise, offer all of the data at once, and report the first result that was not queued, if any.
+    else {
+      val results = batch.map(queue.offer).toList
+      results.lastOption.foreach(lastSendFuture = _)
+      Future.sequence(results).map(_.find(_ != QueueOfferResult.Enqueued).getOrElse(QueueOfferResult.Enqueued))
+    }
+  }
+
   /** Report the source to which flows and sinks can be attached.
+   *
+   *  @note If this source has the `[[DataSource.Conflate Conflate]]` overflow policy, then a slow consumer receives
+   *  only the latest data sent since it last received data.
    *
    *  @return Source for streamed data. This must be connected to a sink, and run, in order to for data to be processed.
    *
    *  @since 0.2
    */
-  def source: Source[A, NotUsed] = streamSource._2
+  def source: Source[A, NotUsed] = {
+    if(overflow == DataSource.Conflate) streamSource._2.conflate((_, latest) => latest)
+    else streamSource._2
+  }
 
   /** Signal successful completion of the data stream.
    *
@@ -180,4 +241,53 @@ object DataSource {
    *  @since 0.2
    */
   val MaxBufferSize: Int = 4096
+
+  /** Policy determining how a data source handles data sent while its buffer is full.
+   *
+   *  @constructor Create a new overflow policy.
+   *
+   *  @param strategy ''Akka Streams'' overflow strategy of the source's queue.
+   *
+   *  @param blocking `true` if sending data may block the sending thread; `false` if it never does.
+   *
+   *  @since 0.3
+   */
+  sealed abstract class Overflow private[DataSource](private[stream] val strategy: OverflowStrategy,
+  private[stream] val blocking: Boolean)
+
+  /** Block the sending thread until data can be queued, exerting back pressure on the producer.
+   *
+   *  This is the default policy, under which no data is lost.
+   *
+   *  @since 0.3
+   */
+  case object Backpressure
+  extends Overflow(OverflowStrategy.backpressure, true)
+
+  /** Drop data that is sent while the buffer is full, without blocking the sending thread.
+   *
+   *  The offer of each dropped datum results in `[[akka.stream.QueueOfferResult.Dropped Dropped]]`.
+   *
+   *  @since 0.3
+   */
+  case object DropNewest
+  extends Overflow(OverflowStrategy.dropNew, false)
+
+  /** Drop the oldest buffered data to make room for data that is sent while the buffer is full, without blocking the
+   *  sending thread.
+   *
+   *  @since 0.3
+   */
+  case object DropOldest
+  extends Overflow(OverflowStrategy.dropHead, false)
+
+  /** Never block the sending thread; if the consumer falls behind, deliver only the latest data sent.
+   *
+   *  This policy is appropriate for data, such as status updates, for which each datum supersedes all of those sent
+   *  before it.
+   *
+   *  @since 0.3
+   */
+  case object Conflate
+  extends Overflow(OverflowStrategy.dropHead, false)
 }
\ No newline at end of file
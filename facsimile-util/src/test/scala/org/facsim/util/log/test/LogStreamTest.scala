@@ -37,7 +37,7 @@
 package org.facsim.util.log.test
 
 import akka.stream.scaladsl.{Flow, Keep, Sink}
-import akka.stream.QueueOfferResult.{Enqueued, QueueClosed}
+import akka.stream.QueueOfferResult.{Dropped, Enqueued, QueueClosed}
 import akka.stream.StreamDetachedException
 import org.facsim.util.log._
 import org.facsim.util.test.AkkaStreamsTestHarness
@@ -200,6 +200,96 @@ with ScalaCheckPropertyChecks {
         }
       }
     }
+
+    // Test that messages below the threshold are discarded.
+    describe(".log(LogMessage[A]) with a threshold") {
+
+      // Verify that only messages at or above the threshold show up in a sink.
+      it("must only send messages at or above the threshold") {
+        forAll(validBufferSizes, severities, logListNonEmpty) {(bufferSize, threshold, msgs) =>
+
+          // Create the log stream.
+          val ds = new LogStream[String](bufferSize, threshold)
+
+          // Get the source and add a sink to a sequence.
+          val futureData = ds.source.runWith(seqSink())
+
+          // Send all of the log messages, verifying that those below the threshold are dropped.
+          msgs.foreach {m =>
+            val expected = if(m.severity >= threshold) Enqueued else Dropped
+            assert(Await.result(ds.log(m), futureTimeout) === expected)
+          }
+
+          // Close the log.
+          val streamCompleted = ds.close()
+          Await.ready(streamCompleted, futureTimeout)
+
+          // Verify that the result is the sequence of log messages at or above the threshold.
+          assert(Await.result(futureData, futureTimeout) === msgs.filter(_.severity >= threshold))
+        }
+      }
+    }
+
+    // Test that lazily logged messages are only created if they are sent.
+    describe(".log(Severity, Scope, => A)(=> String)") {
+
+      // Verify that lazy messages are only evaluated, and sent, if at or above the threshold.
+      it("must only evaluate and send messages at or above the threshold") {
+        forAll(validBufferSizes, severities, logListNonEmpty) {(bufferSize, threshold, msgs) =>
+
+          // Create the log stream.
+          val ds = new LogStream[String](bufferSize, threshold)
+
+          // Get the source and add a sink to a sequence.
+          val futureData = ds.source.runWith(seqSink())
+
+          // Lazily send all of the log messages, counting the number of message evaluations.
+          var evaluations = 0 //scalastyle:ignore var.local
+          msgs.foreach {m =>
+            val df = ds.log(m.severity, m.scope, m.prefix) {
+              evaluations += 1
+              m.msg
+            }
+            Await.ready(df, futureTimeout)
+          }
+
+          // Close the log.
+          val streamCompleted = ds.close()
+          Await.ready(streamCompleted, futureTimeout)
+
+          // Verify that only the messages at or above the threshold were evaluated and received.
+          val expected = msgs.filter(_.severity >= threshold)
+          assert(evaluations === expected.size)
+          assert(Await.result(futureData, futureTimeout) === expected)
+        }
+      }
+    }
+
+    // Test that batches of messages are sent OK.
+    describe(".logAll(Iterable[LogMessage[A]])") {
+
+      // Verify that a batch of messages shows up in a sink, less those below the threshold.
+      it("must send a batch of messages at or above the threshold") {
+        forAll(validBufferSizes, severities, logListNonEmpty) {(bufferSize, threshold, msgs) =>
+
+          // Create the log stream.
+          val ds = new LogStream[String](bufferSize, threshold)
+
+          // Get the source and add a sink to a sequence.
+          val futureData = ds.source.runWith(seqSink())
+
+          // Send the batch and verify that it was queued.
+          assert(Await.result(ds.logAll(msgs), futureTimeout) === Enqueued)
+
+          // Close the log.
+          val streamCompleted = ds.close()
+          Await.ready(streamCompleted, futureTimeout)
+
+          // Verify that the result is the sequence of log messages at or above the threshold.
+          assert(Await.result(futureData, futureTimeout) === msgs.filter(_.severity >= threshold))
+        }
+      }
+    }
   }
 }
 
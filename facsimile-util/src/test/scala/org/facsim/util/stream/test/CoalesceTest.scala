@@ -0,0 +1,113 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.util.stream.test package.
+//======================================================================================================================
+package org.facsim.util.stream.test
+
+import akka.stream.scaladsl.{Sink, Source}
+import org.facsim.util.stream.Coalesce
+import org.facsim.util.test.AkkaStreamsTestHarness
+import org.scalacheck.Gen
+import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
+import scala.concurrent.Await
+import scala.concurrent.duration._
+
+// Disable test-problematic Scalastyle checkers.
+//scalastyle:off scaladoc
+//scalastyle:off public.methods.have.type
+//scalastyle:off multiple.string.literals
+//scalastyle:off magic.numbers
+
+/** Test harness for the [[org.facsim.util.stream.Coalesce]] object. */
+final class CoalesceTest
+extends AkkaStreamsTestHarness
+with ScalaCheckPropertyChecks {
+
+  /** Timeout for awaiting the result of a future. */
+  val futureTimeout: FiniteDuration = 5.seconds
+
+  /** Frame interval for coalescing updates. */
+  val interval: FiniteDuration = 10.milliseconds
+
+  /** Updates, as (key, value) pairs, having a small number of distinct keys. */
+  val updates: Gen[List[(Int, Int)]] = Gen.nonEmptyListOf(Gen.zip(Gen.choose(0, 7), Gen.choose(0, 1000)))
+
+  // Test the Coalesce object.
+  describe("org.facsim.util.stream.Coalesce") {
+
+    // Verify the latest per key coalescing flow.
+    describe(".latestPerKey[A, K](A => K, FiniteDuration)") {
+
+      // Verify that each frame holds at most one value per key.
+      it("must emit at most one value per key in each frame") {
+        forAll(updates) {data =>
+          val frames = Await.result(Source(data).via(Coalesce.latestPerKey(_._1, interval)).runWith(Sink.seq),
+          futureTimeout)
+          frames.foreach {frame =>
+            assert(frame.nonEmpty)
+            assert(frame.map(_._1).distinct.size === frame.size)
+          }
+        }
+      }
+
+      // Verify that the latest value of each key is always delivered.
+      it("must deliver the latest value of every key") {
+        forAll(updates) {data =>
+          val frames = Await.result(Source(data).via(Coalesce.latestPerKey(_._1, interval)).runWith(Sink.seq),
+          futureTimeout)
+          assert(frames.flatten.toMap === data.toMap)
+        }
+      }
+
+      // Verify that values are only dropped if superseded.
+      it("must only discard values that are superseded by later values of the same key") {
+        forAll(updates) {data =>
+          val frames = Await.result(Source(data).via(Coalesce.latestPerKey(_._1, interval)).runWith(Sink.seq),
+          futureTimeout)
+          val received = frames.flatten
+          assert(received.forall(data.contains))
+          assert(received.size <= data.size)
+          assert(data.map(_._1).distinct.forall(k => received.exists(_._1 == k)))
+        }
+      }
+    }
+  }
+}
+
+// Re-enable test-problematic Scalastyle checkers.
+//scalastyle:on magic.numbers
+//scalastyle:on multiple.string.literals
+//scalastyle:on public.methods.have.type
+//scalastyle:on scaladoc
@@ -37,7 +37,7 @@
 package org.facsim.util.stream.test
 
 import akka.stream.scaladsl.{Flow, Keep, Sink}
-import akka.stream.QueueOfferResult.{Enqueued, QueueClosed}
+import akka.stream.QueueOfferResult.{Dropped, Enqueued, QueueClosed}
 import akka.stream.StreamDetachedException
 import org.facsim.util.stream.DataSource
 import org.facsim.util.test.{AkkaStreamsTestHarness, Generator}
@@ -222,6 +222,121 @@ with ScalaCheckPropertyChecks {
         }
       }
     }
+
+    // Test that batches of sent data are received OK.
+    describe(".sendAll(Iterable[A])") {
+
+      // Verify that we can send a batch of data, and have it show up in a sink.
+      it("must send a batch of data to an uncompleted stream") {
+        forAll(validBufferSizes, Generator.unicodeStringListNonEmpty) {(bufferSize, data) =>
+
+          // Create the data source.
+          val ds = new DataSource[String](bufferSize)
+
+          // Get the source and add a sink to a sequence.
+          val futureData = ds.source.runWith(seqSink())
+
+          // Send all of the data as one batch, followed by a single datum.
+          val batchFuture = ds.sendAll(data)
+          val lastFuture = ds.send("last")
+
+          // Verify that all of the data is sent.
+          assert(Await.result(batchFuture, futureTimeout) === Enqueued)
+          assert(Await.result(lastFuture, futureTimeout) === Enqueued)
+
+          // Complete the stream.
+          val streamCompleted = ds.complete()
+          Await.ready(streamCompleted, futureTimeout)
+
+          // Verify that the result is the original sequence of data, in order.
+          assert(Await.result(futureData, futureTimeout) === data :+ "last")
+        }
+      }
+
+      // Verify that a batch is rejected after the stream has been completed successfully.
+      it("must fail to send a batch of data to a completed stream") {
+        forAll(validBufferSizes, Generator.unicodeStringListNonEmpty) {(bufferSize, data) =>
+
+          // Create the data source.
+          val ds = new DataSource[String](bufferSize)
+
+          // Get the source and add a sink to a sequence.
+          val futureData = ds.source.runWith(seqSink())
+
+          // Complete the stream.
+          val streamCompleted = ds.complete()
+          Await.ready(streamCompleted, futureTimeout)
+
+          // Write the data to the stream. It should return a Success(QueueClosed), or a failure containing a
+          // StreamDetachedException.
+          val df = ds.sendAll(data)
+          Await.ready(df, futureTimeout)
+          df.value.get match {
+            case Success(r) => assert(r === QueueClosed)
+            case Failure(e) => assert(e.getClass === classOf[StreamDetachedException])
+          }
+
+          // Verify that we didn't receive any data.
+          assert(Await.result(futureData, futureTimeout) === Nil)
+        }
+      }
+    }
+
+    // Test the non-blocking overflow policies.
+    describe(".ctor(Int, Overflow)(ActorMaterializer)") {
+
+      // Verify that data sent to a full buffer is dropped, rather than blocking the sender.
+      it("must drop the newest data, without blocking, if the buffer is full") {
+        forAll(validBufferSizes) {bufferSize =>
+
+          // Create the data source, but do not run it, so that nothing consumes the data.
+          val ds = new DataSource[String](bufferSize, DataSource.DropNewest)
+
+          // Fill the buffer, then send one more datum, which must be dropped.
+          val data = List.tabulate(bufferSize)(_.toString)
+          assert(Await.result(ds.sendAll(data), futureTimeout) === Enqueued)
+          assert(Await.result(ds.send("dropped"), futureTimeout) === Dropped)
+
+          // Now run the stream and verify that only the buffered data is received.
+          val futureData = ds.source.runWith(seqSink())
+          Await.ready(ds.complete(), futureTimeout)
+          assert(Await.result(futureData, futureTimeout) === data)
+        }
+      }
+
+      // Verify that the oldest data is discarded to make room for new data.
+      it("must drop the oldest data, without blocking, if the buffer is full") {
+        forAll(validBufferSizes) {bufferSize =>
+
+          // Create the data source, but do not run it, so that nothing consumes the data.
+          val ds = new DataSource[String](bufferSize, DataSource.DropOldest)
+
+          // Overfill the buffer by one datum.
+          val data = List.tabulate(bufferSize + 1)(_.toString)
+          assert(Await.result(ds.sendAll(data), futureTimeout) === Enqueued)
+
+          // Now run the stream and verify that the first datum was discarded.
+          val futureData = ds.source.runWith(seqSink())
+          Await.ready(ds.complete(), futureTimeout)
+          assert(Await.result(futureData, futureTimeout) === data.tail)
+        }
+      }
+
+      // Verify that conflated data ends with the latest datum sent.
+      it("must deliver the latest data, without blocking, when conflating") {
+        forAll(validBufferSizes, Generator.unicodeStringListNonEmpty) {(bufferSize, data) =>
+
+          // Create the data source, but do not run it, so that nothing consumes the data.
+          val ds = new DataSource[String](bufferSize, DataSource.Conflate)
+          assert(Await.result(ds.sendAll(data), futureTimeout) === Enqueued)
+
+          // Now run the stream and verify that the latest datum was received last.
+          val futureData = ds.source.runWith(seqSink())
+          Await.ready(ds.complete(), futureTimeout)
+          assert(Await.result(futureData, futureTimeout).last === data.last)
+        }
+      }
+    }
   }
 }
 
@@ -36,11 +36,15 @@
 //======================================================================================================================
 package org.facsim.util.test
 
+import java.util.concurrent.atomic.AtomicInteger
+import java.util.concurrent.{CountDownLatch, Executors}
 import org.facsim.util.Memoize
 import org.scalacheck.Arbitrary.arbitrary
 import org.scalacheck.Gen
 import org.scalatestplus.scalacheck.ScalaCheckPropertyChecks
 import org.scalatest.funspec.AnyFunSpec
+import scala.concurrent.duration.Duration
+import scala.concurrent.{Await, ExecutionContext, Future}
 
 // Disable test-problematic Scalastyle checkers.
 //scalastyle:off public.methods.have.type
@@ -320,6 +324,93 @@ with ScalaCheckPropertyChecks {
         }
       }
     }
+
+    // Test hit and miss counters.
+    describe(".hits and .misses") {
+      it("must count cache hits and misses") {
+        forAll {il: List[Int] =>
+          val mf = Memoize((i: Int) => i.toString)
+          il.foreach(mf)
+          val unique = il.distinct.size.toLong
+          assert(mf.misses === unique)
+          assert(mf.hits === il.size.toLong - unique)
+          assert(mf.size === unique)
+        }
+      }
+    }
+
+    // Test bounded memoization.
+    describe(".apply(A => R, Int)") {
+
+      // Invalid capacities must be rejected.
+      it("must reject invalid capacities") {
+        assertThrows[IllegalArgumentException](Memoize((i: Int) => i, 0))
+        assertThrows[IllegalArgumentException](Memoize((i: Int, j: Int) => i + j, -1))
+        assertThrows[IllegalArgumentException](Memoize((i: Int, j: Int, k: Int) => i + j + k, Int.MinValue))
+      }
+
+      // The number of cached results must not exceed the capacity.
+      it("must not cache more results than its capacity") {
+        forAll(Gen.listOf(Gen.choose(0, 100)), Gen.choose(1, 20)) {(il, capacity) =>
+          val calls = new AtomicInteger(0)
+          val mf = Memoize((i: Int) => {
+            val _ = calls.incrementAndGet()
+            i * 2
+          }, capacity)
+          il.foreach(i => assert(mf(i) === i * 2))
+          assert(mf.size <= capacity.toLong)
+          assert(mf.misses === calls.get.toLong)
+          assert(mf.hits + mf.misses === il.size.toLong)
+        }
+      }
+
+      // Recently-referenced results must be retained in preference to others.
+      it("must give recently referenced results a second chance") {
+        val mf = Memoize((i: Int, j: Int) => i + j, 2)
+        assert(mf(1, 1) === 2)
+        assert(mf(2, 2) === 4)
+        assert(mf(1, 1) === 2)
+        assert(mf(3, 3) === 6)
+        assert(mf.misses === 3L)
+        assert(mf(1, 1) === 2)
+        assert(mf.misses === 3L)
+        assert(mf(2, 2) === 4)
+        assert(mf.misses === 4L)
+        assert(mf.size === 2L)
+      }
+    }
+
+    // Test concurrent memoization.
+    describe("when called concurrently") {
+      it("must evaluate the function once for each argument value") {
+        val threads = 8
+        val pool = Executors.newFixedThreadPool(threads)
+        try {
+          implicit val ec: ExecutionContext = ExecutionContext.fromExecutorService(pool)
+          val calls = new AtomicInteger(0)
+          val start = new CountDownLatch(1)
+          val mf = Memoize((i: Int, s: String, d: Double) => {
+            val _ = calls.incrementAndGet()
+            s"$i$s$d"
+          })
+          val results = Future.traverse((0 until threads).toList) {_ =>
+            Future {
+              start.await()
+              (0 until 1000).map(i => mf(i % 100, "x", 1.0))
+            }
+          }
+          start.countDown()
+          val values = Await.result(results, Duration.Inf)
+          assert(values.forall(_ === values.head))
+          assert(calls.get === 100)
+          assert(mf.misses === 100L)
+          assert(mf.hits === threads * 1000L - 100L)
+        }
+        finally {
+          pool.shutdown()
+        }
+      }
+    }
   }
 }
 // Re-enable test-problematic Scalastyle checkers.
@@ -0,0 +1,139 @@
+//======================================================================================================================
+// Facsimile: A Discrete-Event Simulation Library
+// Copyright © 2004-2020, Michael J Allen.
+//
+// This file is part of Facsimile.
+//
+// Facsimile is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Facsimile is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with Facsimile. If not, see:
+//
+//   http://www.gnu.org/licenses/lgpl.
+//
+// The developers welcome all comments, suggestions and offers of assistance. For further information, please visit the
+// project home page at:
+//
+//   http://facsim.org/
+//
+// Thank you for your interest in the Facsimile project!
+//
+// IMPORTANT NOTE: All patches (modifications to existing files and/or the addition of new files) submitted for
+// inclusion as part of the official Facsimile code base, must comply with the published Facsimile Coding Standards. If
+// your code fails to comply with the standard, then your patches will be rejected. For further information, please
+// visit the coding standards at:
+//
+//   http://facsim.org/Documentation/CodingStandards/
+//======================================================================================================================
+
+//======================================================================================================================
+// Scala source file belonging to the org.facsim.util.parse package.
+//======================================================================================================================
+package org.facsim.util.parse
+
+import java.nio.ByteBuffer
+import java.nio.channels.FileChannel
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Path, StandardOpenOption}
+import org.parboiled2.ParserInput.DefaultParserInput
+
+/** ''[[http://parboiled2.org/ Parboiled2]]'' parser input read directly from a byte buffer.
+ *
+ *  Each byte of the buffer is presented to the parser as a single character, without decoding the buffer's contents
+ *  into a string; consequently, the buffer may be memory-mapped from a file, so that large files can be parsed without
+ *  holding a copy of their contents on the heap.
+ *
+ *  This input is intended for formats whose syntax is expressed solely in 7-bit ''ASCII'' characters, but which may
+ *  contain ''UTF-8''-encoded text within fields. Bytes that make up multi-byte ''UTF-8'' sequences are presented to
+ *  the parser as individual (non-''ASCII'') characters, which rules should accept wherever such text is permitted;
+ *  captured slices of the input are decoded as ''UTF-8'', so that they yield the original text.
+ *
+ *  Error positions reported by the parser (as line and column numbers) are determined from this input in the usual
+ *  way. Note that columns are counted in bytes, rather than in characters.
+ *
+ *  @constructor Create a new byte buffer input.
+ *
+ *  @param buffer Buffer containing the input to be parsed, from its position to its limit. The buffer's position and
+ *  limit are not modified by the parser.
+ *
+ *  @since 0.3
+ */
+private[facsim] final class ByteBufferInput(buffer: ByteBuffer)
+extends DefaultParserInput {
+
+  /** Offset of the first byte of the input within the buffer. */
+  private val offset = buffer.position
+
+  /** Number of bytes in the input. */
+  override val length: Int = buffer.remaining
+
+  /** @inheritdoc */
+  override def charAt(ix: Int): Char = (buffer.get(offset + ix) & ByteBufferInput.ByteMask).toChar
+
+  /** @inheritdoc
+   *
+   *  @note The selected bytes are decoded as ''UTF-8''.
+   */
+  override def sliceString(start: Int, end: Int): String = new String(slice(start, end), StandardCharsets.UTF_8)
+
+  /** @inheritdoc
+   *
+   *  @note The selected bytes are decoded as ''UTF-8''.
+   */
+  override def sliceCharArray(start: Int, end: Int): Array[Char] = sliceString(start, end).toCharArray
+
+  /** Copy a slice of the input.
+   *
+   *  @param start Index of the first byte of the slice.
+   *
+   *  @param end Index following the last byte of the slice.
+   *
+   *  @return Bytes making up the slice. The returned array is empty if `end` does not exceed `start`.
+   */
+  private def slice(start: Int, end: Int): Array[Byte] = {
+    val first = Math.max(start, 0)
+    val last = Math.min(end, length)
+    val bytes = new Array[Byte](Math.max(last - first, 0))
+    val view = buffer.duplicate()
+    val _ = view.position(offset + first)
+    val _ = view.get(bytes)
+    bytes
+  }
+}
+
+/** Byte buffer input companion.
+ *
+ *  @since 0.3
+ */
+private[facsim] object ByteBufferInput {
+
+  /** Mask converting a signed byte into an unsigned value. */
+  private val ByteMask = 0xFF
+
+  /** Create an input that memory-maps the specified file.
+   *
+   *  The mapping remains valid, and the file's contents are paged in on demand, after the file has been closed.
+   *
+   *  @param path Path of the file to be mapped.
+   *
+   *  @return Input presenting the contents of the file.
+   *
+   *  @throws java.io.IOException if the file cannot be opened or mapped.
+   *
+   *  @throws IllegalArgumentException if the file is larger than 2GiB, which exceeds the capacity of parser inputs.
+   */
+  def map(path: Path): ByteBufferInput = {
+    val channel = FileChannel.open(path, StandardOpenOption.READ)
+    try {
+      new ByteBufferInput(channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size))
+    }
+    finally {
+      channel.close()
+    }
+  }
+}